@@ -61,6 +61,7 @@ AdditiveClipBlend::~AdditiveClipBlend()
 void AdditiveClipBlend::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
 {
     if (e->type() == Qt3DCore::PropertyUpdated) {
+        const QVector<Qt3DCore::QNodeId> previousDependencyIds = currentDependencyIds();
         Qt3DCore::QPropertyUpdatedChangePtr change = qSharedPointerCast<Qt3DCore::QPropertyUpdatedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("additiveFactor"))
             m_additiveFactor = change->value().toFloat();
@@ -68,20 +69,19 @@ void AdditiveClipBlend::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
             m_baseClipId = change->value().value<Qt3DCore::QNodeId>();
         else if (change->propertyName() == QByteArrayLiteral("additiveClip"))
             m_additiveClipId = change->value().value<Qt3DCore::QNodeId>();
+        notifyIfDependenciesChanged(previousDependencyIds);
     }
 }
 
-ClipResults AdditiveClipBlend::doBlend(const QVector<ClipResults> &blendData) const
+void AdditiveClipBlend::doBlend(const QVector<ClipResults> &blendData, ClipResults &blendResults) const
 {
     Q_ASSERT(blendData.size() == 2);
     Q_ASSERT(blendData[0].size() == blendData[1].size());
     const int elementCount = blendData.first().size();
-    ClipResults blendResults(elementCount);
+    blendResults.resize(elementCount);
 
     for (int i = 0; i < elementCount; ++i)
         blendResults[i] = blendData[0][i] + m_additiveFactor * blendData[1][i];
-
-    return blendResults;
 }
 
 void AdditiveClipBlend::initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change)
@@ -91,7 +91,7 @@ public:
     }
 
 protected:
-    ClipResults doBlend(const QVector<ClipResults> &blendData) const Q_DECL_FINAL;
+    void doBlend(const QVector<ClipResults> &blendData, ClipResults &blendResults) const Q_DECL_FINAL;
 
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
@@ -44,16 +44,71 @@
 #include <Qt3DCore/qpropertyupdatedchange.h>
 
 #include <QtCore/qbytearray.h>
+#include <QtCore/qendian.h>
 #include <QtCore/qfile.h>
 #include <QtCore/qjsonarray.h>
 #include <QtCore/qjsondocument.h>
 #include <QtCore/qjsonobject.h>
 
+#include <cstring>
+
 QT_BEGIN_NAMESPACE
 
 namespace Qt3DAnimation {
 namespace Animation {
 
+namespace {
+
+/*
+    Precompiled binary animation clip container, as written by the
+    qanimationclip tool. All values are little endian 32 bit quantities.
+
+    Header:
+        char[4]   magic "QAC1"
+        quint32   format version
+        quint32   animation count
+        quint32   reserved
+    Index, one entry per animation:
+        quint32   name offset (from start of file), name size (UTF-8)
+        quint32   data offset (from start of file), data size
+    Animation data block, offsets relative to the start of the block:
+        quint32   channel count, channel component count
+        channel records:    name offset, name size, first component, component count
+        component records:  name offset, name size, keyframe offset, keyframe count
+        keyframe records:   float time, value, left handle x/y, right handle x/y,
+                            quint32 QKeyFrame::InterpolationType
+
+    Each animation block is self contained so that it can be mapped on its own.
+*/
+const char binaryClipMagic[4] = { 'Q', 'A', 'C', '1' };
+const quint32 binaryClipVersion = 1;
+const int binaryClipHeaderSize = 16;
+const int binaryClipIndexEntrySize = 16;
+const int binaryClipBlockHeaderSize = 8;
+const int binaryClipChannelRecordSize = 16;
+const int binaryClipComponentRecordSize = 16;
+const int binaryClipKeyframeRecordSize = 28;
+
+inline quint32 readUInt32(const uchar *data)
+{
+    return qFromLittleEndian<quint32>(data);
+}
+
+inline float readFloat(const uchar *data)
+{
+    const quint32 bits = qFromLittleEndian<quint32>(data);
+    float value;
+    std::memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+inline bool isInRange(quint32 offset, quint64 size, quint64 available)
+{
+    return quint64(offset) + size <= available;
+}
+
+} // anonymous
+
 AnimationClip::AnimationClip()
     : BackendNode(ReadWrite)
     , m_source()
@@ -190,21 +245,45 @@ void AnimationClip::loadAnimationFromUrl()
         return;
     }
 
-    QByteArray animationData = file.readAll();
+    // The fragment of the url, if any, names the animation to load from
+    // files containing several of them
+    const QString animationName = m_source.fragment();
+
+    if (file.peek(sizeof(binaryClipMagic)) == QByteArray::fromRawData(binaryClipMagic, sizeof(binaryClipMagic))) {
+        if (!loadAnimationFromBinary(file, animationName)) {
+            qWarning() << "Could not load binary animation clip:" << filePath << animationName;
+            clearData();
+            setStatus(QAnimationClipLoader::Error);
+        }
+        return;
+    }
+
+    loadAnimationFromJson(file.readAll(), animationName);
+}
+
+void AnimationClip::loadAnimationFromJson(const QByteArray &animationData, const QString &animationName)
+{
     QJsonDocument document = QJsonDocument::fromJson(animationData);
     QJsonObject rootObject = document.object();
 
-    // TODO: Allow loading of a named animation from a file containing many
     QJsonArray animationsArray = rootObject[QLatin1String("animations")].toArray();
     qCDebug(Jobs) << "Found" << animationsArray.size() << "animations:";
+    int animationIndex = animationName.isEmpty() ? 0 : -1;
     for (int i = 0; i < animationsArray.size(); ++i) {
         QJsonObject animation = animationsArray.at(i).toObject();
-        qCDebug(Jobs) << "Animation Name:" << animation[QLatin1String("animationName")].toString();
+        const QString name = animation[QLatin1String("animationName")].toString();
+        qCDebug(Jobs) << "Animation Name:" << name;
+        if (animationIndex == -1 && name == animationName)
+            animationIndex = i;
     }
 
-    // For now just load the first animation
-    // TODO: Allow loading a named animation from within the file analogous to QMesh
-    QJsonObject animation = animationsArray.at(0).toObject();
+    if (animationIndex == -1) {
+        qWarning() << "Could not find animation" << animationName << "in" << m_source;
+        setStatus(QAnimationClipLoader::Error);
+        return;
+    }
+
+    QJsonObject animation = animationsArray.at(animationIndex).toObject();
     m_name = animation[QLatin1String("animationName")].toString();
     QJsonArray channelsArray = animation[QLatin1String("channels")].toArray();
     const int channelCount = channelsArray.size();
@@ -215,6 +294,130 @@ void AnimationClip::loadAnimationFromUrl()
     }
 }
 
+/*!
+    \internal
+
+    Loads the animation named \a animationName, or the first animation if
+    the name is empty, from the binary clip container \a file. Only the
+    header, the index and the data block of the requested animation are
+    accessed. The block is memory mapped when possible. Returns false if the
+    animation cannot be found or the container is malformed.
+ */
+bool AnimationClip::loadAnimationFromBinary(QFile &file, const QString &animationName)
+{
+    const QByteArray header = file.read(binaryClipHeaderSize);
+    if (header.size() != binaryClipHeaderSize)
+        return false;
+    const uchar *headerData = reinterpret_cast<const uchar *>(header.constData());
+    if (readUInt32(headerData + 4) != binaryClipVersion)
+        return false;
+
+    // Locate the requested animation in the index
+    const quint32 animationCount = readUInt32(headerData + 8);
+    const QByteArray index = file.read(qint64(animationCount) * binaryClipIndexEntrySize);
+    if (quint32(index.size()) != animationCount * binaryClipIndexEntrySize)
+        return false;
+    const quint64 fileSize = quint64(file.size());
+    const uchar *indexData = reinterpret_cast<const uchar *>(index.constData());
+    const QByteArray requestedName = animationName.toUtf8();
+    int animationIndex = (requestedName.isEmpty() && animationCount > 0) ? 0 : -1;
+    for (quint32 i = 0; i < animationCount && animationIndex == -1; ++i) {
+        const uchar *entry = indexData + i * binaryClipIndexEntrySize;
+        const quint32 nameOffset = readUInt32(entry);
+        const quint32 nameSize = readUInt32(entry + 4);
+        if (nameSize != quint32(requestedName.size()) || !isInRange(nameOffset, nameSize, fileSize))
+            continue;
+        file.seek(nameOffset);
+        if (file.read(nameSize) == requestedName)
+            animationIndex = int(i);
+    }
+    if (animationIndex == -1)
+        return false;
+
+    const uchar *entry = indexData + animationIndex * binaryClipIndexEntrySize;
+    const quint32 nameOffset = readUInt32(entry);
+    const quint32 nameSize = readUInt32(entry + 4);
+    const quint32 dataOffset = readUInt32(entry + 8);
+    const quint32 dataSize = readUInt32(entry + 12);
+    if (!isInRange(nameOffset, nameSize, fileSize) || !isInRange(dataOffset, dataSize, fileSize)
+            || dataSize < quint32(binaryClipBlockHeaderSize))
+        return false;
+    file.seek(nameOffset);
+    m_name = QString::fromUtf8(file.read(nameSize));
+
+    // Map the data block of this animation only, falling back to reading it
+    // for devices that cannot be mapped such as compressed resources
+    QByteArray blockStorage;
+    const uchar *block = file.map(dataOffset, dataSize);
+    if (block == nullptr) {
+        file.seek(dataOffset);
+        blockStorage = file.read(dataSize);
+        if (quint32(blockStorage.size()) != dataSize)
+            return false;
+        block = reinterpret_cast<const uchar *>(blockStorage.constData());
+    }
+
+    const quint32 channelCount = readUInt32(block);
+    const quint32 componentCount = readUInt32(block + 4);
+    const quint64 channelRecordsOffset = binaryClipBlockHeaderSize;
+    const quint64 componentRecordsOffset = channelRecordsOffset + quint64(channelCount) * binaryClipChannelRecordSize;
+    bool valid = componentRecordsOffset + quint64(componentCount) * binaryClipComponentRecordSize <= dataSize;
+
+    m_channels.resize(valid ? int(channelCount) : 0);
+    for (quint32 i = 0; valid && i < channelCount; ++i) {
+        const uchar *channelRecord = block + channelRecordsOffset + i * binaryClipChannelRecordSize;
+        const quint32 channelNameOffset = readUInt32(channelRecord);
+        const quint32 channelNameSize = readUInt32(channelRecord + 4);
+        const quint32 firstComponent = readUInt32(channelRecord + 8);
+        const quint32 channelComponentCount = readUInt32(channelRecord + 12);
+        if (!isInRange(channelNameOffset, channelNameSize, dataSize)
+                || quint64(firstComponent) + channelComponentCount > componentCount) {
+            valid = false;
+            break;
+        }
+
+        Channel &channel = m_channels[i];
+        channel.name = QString::fromUtf8(reinterpret_cast<const char *>(block + channelNameOffset),
+                                         channelNameSize);
+        channel.channelComponents.resize(channelComponentCount);
+        for (quint32 j = 0; j < channelComponentCount; ++j) {
+            const uchar *componentRecord = block + componentRecordsOffset
+                    + (firstComponent + j) * binaryClipComponentRecordSize;
+            const quint32 componentNameOffset = readUInt32(componentRecord);
+            const quint32 componentNameSize = readUInt32(componentRecord + 4);
+            const quint32 keyframeOffset = readUInt32(componentRecord + 8);
+            const quint32 keyframeCount = readUInt32(componentRecord + 12);
+            if (!isInRange(componentNameOffset, componentNameSize, dataSize)
+                    || !isInRange(keyframeOffset, quint64(keyframeCount) * binaryClipKeyframeRecordSize, dataSize)) {
+                valid = false;
+                break;
+            }
+
+            ChannelComponent &channelComponent = channel.channelComponents[j];
+            channelComponent.name = QString::fromUtf8(reinterpret_cast<const char *>(block + componentNameOffset),
+                                                      componentNameSize);
+            FCurve &fcurve = channelComponent.fcurve;
+            fcurve.clearKeyframes();
+            fcurve.reserveKeyframes(keyframeCount);
+            for (quint32 k = 0; k < keyframeCount; ++k) {
+                const uchar *keyframeRecord = block + keyframeOffset + k * binaryClipKeyframeRecordSize;
+                Keyframe keyframe;
+                keyframe.value = readFloat(keyframeRecord + 4);
+                keyframe.leftControlPoint = QVector2D(readFloat(keyframeRecord + 8),
+                                                      readFloat(keyframeRecord + 12));
+                keyframe.rightControlPoint = QVector2D(readFloat(keyframeRecord + 16),
+                                                       readFloat(keyframeRecord + 20));
+                keyframe.interpolation = static_cast<QKeyFrame::InterpolationType>(readUInt32(keyframeRecord + 24));
+                fcurve.appendKeyframe(readFloat(keyframeRecord), keyframe);
+            }
+        }
+    }
+
+    if (blockStorage.isNull())
+        file.unmap(const_cast<uchar *>(block));
+    return valid;
+}
+
 void AnimationClip::loadAnimationFromData()
 {
     // Reformat data from QAnimationClipData to backend format
@@ -56,6 +56,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QFile;
+
 namespace Qt3DAnimation {
 namespace Animation {
 
@@ -101,6 +103,8 @@ public:
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
     void loadAnimationFromUrl();
+    void loadAnimationFromJson(const QByteArray &animationData, const QString &animationName);
+    bool loadAnimationFromBinary(QFile &file, const QString &animationName);
     void loadAnimationFromData();
     void clearData();
     float findDuration();
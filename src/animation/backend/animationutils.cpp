@@ -196,10 +196,17 @@ ComponentIndices channelComponentsToIndicesHelper(const Channel &channel,
 
 ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
 {
-    QVector<float> channelResults;
+    ClipResults channelResults;
+    evaluateClipAtLocalTime(clip, localTime, channelResults);
+    return channelResults;
+}
+
+void evaluateClipAtLocalTime(AnimationClip *clip, float localTime, ClipResults &channelResults)
+{
     Q_ASSERT(clip);
 
-    // Ensure we have enough storage to hold the evaluations
+    // Ensure we have enough storage to hold the evaluations. This is a no-op
+    // when the caller reuses the buffer from a previous evaluation.
     channelResults.resize(clip->channelCount());
 
     // Iterate over channels and evaluate the fcurves
@@ -209,7 +216,6 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
         for (const auto &channelComponent : qAsConst(channel.channelComponents))
             channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime);
     }
-    return channelResults;
 }
 
 ClipResults evaluateClipAtPhase(AnimationClip *clip, float phase)
@@ -219,6 +225,12 @@ ClipResults evaluateClipAtPhase(AnimationClip *clip, float phase)
     return evaluateClipAtLocalTime(clip, localTime);
 }
 
+void evaluateClipAtPhase(AnimationClip *clip, float phase, ClipResults &channelResults)
+{
+    const double localTime = phase * clip->duration();
+    evaluateClipAtLocalTime(clip, localTime, channelResults);
+}
+
 QVector<Qt3DCore::QSceneChangePtr> preparePropertyChanges(Qt3DCore::QNodeId animatorId,
                                                           const QVector<MappingData> &mappingDataVec,
                                                           const QVector<float> &channelResults,
@@ -485,6 +497,32 @@ QVector<Qt3DCore::QNodeId> gatherValueNodesToEvaluate(Handler *handler,
     return clipIds;
 }
 
+QVector<Qt3DCore::QNodeId> gatherBlendNodesToEvaluate(Handler *handler,
+                                                      Qt3DCore::QNodeId blendTreeRootId)
+{
+    Q_ASSERT(handler);
+    Q_ASSERT(blendTreeRootId.isNull() == false);
+
+    ClipBlendNodeManager *nodeManager = handler->clipBlendNodeManager();
+
+    // Visit the tree in a post-order manner and collect the interior nodes
+    // that take part in the current evaluation. The resulting order is such
+    // that every node appears after all of its dependencies.
+    QVector<Qt3DCore::QNodeId> blendNodeIds;
+    ClipBlendNodeVisitor visitor(nodeManager,
+                                 ClipBlendNodeVisitor::PostOrder,
+                                 ClipBlendNodeVisitor::VisitOnlyDependencies);
+
+    auto func = [&blendNodeIds] (ClipBlendNode *blendNode) {
+        if (blendNode->blendType() != ClipBlendNode::ValueType
+                && !blendNodeIds.contains(blendNode->peerId()))
+            blendNodeIds.push_back(blendNode->peerId());
+    };
+    visitor.traverse(blendTreeRootId, func);
+
+    return blendNodeIds;
+}
+
 ComponentIndices generateClipFormatIndices(const QVector<ChannelNameAndType> &targetChannels,
                                            const QVector<ComponentIndices> &targetIndices,
                                            const AnimationClip *clip)
@@ -533,10 +571,19 @@ ComponentIndices generateClipFormatIndices(const QVector<ChannelNameAndType> &ta
 
 ClipResults formatClipResults(const ClipResults &rawClipResults,
                               const ComponentIndices &format)
+{
+    ClipResults formattedClipResults;
+    formatClipResults(rawClipResults, format, formattedClipResults);
+    return formattedClipResults;
+}
+
+void formatClipResults(const ClipResults &rawClipResults,
+                       const ComponentIndices &format,
+                       ClipResults &formattedClipResults)
 {
     // Resize the output to match the number of indices
     const int elementCount = format.size();
-    ClipResults formattedClipResults(elementCount);
+    formattedClipResults.resize(elementCount);
 
     // Perform a gather operation to format the data
     // TODO: For large numbers of components do this in parallel with
@@ -545,8 +592,6 @@ ClipResults formatClipResults(const ClipResults &rawClipResults,
         const float value = format[i] != -1 ? rawClipResults[format[i]] : 0.0f;
         formattedClipResults[i] = value;
     }
-
-    return formattedClipResults;
 }
 
 ClipResults evaluateBlendTree(Handler *handler,
@@ -585,6 +630,31 @@ ClipResults evaluateBlendTree(Handler *handler,
     return blendTreeRootNode->clipResults(animatorId);
 }
 
+ClipResults evaluateBlendTree(Handler *handler,
+                              BlendedClipAnimator *animator,
+                              Qt3DCore::QNodeId blendTreeRootId,
+                              const QVector<Qt3DCore::QNodeId> &blendNodeIds)
+{
+    Q_ASSERT(handler);
+    Q_ASSERT(blendTreeRootId.isNull() == false);
+    const Qt3DCore::QNodeId animatorId = animator->peerId();
+    ClipBlendNodeManager *nodeManager = handler->clipBlendNodeManager();
+
+    // The interior nodes are already sorted such that each node comes after
+    // its dependencies (see gatherBlendNodesToEvaluate()), so we can blend
+    // them in sequence without having to traverse the tree again.
+
+    for (const auto blendNodeId : blendNodeIds) {
+        ClipBlendNode *blendNode = nodeManager->lookupNode(blendNodeId);
+        Q_ASSERT(blendNode);
+        blendNode->blend(animatorId);
+    }
+
+    ClipBlendNode *blendTreeRootNode = nodeManager->lookupNode(blendTreeRootId);
+    Q_ASSERT(blendTreeRootNode);
+    return blendTreeRootNode->clipResults(animatorId);
+}
+
 } // Animation
 } // Qt3DAnimation
 
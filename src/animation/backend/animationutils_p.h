@@ -146,10 +146,20 @@ Q_AUTOTEST_EXPORT
 ClipResults evaluateClipAtLocalTime(AnimationClip *clip,
                                     float localTime);
 
+Q_AUTOTEST_EXPORT
+void evaluateClipAtLocalTime(AnimationClip *clip,
+                             float localTime,
+                             ClipResults &channelResults);
+
 Q_AUTOTEST_EXPORT
 ClipResults evaluateClipAtPhase(AnimationClip *clip,
                                 float phase);
 
+Q_AUTOTEST_EXPORT
+void evaluateClipAtPhase(AnimationClip *clip,
+                         float phase,
+                         ClipResults &channelResults);
+
 Q_AUTOTEST_EXPORT
 QVector<Qt3DCore::QSceneChangePtr> preparePropertyChanges(Qt3DCore::QNodeId animatorId,
                                                           const QVector<MappingData> &mappingData,
@@ -187,6 +197,10 @@ Q_AUTOTEST_EXPORT
 QVector<Qt3DCore::QNodeId> gatherValueNodesToEvaluate(Handler *handler,
                                                       Qt3DCore::QNodeId blendTreeRootId);
 
+Q_AUTOTEST_EXPORT
+QVector<Qt3DCore::QNodeId> gatherBlendNodesToEvaluate(Handler *handler,
+                                                      Qt3DCore::QNodeId blendTreeRootId);
+
 Q_AUTOTEST_EXPORT
 ComponentIndices generateClipFormatIndices(const QVector<ChannelNameAndType> &targetChannels,
                                            const QVector<ComponentIndices> &targetIndices,
@@ -196,11 +210,22 @@ Q_AUTOTEST_EXPORT
 ClipResults formatClipResults(const ClipResults &rawClipResults,
                               const ComponentIndices &format);
 
+Q_AUTOTEST_EXPORT
+void formatClipResults(const ClipResults &rawClipResults,
+                       const ComponentIndices &format,
+                       ClipResults &formattedClipResults);
+
 Q_AUTOTEST_EXPORT
 ClipResults evaluateBlendTree(Handler *handler,
                               BlendedClipAnimator *animator,
                               Qt3DCore::QNodeId blendNodeId);
 
+Q_AUTOTEST_EXPORT
+ClipResults evaluateBlendTree(Handler *handler,
+                              BlendedClipAnimator *animator,
+                              Qt3DCore::QNodeId blendTreeRootId,
+                              const QVector<Qt3DCore::QNodeId> &blendNodeIds);
+
 } // Animation
 } // Qt3DAnimation
 
@@ -50,6 +50,7 @@ BlendedClipAnimator::BlendedClipAnimator()
     , m_startGlobalTime(0)
     , m_currentLoop(0)
     , m_loops(1)
+    , m_dependencyRevision(-1)
 {
 }
 
@@ -74,11 +75,15 @@ void BlendedClipAnimator::cleanup()
     m_startGlobalTime = 0;
     m_currentLoop = 0;
     m_loops = 1;
+    m_valueNodeIdsToEvaluate.clear();
+    m_blendNodeIdsToEvaluate.clear();
+    m_dependencyRevision = -1;
 }
 
 void BlendedClipAnimator::setBlendTreeRootId(Qt3DCore::QNodeId blendTreeId)
 {
     m_blendTreeRootId = blendTreeId;
+    invalidateEvaluationOrder();
     setDirty(Handler::BlendedClipAnimatorDirty);
 }
 
@@ -94,6 +99,15 @@ void BlendedClipAnimator::setRunning(bool running)
     setDirty(Handler::BlendedClipAnimatorDirty);
 }
 
+void BlendedClipAnimator::setEvaluationOrder(const QVector<Qt3DCore::QNodeId> &valueNodeIds,
+                                             const QVector<Qt3DCore::QNodeId> &blendNodeIds,
+                                             int dependencyRevision)
+{
+    m_valueNodeIdsToEvaluate = valueNodeIds;
+    m_blendNodeIdsToEvaluate = blendNodeIds;
+    m_dependencyRevision = dependencyRevision;
+}
+
 void BlendedClipAnimator::sendPropertyChanges(const QVector<Qt3DCore::QSceneChangePtr> &changes)
 {
     for (const Qt3DCore::QSceneChangePtr &change : changes)
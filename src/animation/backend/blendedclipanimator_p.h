@@ -91,6 +91,16 @@ public:
 
     void sendPropertyChanges(const QVector<Qt3DCore::QSceneChangePtr> &changes);
 
+    // Cached sets of blend tree nodes to evaluate, valid as long as the
+    // dependency revision of the ClipBlendNodeManager is unchanged
+    bool isEvaluationOrderValid(int dependencyRevision) const { return m_dependencyRevision == dependencyRevision; }
+    void setEvaluationOrder(const QVector<Qt3DCore::QNodeId> &valueNodeIds,
+                            const QVector<Qt3DCore::QNodeId> &blendNodeIds,
+                            int dependencyRevision);
+    void invalidateEvaluationOrder() { m_dependencyRevision = -1; }
+    QVector<Qt3DCore::QNodeId> valueNodeIdsToEvaluate() const { return m_valueNodeIdsToEvaluate; }
+    QVector<Qt3DCore::QNodeId> blendNodeIdsToEvaluate() const { return m_blendNodeIdsToEvaluate; }
+
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
     Qt3DCore::QNodeId m_blendTreeRootId;
@@ -102,6 +112,10 @@ private:
     int m_loops;
 
     QVector<MappingData> m_mappingData;
+
+    QVector<Qt3DCore::QNodeId> m_valueNodeIdsToEvaluate;
+    QVector<Qt3DCore::QNodeId> m_blendNodeIdsToEvaluate;
+    int m_dependencyRevision;
 };
 
 } // namespace Animation
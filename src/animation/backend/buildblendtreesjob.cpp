@@ -83,27 +83,41 @@ void BuildBlendTreesJob::run()
         QVector<ComponentIndices> channelComponentIndices
                 = assignChannelComponentIndices(channelNamesAndTypes);
 
-        // Find the leaf value nodes of the blend tree and for each of them
-        // create a set of format indices that can later be used to map the
+        // Visit every node of the blend tree that may take part in an evaluation,
+        // not only the current dependencies, so that changes of blend factors
+        // selecting other nodes do not require rebuilding the tree. For the value
+        // nodes create a set of format indices that can later be used to map the
         // raw ClipResults resulting from evaluating an animation clip to the
-        // layout used by the blend tree for this animator
-        const QVector<Qt3DCore::QNodeId> valueNodeIds
-                = gatherValueNodesToEvaluate(m_handler, blendClipAnimator->blendTreeRootId());
-        for (const auto valueNodeId : valueNodeIds) {
-            ClipBlendValue *valueNode
-                    = static_cast<ClipBlendValue *>(m_handler->clipBlendNodeManager()->lookupNode(valueNodeId));
-            Q_ASSERT(valueNode);
+        // layout used by the blend tree for this animator. For all nodes
+        // preallocate the storage for their results so that evaluating the tree
+        // each frame does not need to allocate.
+        int resultCount = 0;
+        for (const ComponentIndices &componentIndices : qAsConst(channelComponentIndices))
+            resultCount += componentIndices.size();
 
-            const Qt3DCore::QNodeId clipId = valueNode->clipId();
-            const AnimationClip *clip = m_handler->animationClipLoaderManager()->lookupResource(clipId);
-            Q_ASSERT(clip);
+        const Qt3DCore::QNodeId animatorId = blendClipAnimator->peerId();
+        ClipBlendNodeVisitor visitor(m_handler->clipBlendNodeManager(),
+                                     ClipBlendNodeVisitor::PostOrder,
+                                     ClipBlendNodeVisitor::VisitAllNodes);
+        auto func = [&] (ClipBlendNode *blendNode) {
+            if (blendNode->blendType() == ClipBlendNode::ValueType) {
+                ClipBlendValue *valueNode = static_cast<ClipBlendValue *>(blendNode);
+                const Qt3DCore::QNodeId clipId = valueNode->clipId();
+                const AnimationClip *clip = m_handler->animationClipLoaderManager()->lookupResource(clipId);
+                if (clip != nullptr) {
+                    const ComponentIndices formatIndices
+                            = generateClipFormatIndices(channelNamesAndTypes,
+                                                        channelComponentIndices,
+                                                        clip);
+                    valueNode->setFormatIndices(animatorId, formatIndices);
+                }
+            }
+            blendNode->clipResultsBuffer(animatorId).resize(resultCount);
+        };
+        visitor.traverse(blendClipAnimator->blendTreeRootId(), func);
 
-            const ComponentIndices formatIndices
-                    = generateClipFormatIndices(channelNamesAndTypes,
-                                                channelComponentIndices,
-                                                clip);
-            valueNode->setFormatIndices(blendClipAnimator->peerId(), formatIndices);
-        }
+        // Force the evaluation job to gather the nodes to evaluate again
+        blendClipAnimator->invalidateEvaluationOrder();
 
         // Finally, build the mapping data vector for this blended clip animator. This
         // gets used during the final stage of evaluation when sending the property changes
@@ -93,6 +93,40 @@ ClipResults ClipBlendNode::clipResults(Qt3DCore::QNodeId animatorId) const
     return ClipResults();
 }
 
+/*!
+    \internal
+
+    Returns a reference to the storage used for the results of evaluating
+    this node for the animator with id \a animatorId, creating it if needed.
+    The BuildBlendTreesJob preallocates these buffers when the blend tree is
+    built so that evaluating the tree each frame can write into them in place
+    without allocating.
+*/
+ClipResults &ClipBlendNode::clipResultsBuffer(Qt3DCore::QNodeId animatorId)
+{
+    const int animatorIndex = m_animatorIds.indexOf(animatorId);
+    if (animatorIndex != -1)
+        return m_clipResults[animatorIndex];
+    m_animatorIds.push_back(animatorId);
+    m_clipResults.push_back(ClipResults());
+    return m_clipResults.last();
+}
+
+/*!
+    \internal
+
+    To be called by subclasses after handling a property change. If the
+    current dependencies differ from \a previousDependencyIds, the manager is
+    told so that animators using this node rebuild their cached evaluation
+    order. Changes that do not alter the dependencies, such as a blend factor
+    moving within the same pair of clips, keep the cache valid.
+*/
+void ClipBlendNode::notifyIfDependenciesChanged(const QVector<Qt3DCore::QNodeId> &previousDependencyIds)
+{
+    if (m_manager != nullptr && currentDependencyIds() != previousDependencyIds)
+        m_manager->markDependenciesChanged();
+}
+
 /*!
     \fn QVector<Qt3DCore::QNodeId> ClipBlendNode::currentDependencyIds() const
     \internal
@@ -132,8 +166,8 @@ ClipResults ClipBlendNode::clipResults(Qt3DCore::QNodeId animatorId) const
     Fetches the ClipResults from the nodes listed in the dependencyIds
     and passes them to the doBlend() virtual function which should be
     implemented in subclasses to perform the actual blend operation.
-    The results are then inserted into the clip results for this blend
-    node indexed by the \a animatorId.
+    The results are written directly into the clip results buffer of this
+    blend node indexed by the \a animatorId.
 */
 void ClipBlendNode::blend(Qt3DCore::QNodeId animatorId)
 {
@@ -149,9 +183,8 @@ void ClipBlendNode::blend(Qt3DCore::QNodeId animatorId)
     }
 
     // Ask the blend node to perform the actual blend operation on the data
-    // from the dependencies
-    ClipResults blendedResults = doBlend(blendData);
-    setClipResults(animatorId, blendedResults);
+    // from the dependencies, reusing the storage of the previous evaluation
+    doBlend(blendData, clipResultsBuffer(animatorId));
 }
 
 } // Animation
@@ -81,6 +81,7 @@ public:
 
     void setClipResults(Qt3DCore::QNodeId animatorId, const ClipResults &clipResults);
     ClipResults clipResults(Qt3DCore::QNodeId animatorId) const;
+    ClipResults &clipResultsBuffer(Qt3DCore::QNodeId animatorId);
 
     virtual QVector<Qt3DCore::QNodeId> allDependencyIds() const = 0;
     virtual QVector<Qt3DCore::QNodeId> currentDependencyIds() const = 0;
@@ -89,7 +90,8 @@ public:
 protected:
     explicit ClipBlendNode(BlendType blendType);
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_OVERRIDE;
-    virtual ClipResults doBlend(const QVector<ClipResults> &blendData) const = 0;
+    virtual void doBlend(const QVector<ClipResults> &blendData, ClipResults &blendResults) const = 0;
+    void notifyIfDependenciesChanged(const QVector<Qt3DCore::QNodeId> &previousDependencyIds);
 
 private:
     ClipBlendNodeManager *m_manager;
@@ -66,18 +66,20 @@ void ClipBlendValue::initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePt
 void ClipBlendValue::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
 {
     if (e->type() == Qt3DCore::PropertyUpdated) {
+        const QVector<Qt3DCore::QNodeId> previousDependencyIds = currentDependencyIds();
         Qt3DCore::QPropertyUpdatedChangePtr change = qSharedPointerCast<Qt3DCore::QPropertyUpdatedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("clip"))
             m_clipId = change->value().value<Qt3DCore::QNodeId>();
+        notifyIfDependenciesChanged(previousDependencyIds);
     }
 }
 
-ClipResults ClipBlendValue::doBlend(const QVector<ClipResults> &blendData) const
+void ClipBlendValue::doBlend(const QVector<ClipResults> &blendData, ClipResults &blendResults) const
 {
     // Should never be called for the value node
     Q_UNUSED(blendData);
+    Q_UNUSED(blendResults);
     Q_UNREACHABLE();
-    return ClipResults();
 }
 
 double ClipBlendValue::duration() const
@@ -82,7 +82,7 @@ public:
     ComponentIndices formatIndices(Qt3DCore::QNodeId animatorId);
 
 protected:
-    ClipResults doBlend(const QVector<ClipResults> &blendData) const Q_DECL_OVERRIDE;
+    void doBlend(const QVector<ClipResults> &blendData, ClipResults &blendResults) const Q_DECL_OVERRIDE;
 
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
@@ -58,16 +58,22 @@ EvaluateBlendClipAnimatorJob::EvaluateBlendClipAnimatorJob()
 void EvaluateBlendClipAnimatorJob::run()
 {
     // Find the set of clips that need to be evaluated by querying each node
-    // in the blend tree.
-    // TODO: We should be able to cache this for each blend animator and only
-    // update when a node indicates its dependencies have changed as a result
-    // of blend factors changing
+    // in the blend tree, together with the dependency ordered interior nodes
+    // to blend. These are cached on the animator and only gathered again when
+    // a node indicates its dependencies have changed, e.g. as a result of blend
+    // factors changing, or when the blend tree has been rebuilt.
     BlendedClipAnimator *blendedClipAnimator = m_handler->blendedClipAnimatorManager()->data(m_blendClipAnimatorHandle);
     Qt3DCore::QNodeId blendTreeRootId = blendedClipAnimator->blendTreeRootId();
-    const QVector<Qt3DCore::QNodeId> valueNodeIdsToEvaluate = gatherValueNodesToEvaluate(m_handler, blendTreeRootId);
+    ClipBlendNodeManager *blendNodeManager = m_handler->clipBlendNodeManager();
+    const int dependencyRevision = blendNodeManager->dependencyRevision();
+    if (!blendedClipAnimator->isEvaluationOrderValid(dependencyRevision)) {
+        blendedClipAnimator->setEvaluationOrder(gatherValueNodesToEvaluate(m_handler, blendTreeRootId),
+                                                gatherBlendNodesToEvaluate(m_handler, blendTreeRootId),
+                                                dependencyRevision);
+    }
+    const QVector<Qt3DCore::QNodeId> valueNodeIdsToEvaluate = blendedClipAnimator->valueNodeIdsToEvaluate();
 
     // Calculate the resulting duration of the blend tree based upon its current state
-    ClipBlendNodeManager *blendNodeManager = m_handler->clipBlendNodeManager();
     ClipBlendNode *blendTreeRootNode = blendNodeManager->lookupNode(blendTreeRootId);
     Q_ASSERT(blendTreeRootNode);
     const double duration = blendTreeRootNode->duration();
@@ -85,24 +91,26 @@ void EvaluateBlendClipAnimatorJob::run()
 
     // Iterate over the value nodes of the blend tree, evaluate the
     // contained animation clips at the current phase and store the results
-    // in the animator indexed by node.
+    // in the animator indexed by node. Both the raw and the formatted results
+    // are written into buffers kept from the previous frame.
     AnimationClipLoaderManager *clipLoaderManager = m_handler->animationClipLoaderManager();
+    const Qt3DCore::QNodeId animatorId = blendedClipAnimator->peerId();
     for (const auto valueNodeId : valueNodeIdsToEvaluate) {
         ClipBlendValue *valueNode = static_cast<ClipBlendValue *>(blendNodeManager->lookupNode(valueNodeId));
         Q_ASSERT(valueNode);
         AnimationClip *clip = clipLoaderManager->lookupResource(valueNode->clipId());
         Q_ASSERT(clip);
 
-        ClipResults rawClipResults = evaluateClipAtPhase(clip, phase);
+        evaluateClipAtPhase(clip, phase, m_rawClipResults);
 
         // Reformat the clip results into the layout used by this animator/blend tree
-        ComponentIndices format = valueNode->formatIndices(blendedClipAnimator->peerId());
-        ClipResults formattedClipResults = formatClipResults(rawClipResults, format);
-        valueNode->setClipResults(blendedClipAnimator->peerId(), formattedClipResults);
+        const ComponentIndices format = valueNode->formatIndices(animatorId);
+        formatClipResults(m_rawClipResults, format, valueNode->clipResultsBuffer(animatorId));
     }
 
     // Evaluate the blend tree
-    ClipResults blendedResults = evaluateBlendTree(m_handler, blendedClipAnimator, blendTreeRootId);
+    const ClipResults blendedResults = evaluateBlendTree(m_handler, blendedClipAnimator, blendTreeRootId,
+                                                         blendedClipAnimator->blendNodeIdsToEvaluate());
 
     const double localTime = phase * duration;
     const bool finalFrame = isFinalFrame(localTime, duration, currentLoop, animatorData.loopCount);
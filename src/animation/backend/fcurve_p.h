@@ -73,6 +73,7 @@ public:
     int keyframeCount() const { return m_localTimes.size(); }
     void appendKeyframe(float localTime, const Keyframe &keyframe);
     void clearKeyframes() { m_localTimes.clear(); m_keyframes.clear(); }
+    void reserveKeyframes(int count) { m_localTimes.reserve(count); m_keyframes.reserve(count); }
 
     const float &localTime(int index) const { return m_localTimes[index]; }
     float &localTime(int index) { return m_localTimes[index]; }
@@ -60,6 +60,7 @@ LerpClipBlend::~LerpClipBlend()
 void LerpClipBlend::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
 {
     if (e->type() == Qt3DCore::PropertyUpdated) {
+        const QVector<Qt3DCore::QNodeId> previousDependencyIds = currentDependencyIds();
         Qt3DCore::QPropertyUpdatedChangePtr change = qSharedPointerCast<Qt3DCore::QPropertyUpdatedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("blendFactor"))
             m_blendFactor = change->value().toFloat();
@@ -67,20 +68,19 @@ void LerpClipBlend::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
             m_startClipId = change->value().value<Qt3DCore::QNodeId>();
         else if (change->propertyName() == QByteArrayLiteral("endClip"))
             m_endClipId = change->value().value<Qt3DCore::QNodeId>();
+        notifyIfDependenciesChanged(previousDependencyIds);
     }
 }
 
-ClipResults LerpClipBlend::doBlend(const QVector<ClipResults> &blendData) const
+void LerpClipBlend::doBlend(const QVector<ClipResults> &blendData, ClipResults &blendResults) const
 {
     Q_ASSERT(blendData.size() == 2);
     Q_ASSERT(blendData[0].size() == blendData[1].size());
     const int elementCount = blendData.first().size();
-    ClipResults blendResults(elementCount);
+    blendResults.resize(elementCount);
 
     for (int i = 0; i < elementCount; ++i)
         blendResults[i] = (1.0f - m_blendFactor) * blendData[0][i] + (m_blendFactor * blendData[1][i]);
-
-    return blendResults;
 }
 
 void LerpClipBlend::initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change)
@@ -46,6 +46,7 @@ namespace Qt3DAnimation {
 namespace Animation {
 
 ClipBlendNodeManager::ClipBlendNodeManager()
+    : m_dependencyRevision(0)
 {
 }
 
@@ -62,6 +63,7 @@ bool ClipBlendNodeManager::containsNode(Qt3DCore::QNodeId id) const
 void ClipBlendNodeManager::appendNode(Qt3DCore::QNodeId id, ClipBlendNode *node)
 {
     m_nodes.insert(id, node);
+    markDependenciesChanged();
 }
 
 ClipBlendNode *ClipBlendNodeManager::lookupNode(Qt3DCore::QNodeId id) const
@@ -72,6 +74,7 @@ ClipBlendNode *ClipBlendNodeManager::lookupNode(Qt3DCore::QNodeId id) const
 void ClipBlendNodeManager::releaseNode(Qt3DCore::QNodeId id)
 {
     delete m_nodes.take(id);
+    markDependenciesChanged();
 }
 
 } // namespace Animation
@@ -128,8 +128,14 @@ public:
     ClipBlendNode *lookupNode(Qt3DCore::QNodeId id) const;
     void releaseNode(Qt3DCore::QNodeId id);
 
+    // Incremented whenever the set of nodes or the current dependencies of a
+    // node change, so that blended animators can cache their evaluation order
+    int dependencyRevision() const { return m_dependencyRevision; }
+    void markDependenciesChanged() { ++m_dependencyRevision; }
+
 private:
     QHash<Qt3DCore::QNodeId, ClipBlendNode *> m_nodes;
+    int m_dependencyRevision;
 };
 
 } // namespace Animation
@@ -74,6 +74,14 @@ void QAnimationClipLoaderPrivate::setStatus(QAnimationClipLoader::Status status)
     \inherits QAbstractAnimationClip
     \inmodule Qt3DAnimation
     \brief Enables loading key frame animation data from a file
+
+    The source may either be a JSON animation file or a precompiled binary
+    animation clip container as produced by the \c qanimationclip tool.
+    Binary containers are memory mapped and only the requested animation is
+    read. Files may contain several animations; a specific one can be
+    selected by giving its name as the fragment of the source URL, for
+    example \c{qrc:/animations.qac#Walk}. Without a fragment the first
+    animation of the file is loaded.
 */
 
 QAnimationClipLoader::QAnimationClipLoader(Qt3DCore::QNode *parent)
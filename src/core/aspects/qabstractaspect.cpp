@@ -50,6 +50,8 @@
 #include <Qt3DCore/private/qnodevisitor_p.h>
 #include <Qt3DCore/private/qscene_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 namespace Qt3DCore {
@@ -235,6 +237,9 @@ QBackendNode *QAbstractAspectPrivate::createBackendNode(const QNodeCreatedChange
 
 void QAbstractAspectPrivate::clearBackendNode(const QNodeDestroyedChangePtr &change) const
 {
+    // Ids of nodes whose mapper can destroy them in a batch, grouped by mapper
+    QVector<QPair<const QBackendNodeBatchDestroyer *, QVector<QNodeId>>> batches;
+
     // Each QNodeDestroyedChange may contain info about a whole sub-tree of nodes that
     // are being destroyed. Iterate over them and process each in turn
     for (const auto &idAndType : change->subtreeIdsAndTypes()) {
@@ -256,12 +261,29 @@ void QAbstractAspectPrivate::clearBackendNode(const QNodeDestroyedChangePtr &cha
             qCDebug(Nodes) << q_func()->objectName() << "Deleting backend node for node id"
                            << idAndType.id << "of type" << idAndType.type->className();
             QBackendNodePrivate *backendPriv = QBackendNodePrivate::get(backend);
-            m_arbiter->unregisterObserver(backendPriv, backend->peerId());
-            if (backend->mode() == QBackendNode::ReadWrite)
-                m_arbiter->scene()->removeObservable(backendPriv, backend->peerId());
-            backendNodeMapper->destroy(idAndType.id);
+            if (m_arbiter != nullptr) { // Unit tests may not have the arbiter registered
+                m_arbiter->unregisterObserver(backendPriv, backend->peerId());
+                if (backend->mode() == QBackendNode::ReadWrite)
+                    m_arbiter->scene()->removeObservable(backendPriv, backend->peerId());
+            }
+
+            const QBackendNodeBatchDestroyer *batchDestroyer = dynamic_cast<const QBackendNodeBatchDestroyer *>(backendNodeMapper.data());
+            if (batchDestroyer == nullptr) {
+                backendNodeMapper->destroy(idAndType.id);
+                continue;
+            }
+            auto batchIt = std::find_if(batches.begin(), batches.end(),
+                                        [batchDestroyer] (const QPair<const QBackendNodeBatchDestroyer *, QVector<QNodeId>> &batch) {
+                return batch.first == batchDestroyer;
+            });
+            if (batchIt == batches.end())
+                batchIt = batches.insert(batches.end(), qMakePair(batchDestroyer, QVector<QNodeId>()));
+            batchIt->second.push_back(idAndType.id);
         }
     }
+
+    for (const auto &batch : qAsConst(batches))
+        batch.first->destroy(batch.second);
 }
 
 void QAbstractAspectPrivate::setRootAndCreateNodes(QEntity *rootObject, const QVector<QNodeCreatedChangeBasePtr> &changes)
@@ -55,6 +55,10 @@ QBackendNodeMapper::~QBackendNodeMapper()
 {
 }
 
+QBackendNodeBatchDestroyer::~QBackendNodeBatchDestroyer()
+{
+}
+
 QBackendNodePrivate::QBackendNodePrivate(QBackendNode::Mode mode)
     : q_ptr(nullptr)
     , m_mode(mode)
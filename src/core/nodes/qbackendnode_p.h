@@ -53,6 +53,7 @@
 
 #include <Qt3DCore/qbackendnode.h>
 #include <Qt3DCore/qnodeid.h>
+#include <QtCore/QVector>
 
 #include <Qt3DCore/private/qlockableobserverinterface_p.h>
 #include <Qt3DCore/private/qobservableinterface_p.h>
@@ -89,6 +90,16 @@ private:
     Q_DISABLE_COPY(QBackendNodePrivate)
 };
 
+// Backend node mappers can also implement this interface to destroy the
+// backend nodes of a destroyed subtree with a single call instead of one
+// QBackendNodeMapper::destroy() call per node
+class QT3DCORE_PRIVATE_EXPORT QBackendNodeBatchDestroyer
+{
+public:
+    virtual ~QBackendNodeBatchDestroyer();
+    virtual void destroy(const QVector<QNodeId> &ids) const = 0;
+};
+
 } // Qt3D
 
 QT_END_NAMESPACE
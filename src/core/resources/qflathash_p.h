@@ -0,0 +1,281 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QT3DCORE_QFLATHASH_P_H
+#define QT3DCORE_QFLATHASH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+#include <QtCore/QtGlobal>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DCore {
+
+// Hash map using open addressing with linear probing. Keys and values are
+// stored inline in a single array, a lookup therefore usually touches a
+// single cache line instead of following the node chain of a QHash.
+// Removal shifts back the following entries, so no tombstones accumulate.
+//
+// Key and T must be default constructible and copyable, Key needs a qHash()
+// overload. References returned by operator[] are invalidated by any
+// insertion.
+template <typename Key, typename T>
+class QFlatHash
+{
+    struct Bucket
+    {
+        Bucket() : key(), value(), used(false) {}
+
+        Key key;
+        T value;
+        bool used;
+    };
+
+public:
+    class const_iterator
+    {
+    public:
+        const_iterator() : m_buckets(nullptr), m_index(0), m_end(0) {}
+
+        const Key &key() const { return m_buckets[m_index].key; }
+        const T &value() const { return m_buckets[m_index].value; }
+        const T &operator*() const { return value(); }
+
+        const_iterator &operator++()
+        {
+            ++m_index;
+            skipUnused();
+            return *this;
+        }
+
+        bool operator==(const const_iterator &other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator &other) const { return m_index != other.m_index; }
+
+    private:
+        friend class QFlatHash;
+
+        const_iterator(const Bucket *buckets, int index, int end)
+            : m_buckets(buckets), m_index(index), m_end(end)
+        {
+            skipUnused();
+        }
+
+        void skipUnused()
+        {
+            while (m_index < m_end && !m_buckets[m_index].used)
+                ++m_index;
+        }
+
+        const Bucket *m_buckets;
+        int m_index;
+        int m_end;
+    };
+
+    QFlatHash()
+        : m_size(0)
+        , m_shift(32)
+    {}
+
+    int size() const { return m_size; }
+    bool isEmpty() const { return m_size == 0; }
+    int capacity() const { return m_buckets.size(); }
+
+    bool contains(const Key &key) const
+    {
+        return findBucket(key) >= 0;
+    }
+
+    T value(const Key &key, const T &defaultValue = T()) const
+    {
+        const int i = findBucket(key);
+        return i >= 0 ? m_buckets.at(i).value : defaultValue;
+    }
+
+    T &operator[](const Key &key)
+    {
+        int i = findBucket(key);
+        if (i >= 0)
+            return m_buckets[i].value;
+
+        // Keep the load factor below 3/4
+        if ((m_size + 1) * 4 > m_buckets.size() * 3)
+            rehash(qMax(int(MinimumCapacity), m_buckets.size() * 2));
+
+        i = insertionBucket(key);
+        Bucket &bucket = m_buckets[i];
+        bucket.key = key;
+        bucket.used = true;
+        ++m_size;
+        return bucket.value;
+    }
+
+    void insert(const Key &key, const T &value)
+    {
+        (*this)[key] = value;
+    }
+
+    T take(const Key &key)
+    {
+        const int i = findBucket(key);
+        if (i < 0)
+            return T();
+        const T value = m_buckets.at(i).value;
+        eraseBucket(i);
+        return value;
+    }
+
+    bool remove(const Key &key)
+    {
+        const int i = findBucket(key);
+        if (i < 0)
+            return false;
+        eraseBucket(i);
+        return true;
+    }
+
+    void clear()
+    {
+        m_buckets.clear();
+        m_size = 0;
+        m_shift = 32;
+    }
+
+    void reserve(int size)
+    {
+        int capacity = MinimumCapacity;
+        while (capacity * 3 < size * 4)
+            capacity *= 2;
+        if (capacity > m_buckets.size())
+            rehash(capacity);
+    }
+
+    const_iterator cbegin() const { return const_iterator(m_buckets.constData(), 0, m_buckets.size()); }
+    const_iterator cend() const { return const_iterator(m_buckets.constData(), m_buckets.size(), m_buckets.size()); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+
+private:
+    enum {
+        MinimumCapacity = 16
+    };
+
+    int idealBucket(const Key &key) const
+    {
+        // Fibonacci hashing: the top bits of the product depend on all the
+        // bits of the hash, capacity is always a power of two
+        const uint h = uint(qHash(key)) * 2654435769U;
+        return int(h >> m_shift);
+    }
+
+    int findBucket(const Key &key) const
+    {
+        if (m_size == 0)
+            return -1;
+        const int mask = m_buckets.size() - 1;
+        for (int i = idealBucket(key); ; i = (i + 1) & mask) {
+            const Bucket &bucket = m_buckets.at(i);
+            if (!bucket.used)
+                return -1;
+            if (bucket.key == key)
+                return i;
+        }
+    }
+
+    int insertionBucket(const Key &key) const
+    {
+        const int mask = m_buckets.size() - 1;
+        int i = idealBucket(key);
+        while (m_buckets.at(i).used)
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    void eraseBucket(int i)
+    {
+        // Shift back the entries of the probe sequence following i so that
+        // lookups never stop early at the freed bucket
+        const int mask = m_buckets.size() - 1;
+        for (int j = (i + 1) & mask; m_buckets.at(j).used; j = (j + 1) & mask) {
+            const int k = idealBucket(m_buckets.at(j).key);
+            const bool staysInPlace = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+            if (staysInPlace)
+                continue;
+            m_buckets[i] = m_buckets.at(j);
+            i = j;
+        }
+        m_buckets[i] = Bucket();
+        --m_size;
+    }
+
+    void rehash(int capacity)
+    {
+        Q_ASSERT((capacity & (capacity - 1)) == 0);
+        QVector<Bucket> buckets(capacity);
+        m_buckets.swap(buckets);
+        m_shift = 32;
+        for (int c = capacity; c > 1; c >>= 1)
+            --m_shift;
+        for (const Bucket &bucket : qAsConst(buckets)) {
+            if (bucket.used)
+                m_buckets[insertionBucket(bucket.key)] = bucket;
+        }
+    }
+
+    QVector<Bucket> m_buckets;
+    int m_size;
+    int m_shift;
+};
+
+} // Qt3DCore
+
+QT_END_NAMESPACE
+
+#endif // QT3DCORE_QFLATHASH_P_H
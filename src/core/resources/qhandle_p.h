@@ -54,6 +54,8 @@
 #include <Qt3DCore/qt3dcore_global.h>
 #include <QtCore/QDebug>
 
+#include <type_traits>
+
 class tst_Handle;  // needed for friend class declaration below
 
 QT_BEGIN_NAMESPACE
@@ -67,6 +69,11 @@ template <typename T, uint INDEXBITS = 16>
 class QHandle
 {
 public:
+    // Handles with up to 24 index bits are packed in 32 bits. Larger index
+    // spaces (up to 32 bits) use a 64 bit handle so that enough bits remain
+    // for the counter used to detect stale handles.
+    typedef typename std::conditional<(INDEXBITS > 24), quint64, quint32>::type HandleType;
+
     QHandle()
         : m_handle(0)
     {}
@@ -74,24 +81,28 @@ public:
 
     quint32 index() const { return d.m_index; }
     quint32 counter() const { return d.m_counter; }
-    quint32 handle() const { return m_handle; }
+    HandleType handle() const { return m_handle; }
     bool isNull() const { return !m_handle; }
 
-    operator quint32() const { return m_handle; }
+    operator HandleType() const { return m_handle; }
 
     static quint32 maxIndex() { return MaxIndex; }
     static quint32 maxCounter() { return MaxCounter; }
 
 
 private:
+    Q_STATIC_ASSERT_X(INDEXBITS <= 32, "QHandle supports at most 32 index bits");
+
     enum {
         // Sizes to use for bit fields
         IndexBits = INDEXBITS,
-        CounterBits = 32 - INDEXBITS - 2, // We use 2 bits for book-keeping in QHandleManager
+        CounterBits = int(sizeof(HandleType)) * 8 - INDEXBITS - 2 // We use 2 bits for book-keeping in QHandleManager
+    };
 
+    enum : quint64 {
         // Sizes to compare against for asserting dereferences
-        MaxIndex = (1 << IndexBits) - 1,
-        MaxCounter = (1 << CounterBits) - 1
+        MaxIndex = (Q_UINT64_C(1) << IndexBits) - 1,
+        MaxCounter = (Q_UINT64_C(1) << CounterBits) - 1
     };
 
     QHandle(quint32 i, quint32 count)
@@ -108,13 +119,13 @@ private:
     friend class ::tst_Handle;
 
     struct Data {
-        quint32 m_index : IndexBits;
-        quint32 m_counter : CounterBits;
-        quint32 m_unused : 2;
+        HandleType m_index : IndexBits;
+        HandleType m_counter : CounterBits;
+        HandleType m_unused : 2;
     };
     union {
         Data d;
-        quint32 m_handle;
+        HandleType m_handle;
     };
 };
 
@@ -122,7 +133,8 @@ template <typename T, uint INDEXBITS>
 QDebug operator<<(QDebug dbg, const QHandle<T, INDEXBITS> &h)
 {
     QDebugStateSaver saver(dbg);
-    QString binNumber = QString::number(h.handle(), 2).rightJustified(32, QChar::fromLatin1('0'));
+    const int handleBits = int(sizeof(typename QHandle<T, INDEXBITS>::HandleType)) * 8;
+    QString binNumber = QString::number(h.handle(), 2).rightJustified(handleBits, QChar::fromLatin1('0'));
     dbg.nospace() << "index = " << h.index()
                   << " magic/counter = " << h.counter()
                   << " m_handle = " << h.handle()
@@ -134,7 +146,7 @@ QDebug operator<<(QDebug dbg, const QHandle<T, INDEXBITS> &h)
 
 template <typename T, uint I>
 class QTypeInfo<Qt3DCore::QHandle<T,I> > // simpler than fighting the Q_DECLARE_TYPEINFO macro
-    : public QTypeInfoMerger<Qt3DCore::QHandle<T,I>, quint32> {};
+    : public QTypeInfoMerger<Qt3DCore::QHandle<T,I>, typename Qt3DCore::QHandle<T,I>::HandleType> {};
 
 QT_END_NAMESPACE
 
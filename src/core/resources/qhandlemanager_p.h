@@ -57,6 +57,8 @@
 
 #include <Qt3DCore/private/qhandle_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 namespace Qt3DCore {
@@ -69,16 +71,27 @@ template <typename T, uint INDEXBITS = 16>
 QDebug operator<<(QDebug dbg, const QHandleManager<T, INDEXBITS> &manager);
 #endif
 
+// Entries are allocated one segment at a time and never move afterwards,
+// and neither does the table through which segments are reached. data()
+// and constData() can therefore be called from job threads for handles
+// acquired before the jobs started, while acquire() adds entries, as
+// happens with resource managers using the NonLockingPolicy. Calls to
+// acquire(), release() and reset() still have to be serialized.
 template <typename T, uint INDEXBITS = 16>
 class QHandleManager
 {
 public:
     QHandleManager()
-        : m_firstFreeEntry(0)
+        : m_firstFreeEntry(EndOfFreeList)
         , m_activeEntryCount(0)
-        , m_entries(1 << INDEXBITS)
+        , m_entryCount(0)
+    {
+        std::fill(m_directory, m_directory + DirectorySize, nullptr);
+    }
+
+    ~QHandleManager()
     {
-        reset();
+        deallocateSegments();
     }
 
     quint32 activeEntries() const { return m_activeEntryCount; }
@@ -96,7 +109,25 @@ private:
 
     friend QDebug operator<< <>(QDebug dbg, const QHandleManager<T, INDEXBITS> &manager);
 
-    template <typename U>
+    typedef QHandle<T, INDEXBITS> Handle;
+    typedef typename Handle::HandleType HandleType;
+
+    enum : quint64 {
+        // The index space is only backed by entries once used, one
+        // segment at a time, so that large index spaces cost nothing
+        // until they are needed
+        SegmentBits = INDEXBITS < 10 ? INDEXBITS : 10,
+        SegmentSize = Q_UINT64_C(1) << SegmentBits,
+        // Segments are reached through a directory of tables of segments,
+        // which keeps the fixed size directory small even for 32 index bits
+        DirectoryBits = (INDEXBITS - SegmentBits + 1) / 2,
+        DirectorySize = Q_UINT64_C(1) << DirectoryBits,
+        TableBits = INDEXBITS - SegmentBits - DirectoryBits,
+        TableSize = Q_UINT64_C(1) << TableBits,
+        // MaxIndex is never handed out and marks the end of the free list
+        EndOfFreeList = Handle::MaxIndex
+    };
+
     struct HandleEntry
     {
         HandleEntry()
@@ -104,77 +135,107 @@ private:
             , m_nextFreeIndex(0)
             , m_counter(0)
             , m_active(false)
-            , m_endOfFreeList(false)
         {}
 
-        explicit HandleEntry(quint32 nextFreeIndex)
-            : m_data(nullptr)
-            , m_nextFreeIndex(nextFreeIndex)
-            , m_counter(0)
-            , m_active(false)
-            , m_endOfFreeList(false)
-        {}
-
-        U *m_data;
-        unsigned int m_nextFreeIndex :  QHandle<U, INDEXBITS>::IndexBits;
-        unsigned int m_counter : QHandle<U, INDEXBITS>::CounterBits;
-        unsigned int m_active : 1;
-        unsigned int m_endOfFreeList : 1;
+        T *m_data;
+        HandleType m_nextFreeIndex : Handle::IndexBits;
+        HandleType m_counter : Handle::CounterBits;
+        HandleType m_active : 1;
     };
 
+    HandleEntry &entry(quint32 index)
+    {
+        const quint32 segment = index >> SegmentBits;
+        return m_directory[segment >> TableBits][segment & (TableSize - 1)][index & (SegmentSize - 1)];
+    }
+
+    const HandleEntry &entry(quint32 index) const
+    {
+        const quint32 segment = index >> SegmentBits;
+        return m_directory[segment >> TableBits][segment & (TableSize - 1)][index & (SegmentSize - 1)];
+    }
+
+    void allocateSegment(quint32 segment)
+    {
+        HandleEntry **&table = m_directory[segment >> TableBits];
+        if (!table)
+            table = new HandleEntry *[TableSize]();
+        table[segment & (TableSize - 1)] = new HandleEntry[SegmentSize];
+    }
+
+    void deallocateSegments()
+    {
+        for (HandleEntry **&table : m_directory) {
+            if (!table)
+                continue;
+            for (quint64 i = 0; i < TableSize; ++i)
+                delete [] table[i];
+            delete [] table;
+            table = nullptr;
+        }
+    }
+
     quint32 m_firstFreeEntry;
-    int m_activeEntryCount;
-    QVector<HandleEntry<T> > m_entries;
+    quint32 m_activeEntryCount;
+    quint32 m_entryCount;
+    HandleEntry **m_directory[DirectorySize];
 };
 
 template <typename T, uint INDEXBITS>
 void QHandleManager<T, INDEXBITS>::reset()
 {
     m_activeEntryCount = 0;
-    m_firstFreeEntry = 0;
-
-    for (int i = 0; i < QHandle<T, INDEXBITS >::MaxIndex; ++i)
-        m_entries[i] = HandleEntry<T>(i + 1);
-    m_entries[QHandle<T, INDEXBITS>::MaxIndex] = HandleEntry<T>();
-    m_entries[QHandle<T, INDEXBITS>::MaxIndex].m_endOfFreeList = true;
+    m_entryCount = 0;
+    m_firstFreeEntry = EndOfFreeList;
+    deallocateSegments();
 }
 
 template <typename T, uint INDEXBITS>
 QHandle<T, INDEXBITS> QHandleManager<T, INDEXBITS>::acquire(T *d)
 {
-    typedef QHandle<T, INDEXBITS> qHandle;
-    Q_ASSERT(m_activeEntryCount < qHandle::MaxIndex);
+    Q_ASSERT(m_activeEntryCount < Handle::MaxIndex);
+
+    quint32 newIndex = m_firstFreeEntry;
+    if (newIndex != EndOfFreeList) {
+        // Reuse the most recently released entry
+        m_firstFreeEntry = entry(newIndex).m_nextFreeIndex;
+    } else {
+        // Otherwise grow into the next never used entry
+        newIndex = m_entryCount++;
+        Q_ASSERT(newIndex < Handle::MaxIndex);
+        if ((newIndex & (SegmentSize - 1)) == 0)
+            allocateSegment(newIndex >> SegmentBits);
+    }
 
-    const quint32 newIndex = m_firstFreeEntry;
-    Q_ASSERT(newIndex < qHandle::MaxIndex);
-    Q_ASSERT(m_entries[newIndex].m_active == false);
-    Q_ASSERT(!m_entries[newIndex].m_endOfFreeList);
+    HandleEntry &e = entry(newIndex);
+    Q_ASSERT(e.m_active == false);
 
-    m_firstFreeEntry = m_entries[newIndex].m_nextFreeIndex;
-    m_entries[newIndex].m_nextFreeIndex = 0;
-    ++m_entries[newIndex].m_counter;
+    e.m_nextFreeIndex = 0;
+    ++e.m_counter;
     // Check if the counter is about to overflow and reset if necessary
-    if (m_entries[newIndex].m_counter == qHandle::MaxCounter)
-        m_entries[newIndex].m_counter = 0;
-    if (m_entries[newIndex].m_counter == 0)
-        m_entries[newIndex].m_counter = 1;
-    m_entries[newIndex].m_active = true;
-    m_entries[newIndex].m_data = d;
+    if (e.m_counter == Handle::MaxCounter)
+        e.m_counter = 0;
+    if (e.m_counter == 0)
+        e.m_counter = 1;
+    e.m_active = true;
+    e.m_data = d;
 
     ++m_activeEntryCount;
 
-    return qHandle(newIndex, m_entries[newIndex].m_counter);
+    return Handle(newIndex, e.m_counter);
 }
 
 template <typename T, uint INDEXBITS>
 void QHandleManager<T, INDEXBITS>::release(const QHandle<T, INDEXBITS> &handle)
 {
     const quint32 index = handle.index();
-    Q_ASSERT(m_entries[index].m_counter == handle.counter());
-    Q_ASSERT(m_entries[index].m_active == true);
+    Q_ASSERT(index < m_entryCount);
+    HandleEntry &e = entry(index);
+    Q_ASSERT(e.m_counter == handle.counter());
+    Q_ASSERT(e.m_active == true);
 
-    m_entries[index].m_nextFreeIndex = m_firstFreeEntry;
-    m_entries[index].m_active = false;
+    e.m_nextFreeIndex = m_firstFreeEntry;
+    e.m_active = false;
     m_firstFreeEntry = index;
 
     --m_activeEntryCount;
@@ -186,23 +247,26 @@ template <typename T, uint INDEXBITS>
 void QHandleManager<T, INDEXBITS>::update(const QHandle<T, INDEXBITS> &handle, T *d)
 {
     const quint32 index = handle.index();
-    Q_ASSERT(m_entries[index].m_counter == handle.counter());
-    Q_ASSERT(m_entries[index].m_active == true);
-    m_entries[index].m_data = d;
+    Q_ASSERT(index < m_entryCount);
+    HandleEntry &e = entry(index);
+    Q_ASSERT(e.m_counter == handle.counter());
+    Q_ASSERT(e.m_active == true);
+    e.m_data = d;
 }
 
 template <typename T, uint INDEXBITS>
 T *QHandleManager<T, INDEXBITS>::data(const QHandle<T, INDEXBITS> &handle, bool *ok)
 {
     const quint32 index = handle.index();
-    if (m_entries[index].m_counter != handle.counter() ||
-        m_entries[index].m_active == false) {
+    if (index >= m_entryCount ||
+        entry(index).m_counter != handle.counter() ||
+        entry(index).m_active == false) {
         if (ok)
             *ok = false;
         return nullptr;
     }
 
-    T *d = m_entries[index].m_data;
+    T *d = entry(index).m_data;
     if (ok)
         *ok = true;
     return d;
@@ -212,14 +276,15 @@ template <typename T, uint INDEXBITS>
 const T *QHandleManager<T, INDEXBITS>::constData(const QHandle<T, INDEXBITS> &handle, bool *ok) const
 {
     const quint32 index = handle.index();
-    if (m_entries[index].m_counter != handle.counter() ||
-        m_entries[index].m_active == false) {
+    if (index >= m_entryCount ||
+        entry(index).m_counter != handle.counter() ||
+        entry(index).m_active == false) {
         if (ok)
             *ok = false;
         return nullptr;
     }
 
-    const T *d = m_entries[index].m_data;
+    const T *d = entry(index).m_data;
     if (ok)
         *ok = true;
     return d;
@@ -232,13 +297,12 @@ QDebug operator<<(QDebug dbg, const QHandleManager<T, INDEXBITS> &manager)
     QDebugStateSaver saver(dbg);
     dbg << "First free entry =" << manager.m_firstFreeEntry << endl;
 
-    const auto end = manager.m_entries.cend();
     const auto max = manager.m_activeEntryCount;
-    auto i = 0;
-    for (auto it = manager.m_entries.cbegin(); it != end && i < max; ++it) {
-        const auto isActive = it->m_active;
-        if (isActive) {
-            dbg << *(it->m_data);
+    quint32 i = 0;
+    for (quint32 index = 0; index < manager.m_entryCount && i < max; ++index) {
+        const auto &e = manager.entry(index);
+        if (e.m_active) {
+            dbg << *(e.m_data);
             ++i;
         }
     }
@@ -251,8 +315,9 @@ template <typename T, uint INDEXBITS>
 QVector<T *> QHandleManager<T, INDEXBITS>::entries() const
 {
     QVector<T *> entries;
-    for (auto handle : qAsConst(m_entries))
-        entries.append(handle.m_data);
+    entries.reserve(m_entryCount);
+    for (quint32 index = 0; index < m_entryCount; ++index)
+        entries.append(entry(index).m_data);
     return entries;
 }
 
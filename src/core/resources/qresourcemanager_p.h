@@ -58,6 +58,7 @@
 #include <QtCore/QReadWriteLock>
 #include <QtCore/QtGlobal>
 
+#include <Qt3DCore/private/qflathash_p.h>
 #include <Qt3DCore/private/qhandle_p.h>
 #include <Qt3DCore/private/qhandlemanager_p.h>
 
@@ -220,13 +221,14 @@ struct Int2Type
     };
 };
 
+// The allocating policies store the resource of a handle at the index of
+// that handle, so resources are located and released without searching
 template <typename T, uint INDEXBITS>
 class ArrayAllocatingPolicy
 {
 public:
     ArrayAllocatingPolicy()
-        : m_numBuckets(0)
-        , m_numConstructed(0)
+        : m_numConstructed(0)
     {
         reset();
     }
@@ -236,19 +238,20 @@ public:
         deallocateBuckets();
     }
 
-    T* allocateResource()
+    T* allocateResource(quint32 idx)
     {
-        Q_ASSERT(!m_freeList.isEmpty());
-        int idx = m_freeList.takeLast();
-        int bucketIdx = idx / BucketSize;
-        int localIdx = idx % BucketSize;
-        Q_ASSERT(bucketIdx <= m_numBuckets);
-        if (bucketIdx == m_numBuckets) {
-            m_bucketDataPtrs[bucketIdx] = static_cast<T*>(malloc(sizeof(T) * BucketSize));
+        // The handle manager reuses released indices first and otherwise
+        // hands out new indices in increasing order
+        Q_ASSERT(idx < MaxSize);
+        const int bucketIdx = int(idx / BucketSize);
+        const int localIdx = int(idx % BucketSize);
+        Q_ASSERT(bucketIdx <= m_bucketDataPtrs.size());
+        if (bucketIdx == m_bucketDataPtrs.size()) {
+            T *bucket = static_cast<T*>(malloc(sizeof(T) * BucketSize));
             // ### memset is only needed as long as we also use this for primitive types (see FrameGraphManager)
             // ### remove once this is fixed, add a static_assert on T instead
-            memset((void*) m_bucketDataPtrs[bucketIdx], 0, sizeof(T) * BucketSize);
-            ++m_numBuckets;
+            memset((void*) bucket, 0, sizeof(T) * BucketSize);
+            m_bucketDataPtrs.push_back(bucket);
         }
 
         Q_ASSERT(idx <= m_numConstructed);
@@ -260,42 +263,25 @@ public:
         return m_bucketDataPtrs[bucketIdx] + localIdx;
     }
 
-    void releaseResource(T *r)
-    {
-        // search linearly over buckets to find the index of the resource
-        // and put it into the free list
-        for (int bucketIdx = 0; bucketIdx < m_numBuckets; ++bucketIdx) {
-            const T* firstItem = m_bucketDataPtrs[bucketIdx];
-            if (firstItem > r || r >= firstItem + BucketSize) {
-                // resource is not in this bucket when its pointer address
-                // is outside the address range spanned by the addresses of
-                // the first and last items in a bucket
-                continue;
-            }
-
-            // now we found the bucket we can reconstruct the global index
-            // and put it back into the free list
-            const int localIdx = static_cast<int>(r - firstItem);
-            const int idx = bucketIdx * BucketSize + localIdx;
-            m_freeList.append(idx);
-            performCleanup(r, Int2Type<QResourceInfo<T>::needsCleanup>());
-            break;
-        }
+    void releaseResource(quint32 idx)
+    {
+        Q_ASSERT(idx < m_numConstructed);
+        T *r = m_bucketDataPtrs[int(idx / BucketSize)] + idx % BucketSize;
+        performCleanup(r, Int2Type<QResourceInfo<T>::needsCleanup>());
     }
 
     void reset()
     {
+        // Buckets are allocated on demand, nothing is allocated for the
+        // whole index space up front
         deallocateBuckets();
-        m_freeList.resize(MaxSize);
-        for (int i = 0; i < MaxSize; i++)
-            m_freeList[i] = MaxSize - (i + 1);
     }
 
 private:
     Q_DISABLE_COPY(ArrayAllocatingPolicy)
 
-    enum {
-        MaxSize = (1 << INDEXBITS),
+    enum : quint64 {
+        MaxSize = (Q_UINT64_C(1) << INDEXBITS),
         // use at most 1024 items per bucket, or put all items into a single
         // bucket if MaxSize is small enough
         BucketSize = (1 << (INDEXBITS < 10 ? INDEXBITS : 10))
@@ -305,21 +291,18 @@ private:
     {
         while (m_numConstructed > 0) {
             --m_numConstructed;
-            int bucketIdx = m_numConstructed / BucketSize;
-            int localIdx = m_numConstructed % BucketSize;
+            int bucketIdx = int(m_numConstructed / BucketSize);
+            int localIdx = int(m_numConstructed % BucketSize);
             (m_bucketDataPtrs[bucketIdx] + localIdx)->~T();
         }
 
-        while (m_numBuckets > 0) {
-            --m_numBuckets;
-            free(m_bucketDataPtrs[m_numBuckets]);
-        }
+        for (T *bucket : qAsConst(m_bucketDataPtrs))
+            free(bucket);
+        m_bucketDataPtrs.clear();
     }
 
-    T* m_bucketDataPtrs[MaxSize / BucketSize];
-    QVector<int> m_freeList;
-    int m_numBuckets;
-    int m_numConstructed;
+    QVector<T*> m_bucketDataPtrs;
+    quint32 m_numConstructed;
 
     void performCleanup(T *r, Int2Type<true>)
     {
@@ -340,19 +323,16 @@ public:
         reset();
     }
 
-    T* allocateResource()
+    T* allocateResource(quint32 idx)
     {
-        Q_ASSERT(!m_freeList.isEmpty());
-        int idx = m_freeList.last();
-        m_freeList.pop_back();
+        Q_ASSERT(idx < MaxSize);
         return m_bucket.data() + idx;
     }
 
-    void releaseResource(T *r)
+    void releaseResource(quint32 idx)
     {
-        Q_ASSERT(m_bucket.data() <= r && r < m_bucket.data() + MaxSize);
-        int idx = r - m_bucket.data();
-        m_freeList.append(idx);
+        Q_ASSERT(idx < MaxSize);
+        T *r = m_bucket.data() + idx;
         performCleanup(r, Int2Type<QResourceInfo<T>::needsCleanup>());
         *r = T();
     }
@@ -361,9 +341,6 @@ public:
     {
         m_bucket.clear();
         m_bucket.resize(MaxSize);
-        m_freeList.resize(MaxSize);
-        for (int i = 0; i < MaxSize; i++)
-            m_freeList[i] = MaxSize - (i + 1);
     }
 
 private:
@@ -372,7 +349,6 @@ private:
     };
 
     QVector<T> m_bucket;
-    QVector<int> m_freeList;
 
     void performCleanup(T *r, Int2Type<true>)
     {
@@ -409,7 +385,7 @@ class QResourceManager
 public:
     QResourceManager() :
         AllocatingPolicy<ValueType, INDEXBITS>(),
-        m_maxSize((1 << INDEXBITS) - 1)
+        m_maxSize(QHandle<ValueType, INDEXBITS>::maxIndex())
     {
     }
 
@@ -419,9 +395,7 @@ public:
     QHandle<ValueType, INDEXBITS> acquire()
     {
         typename LockingPolicy<QResourceManager>::WriteLocker lock(this);
-        QHandle<ValueType, INDEXBITS> handle = m_handleManager.acquire(AllocatingPolicy<ValueType, INDEXBITS>::allocateResource());
-        m_activeHandles.push_back(handle);
-        return handle;
+        return acquireLocked();
     }
 
     ValueType* data(const QHandle<ValueType, INDEXBITS> &handle)
@@ -442,6 +416,7 @@ public:
         typename LockingPolicy<QResourceManager>::WriteLocker lock(this);
         m_handleManager.reset();
         m_activeHandles.clear();
+        m_activeHandlePositions.clear();
         AllocatingPolicy<ValueType, INDEXBITS>::reset();
     }
 
@@ -460,10 +435,8 @@ public:
             typename LockingPolicy<QResourceManager>::WriteLocker writeLock(this);
             // Test that the handle hasn't been set (in the meantime between the read unlock and the write lock)
             QHandle<ValueType, INDEXBITS> &handleToSet = m_keyToHandleMap[id];
-            if (handleToSet.isNull()) {
-                handleToSet = m_handleManager.acquire(AllocatingPolicy<ValueType, INDEXBITS>::allocateResource());
-                m_activeHandles.push_back(handleToSet);
-            }
+            if (handleToSet.isNull())
+                handleToSet = acquireLocked();
             return handleToSet;
         }
         return handle;
@@ -502,7 +475,18 @@ public:
             releaseLocked(handle);
     }
 
-    int maximumSize() const { return m_maxSize; }
+    // Releases all the resources at once, taking the lock only once
+    void releaseResources(const QVector<KeyType> &ids)
+    {
+        typename LockingPolicy<QResourceManager>::WriteLocker lock(this);
+        for (const KeyType &id : ids) {
+            QHandle<ValueType, INDEXBITS> handle = m_keyToHandleMap.take(id);
+            if (!handle.isNull())
+                releaseLocked(handle);
+        }
+    }
+
+    quint32 maximumSize() const { return m_maxSize; }
 
     int count() const Q_DECL_NOEXCEPT { return m_handleManager.activeEntries(); }
 
@@ -510,17 +494,40 @@ public:
 
 protected:
     QHandleManager<ValueType, INDEXBITS> m_handleManager;
-    QHash<KeyType, QHandle<ValueType, INDEXBITS> > m_keyToHandleMap;
+    QFlatHash<KeyType, QHandle<ValueType, INDEXBITS> > m_keyToHandleMap;
     QVector<QHandle<ValueType, INDEXBITS> > m_activeHandles;
-    const int m_maxSize;
+    // Position of each active handle in m_activeHandles, by handle index
+    QVector<int> m_activeHandlePositions;
+    const quint32 m_maxSize;
 
 private:
+    QHandle<ValueType, INDEXBITS> acquireLocked()
+    {
+        // Resources are stored at the index of their handle
+        const QHandle<ValueType, INDEXBITS> handle = m_handleManager.acquire(nullptr);
+        const quint32 index = handle.index();
+        m_handleManager.update(handle, AllocatingPolicy<ValueType, INDEXBITS>::allocateResource(index));
+
+        if (index >= quint32(m_activeHandlePositions.size()))
+            m_activeHandlePositions.resize(index + 1);
+        m_activeHandlePositions[index] = m_activeHandles.size();
+        m_activeHandles.push_back(handle);
+        return handle;
+    }
+
     void releaseLocked(const QHandle<ValueType, INDEXBITS> &handle)
     {
-        ValueType *val = m_handleManager.data(handle);
+        const quint32 index = handle.index();
         m_handleManager.release(handle);
-        m_activeHandles.removeOne(handle);
-        AllocatingPolicy<ValueType, INDEXBITS>::releaseResource(val);
+
+        // Swap with the last active handle and pop
+        const int position = m_activeHandlePositions.at(index);
+        const QHandle<ValueType, INDEXBITS> lastHandle = m_activeHandles.last();
+        m_activeHandles[position] = lastHandle;
+        m_activeHandlePositions[lastHandle.index()] = position;
+        m_activeHandles.removeLast();
+
+        AllocatingPolicy<ValueType, INDEXBITS>::releaseResource(index);
     }
 
     friend QDebug operator<< <>(QDebug dbg, const QResourceManager<ValueType, KeyType, INDEXBITS, AllocatingPolicy, LockingPolicy> &manager);
@@ -5,7 +5,8 @@ HEADERS += \
     $$PWD/qboundedcircularbuffer_p.h \
     $$PWD/qframeallocator_p.h \
     $$PWD/qframeallocator_p_p.h \
-    $$PWD/qhandle_p.h
+    $$PWD/qhandle_p.h \
+    $$PWD/qflathash_p.h
 
 SOURCES += \
     $$PWD/qresourcemanager.cpp \
@@ -56,6 +56,7 @@ namespace Input {
 Action::Action()
     : Qt3DCore::QBackendNode(ReadWrite)
     , m_actionTriggered(false)
+    , m_inputHandlesDirty(true)
 {
 }
 
@@ -64,13 +65,28 @@ void Action::initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &chang
     const auto typedChange = qSharedPointerCast<Qt3DCore::QNodeCreatedChange<QActionData>>(change);
     const auto &data = typedChange->data;
     m_inputs = data.inputIds;
+    m_inputHandlesDirty = true;
 }
 
 void Action::cleanup()
 {
     QBackendNode::setEnabled(false);
     m_inputs.clear();
+    m_actionInputHandles.clear();
+    m_inputSequenceHandles.clear();
+    m_inputChordHandles.clear();
     m_actionTriggered = false;
+    m_inputHandlesDirty = true;
+}
+
+void Action::setInputHandles(const QVector<HActionInput> &actionInputHandles,
+                             const QVector<HInputSequence> &inputSequenceHandles,
+                             const QVector<HInputChord> &inputChordHandles)
+{
+    m_actionInputHandles = actionInputHandles;
+    m_inputSequenceHandles = inputSequenceHandles;
+    m_inputChordHandles = inputChordHandles;
+    m_inputHandlesDirty = false;
 }
 
 void Action::setActionTriggered(bool actionTriggered)
@@ -94,6 +110,7 @@ void Action::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         const auto change = qSharedPointerCast<Qt3DCore::QPropertyNodeAddedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("input"))
             m_inputs.push_back(change->addedNodeId());
+        m_inputHandlesDirty = true;
         break;
     }
 
@@ -101,6 +118,8 @@ void Action::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         const auto change = qSharedPointerCast<Qt3DCore::QPropertyNodeRemovedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("input"))
             m_inputs.removeOne(change->removedNodeId());
+        m_inputHandlesDirty = true;
+        break;
     }
 
     default:
@@ -53,6 +53,7 @@
 
 #include <Qt3DCore/qbackendnode.h>
 #include <Qt3DCore/qnodeid.h>
+#include <Qt3DInput/private/handle_types_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -68,13 +69,29 @@ public:
     inline QVector<Qt3DCore::QNodeId> inputs() const { return m_inputs; }
     inline bool actionTriggered() const { return m_actionTriggered; }
     void setActionTriggered(bool actionTriggered);
+
+    // Resolved handles of inputs(), split by input type and rebuilt by the
+    // UpdateAxisActionJob whenever areInputHandlesDirty() returns true
+    inline QVector<HActionInput> actionInputHandles() const { return m_actionInputHandles; }
+    inline QVector<HInputSequence> inputSequenceHandles() const { return m_inputSequenceHandles; }
+    inline QVector<HInputChord> inputChordHandles() const { return m_inputChordHandles; }
+    void setInputHandles(const QVector<HActionInput> &actionInputHandles,
+                         const QVector<HInputSequence> &inputSequenceHandles,
+                         const QVector<HInputChord> &inputChordHandles);
+    inline bool areInputHandlesDirty() const { return m_inputHandlesDirty; }
+    inline void markInputHandlesDirty() { m_inputHandlesDirty = true; }
+
     void sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e) Q_DECL_OVERRIDE;
 
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
 
     QVector<Qt3DCore::QNodeId> m_inputs;
+    QVector<HActionInput> m_actionInputHandles;
+    QVector<HInputSequence> m_inputSequenceHandles;
+    QVector<HInputChord> m_inputChordHandles;
     bool m_actionTriggered;
+    bool m_inputHandlesDirty;
 };
 
 } // Input
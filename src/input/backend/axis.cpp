@@ -56,6 +56,7 @@ namespace Input {
 Axis::Axis()
     : Qt3DCore::QBackendNode(ReadWrite)
     , m_axisValue(0.0f)
+    , m_inputHandlesDirty(true)
 {
 }
 
@@ -64,13 +65,25 @@ void Axis::initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change)
     const auto typedChange = qSharedPointerCast<Qt3DCore::QNodeCreatedChange<QAxisData>>(change);
     const auto &data = typedChange->data;
     m_inputs = data.inputIds;
+    m_inputHandlesDirty = true;
 }
 
 void Axis::cleanup()
 {
     QBackendNode::setEnabled(false);
     m_inputs.clear();
+    m_analogAxisInputHandles.clear();
+    m_buttonAxisInputHandles.clear();
     m_axisValue = 0.0f;
+    m_inputHandlesDirty = true;
+}
+
+void Axis::setInputHandles(const QVector<HAnalogAxisInput> &analogAxisInputHandles,
+                           const QVector<HButtonAxisInput> &buttonAxisInputHandles)
+{
+    m_analogAxisInputHandles = analogAxisInputHandles;
+    m_buttonAxisInputHandles = buttonAxisInputHandles;
+    m_inputHandlesDirty = false;
 }
 
 void Axis::setAxisValue(float axisValue)
@@ -94,6 +107,7 @@ void Axis::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         const auto change = qSharedPointerCast<Qt3DCore::QPropertyNodeAddedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("input"))
             m_inputs.push_back(change->addedNodeId());
+        m_inputHandlesDirty = true;
         break;
     }
 
@@ -101,6 +115,8 @@ void Axis::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         const auto change = qSharedPointerCast<Qt3DCore::QPropertyNodeRemovedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("input"))
             m_inputs.removeOne(change->removedNodeId());
+        m_inputHandlesDirty = true;
+        break;
     }
 
     default:
@@ -53,6 +53,7 @@
 
 #include <Qt3DCore/qbackendnode.h>
 #include <Qt3DCore/qnodeid.h>
+#include <Qt3DInput/private/handle_types_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -68,13 +69,26 @@ public:
     inline QVector<Qt3DCore::QNodeId> inputs() const { return m_inputs; }
     inline float axisValue() const { return m_axisValue; }
     void setAxisValue(float axisValue);
+
+    // Resolved handles of inputs(), split by input type and rebuilt by the
+    // UpdateAxisActionJob whenever areInputHandlesDirty() returns true
+    inline QVector<HAnalogAxisInput> analogAxisInputHandles() const { return m_analogAxisInputHandles; }
+    inline QVector<HButtonAxisInput> buttonAxisInputHandles() const { return m_buttonAxisInputHandles; }
+    void setInputHandles(const QVector<HAnalogAxisInput> &analogAxisInputHandles,
+                         const QVector<HButtonAxisInput> &buttonAxisInputHandles);
+    inline bool areInputHandlesDirty() const { return m_inputHandlesDirty; }
+    inline void markInputHandlesDirty() { m_inputHandlesDirty = true; }
+
     void sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e) Q_DECL_OVERRIDE;
 
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
 
     QVector<Qt3DCore::QNodeId> m_inputs;
+    QVector<HAnalogAxisInput> m_analogAxisInputHandles;
+    QVector<HButtonAxisInput> m_buttonAxisInputHandles;
     float m_axisValue;
+    bool m_inputHandlesDirty;
 };
 
 } // namespace Input
@@ -70,6 +70,8 @@ class Action;
 class ActionInput;
 class InputSequence;
 class InputChord;
+class AnalogAxisInput;
+class ButtonAxisInput;
 class LogicalDevice;
 class GenericDeviceBackendNode;
 class PhysicalDeviceProxy;
@@ -87,6 +89,8 @@ typedef Qt3DCore::QHandle<AbstractAxisInput, 16> HAxisInput;
 typedef Qt3DCore::QHandle<ActionInput, 16> HActionInput;
 typedef Qt3DCore::QHandle<InputSequence, 16> HInputSequence;
 typedef Qt3DCore::QHandle<InputChord, 16> HInputChord;
+typedef Qt3DCore::QHandle<AnalogAxisInput, 16> HAnalogAxisInput;
+typedef Qt3DCore::QHandle<ButtonAxisInput, 16> HButtonAxisInput;
 typedef Qt3DCore::QHandle<LogicalDevice, 16> HLogicalDevice;
 typedef Qt3DCore::QHandle<GenericDeviceBackendNode, 8> HGenericDeviceBackendNode;
 typedef Qt3DCore::QHandle<PhysicalDeviceProxy, 16> HPhysicalDeviceProxy;
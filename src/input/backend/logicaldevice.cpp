@@ -57,6 +57,7 @@ namespace Input {
 
 LogicalDevice::LogicalDevice()
     : QBackendNode()
+    , m_handlesDirty(true)
 {
 }
 
@@ -66,6 +67,7 @@ void LogicalDevice::initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr
     const auto &data = typedChange->data;
     m_actions = data.actionIds;
     m_axes = data.axisIds;
+    m_handlesDirty = true;
 }
 
 void LogicalDevice::cleanup()
@@ -73,6 +75,16 @@ void LogicalDevice::cleanup()
     QBackendNode::setEnabled(false);
     m_actions.clear();
     m_axes.clear();
+    m_axisHandles.clear();
+    m_actionHandles.clear();
+    m_handlesDirty = true;
+}
+
+void LogicalDevice::setHandles(const QVector<HAxis> &axisHandles, const QVector<HAction> &actionHandles)
+{
+    m_axisHandles = axisHandles;
+    m_actionHandles = actionHandles;
+    m_handlesDirty = false;
 }
 
 void LogicalDevice::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
@@ -84,6 +96,7 @@ void LogicalDevice::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
             m_axes.push_back(change->addedNodeId());
         else if (change->propertyName() == QByteArrayLiteral("action"))
             m_actions.push_back(change->addedNodeId());
+        m_handlesDirty = true;
         break;
     }
 
@@ -93,6 +106,7 @@ void LogicalDevice::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
             m_axes.removeOne(change->removedNodeId());
         else if (change->propertyName() == QByteArrayLiteral("action"))
             m_actions.removeOne(change->removedNodeId());
+        m_handlesDirty = true;
         break;
     }
 
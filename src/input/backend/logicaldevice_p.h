@@ -53,6 +53,7 @@
 
 #include <Qt3DCore/qbackendnode.h>
 #include <Qt3DCore/qnodeid.h>
+#include <Qt3DInput/private/handle_types_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -71,6 +72,14 @@ public:
     inline QVector<Qt3DCore::QNodeId> axes() const { return m_axes; }
     inline QVector<Qt3DCore::QNodeId> actions() const { return m_actions; }
 
+    // Resolved handles of axes() and actions(), rebuilt by the
+    // UpdateAxisActionJob whenever areHandlesDirty() returns true
+    inline QVector<HAxis> axisHandles() const { return m_axisHandles; }
+    inline QVector<HAction> actionHandles() const { return m_actionHandles; }
+    void setHandles(const QVector<HAxis> &axisHandles, const QVector<HAction> &actionHandles);
+    inline bool areHandlesDirty() const { return m_handlesDirty; }
+    inline void markHandlesDirty() { m_handlesDirty = true; }
+
     void sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e) Q_DECL_OVERRIDE;
 
 private:
@@ -78,6 +87,9 @@ private:
 
     QVector<Qt3DCore::QNodeId> m_axes;
     QVector<Qt3DCore::QNodeId> m_actions;
+    QVector<HAxis> m_axisHandles;
+    QVector<HAction> m_actionHandles;
+    bool m_handlesDirty;
 };
 
 
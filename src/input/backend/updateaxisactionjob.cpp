@@ -49,11 +49,30 @@ namespace Qt3DInput {
 
 namespace Input {
 
-UpdateAxisActionJob::UpdateAxisActionJob(qint64 currentTime, InputHandler *handler, HLogicalDevice handle)
+namespace {
+
+// Processes the inputs behind the resolved handles of owner. An input
+// destroyed since its handle was resolved is skipped and the handles of
+// owner are resolved again next frame
+template<typename Owner, typename Manager, typename Handle, typename Process>
+void processInputs(Owner *owner, Manager *manager, const QVector<Handle> &handles, Process process)
+{
+    for (const Handle handle : handles) {
+        auto *input = manager->data(handle);
+        if (!input) {
+            owner->markInputHandlesDirty();
+            continue;
+        }
+        process(input);
+    }
+}
+
+} // anonymous
+
+UpdateAxisActionJob::UpdateAxisActionJob(InputHandler *handler)
     : Qt3DCore::QAspectJob()
-    , m_currentTime(currentTime)
+    , m_currentTime(0)
     , m_handler(handler)
-    , m_handle(handle)
 {
     SET_JOB_RUN_STAT_TYPE(this, JobTypes::UpdateAxisAction, 0);
 }
@@ -61,67 +80,166 @@ UpdateAxisActionJob::UpdateAxisActionJob(qint64 currentTime, InputHandler *handl
 void UpdateAxisActionJob::run()
 {
     // Note: we assume axis/action are not really shared:
-    // there's no benefit in sharing those when it comes to computing
-    LogicalDevice *device = m_handler->logicalDeviceManager()->data(m_handle);
+    // there's no benefit in sharing those when it comes to computing.
+    // Each device belongs to a single job, so devices can safely be
+    // updated by several of these jobs running in parallel
+    for (const HLogicalDevice handle : qAsConst(m_handles)) {
+        LogicalDevice *device = m_handler->logicalDeviceManager()->data(handle);
+
+        if (!device || !device->isEnabled())
+            continue;
 
-    if (!device->isEnabled())
-        return;
+        if (device->areHandlesDirty())
+            resolveHandles(device);
 
-    updateAction(device);
-    updateAxis(device);
+        updateAction(device);
+        updateAxis(device);
+    }
 }
 
-void UpdateAxisActionJob::updateAction(LogicalDevice *device)
+void UpdateAxisActionJob::resolveHandles(LogicalDevice *device)
 {
+    // Resolve the axis and action ids once, subsequent frames only go
+    // through the handles. Handles which can't be resolved yet (backend
+    // node not created) are skipped and resolution is retried next frame
+    bool complete = true;
+
+    const auto axisIds = device->axes();
+    QVector<HAxis> axisHandles;
+    axisHandles.reserve(axisIds.size());
+    for (const Qt3DCore::QNodeId axisId : axisIds) {
+        const HAxis handle = m_handler->axisManager()->lookupHandle(axisId);
+        if (handle.isNull())
+            complete = false;
+        else
+            axisHandles.push_back(handle);
+    }
+
     const auto actionIds = device->actions();
+    QVector<HAction> actionHandles;
+    actionHandles.reserve(actionIds.size());
     for (const Qt3DCore::QNodeId actionId : actionIds) {
-        bool actionTriggered = false;
-        Action *action = m_handler->actionManager()->lookupResource(actionId);
+        const HAction handle = m_handler->actionManager()->lookupHandle(actionId);
+        if (handle.isNull())
+            complete = false;
+        else
+            actionHandles.push_back(handle);
+    }
 
-        const auto actionInputIds = action->inputs();
-        for (const Qt3DCore::QNodeId actionInputId : actionInputIds)
-            actionTriggered |= processActionInput(actionInputId);
+    device->setHandles(axisHandles, actionHandles);
+    if (!complete)
+        device->markHandlesDirty();
+}
 
-        action->setActionTriggered(actionTriggered);
+void UpdateAxisActionJob::resolveInputHandles(Action *action)
+{
+    bool complete = true;
+    QVector<HActionInput> actionInputHandles;
+    QVector<HInputSequence> inputSequenceHandles;
+    QVector<HInputChord> inputChordHandles;
+
+    const auto inputIds = action->inputs();
+    for (const Qt3DCore::QNodeId inputId : inputIds) {
+        const HActionInput actionInputHandle = m_handler->actionInputManager()->lookupHandle(inputId);
+        if (!actionInputHandle.isNull()) {
+            actionInputHandles.push_back(actionInputHandle);
+            continue;
+        }
+        const HInputSequence inputSequenceHandle = m_handler->inputSequenceManager()->lookupHandle(inputId);
+        if (!inputSequenceHandle.isNull()) {
+            inputSequenceHandles.push_back(inputSequenceHandle);
+            continue;
+        }
+        const HInputChord inputChordHandle = m_handler->inputChordManager()->lookupHandle(inputId);
+        if (!inputChordHandle.isNull()) {
+            inputChordHandles.push_back(inputChordHandle);
+            continue;
+        }
+        complete = false;
     }
+
+    action->setInputHandles(actionInputHandles, inputSequenceHandles, inputChordHandles);
+    if (!complete)
+        action->markInputHandlesDirty();
 }
 
-bool UpdateAxisActionJob::processActionInput(const Qt3DCore::QNodeId actionInputId)
+void UpdateAxisActionJob::resolveInputHandles(Axis *axis)
 {
-    AbstractActionInput *actionInput = m_handler->lookupActionInput(actionInputId);
-    Q_ASSERT(actionInput);
-    return actionInput->process(m_handler, m_currentTime);
+    bool complete = true;
+    QVector<HAnalogAxisInput> analogAxisInputHandles;
+    QVector<HButtonAxisInput> buttonAxisInputHandles;
+
+    const auto inputIds = axis->inputs();
+    for (const Qt3DCore::QNodeId inputId : inputIds) {
+        const HAnalogAxisInput analogAxisInputHandle = m_handler->analogAxisInputManager()->lookupHandle(inputId);
+        if (!analogAxisInputHandle.isNull()) {
+            analogAxisInputHandles.push_back(analogAxisInputHandle);
+            continue;
+        }
+        const HButtonAxisInput buttonAxisInputHandle = m_handler->buttonAxisInputManager()->lookupHandle(inputId);
+        if (!buttonAxisInputHandle.isNull()) {
+            buttonAxisInputHandles.push_back(buttonAxisInputHandle);
+            continue;
+        }
+        complete = false;
+    }
+
+    axis->setInputHandles(analogAxisInputHandles, buttonAxisInputHandles);
+    if (!complete)
+        axis->markInputHandlesDirty();
 }
 
-void UpdateAxisActionJob::updateAxis(LogicalDevice *device)
+void UpdateAxisActionJob::updateAction(LogicalDevice *device)
 {
-    const auto axisIds = device->axes();
-    for (const Qt3DCore::QNodeId axisId : axisIds) {
-        Axis *axis = m_handler->axisManager()->lookupResource(axisId);
-        float axisValue = 0.0f;
+    const auto actionHandles = device->actionHandles();
+    for (const HAction actionHandle : actionHandles) {
+        Action *action = m_handler->actionManager()->data(actionHandle);
+        // The action was destroyed since the handles were resolved
+        if (!action) {
+            device->markHandlesDirty();
+            continue;
+        }
+
+        if (action->areInputHandlesDirty())
+            resolveInputHandles(action);
 
-        const auto axisInputIds = axis->inputs();
-        for (const Qt3DCore::QNodeId axisInputId : axisInputIds)
-            axisValue += processAxisInput(axisInputId);
+        bool actionTriggered = false;
+        const auto processActionInput = [this, &actionTriggered] (AbstractActionInput *actionInput) {
+            actionTriggered |= actionInput->process(m_handler, m_currentTime);
+        };
+        processInputs(action, m_handler->actionInputManager(), action->actionInputHandles(), processActionInput);
+        processInputs(action, m_handler->inputSequenceManager(), action->inputSequenceHandles(), processActionInput);
+        processInputs(action, m_handler->inputChordManager(), action->inputChordHandles(), processActionInput);
 
-        // Clamp the axisValue -1/1
-        axisValue = qMin(1.0f, qMax(axisValue, -1.0f));
-        axis->setAxisValue(axisValue);
+        action->setActionTriggered(actionTriggered);
     }
 }
 
-float UpdateAxisActionJob::processAxisInput(const Qt3DCore::QNodeId axisInputId)
+void UpdateAxisActionJob::updateAxis(LogicalDevice *device)
 {
-    AnalogAxisInput *analogInput = m_handler->analogAxisInputManager()->lookupResource(axisInputId);
-    if (analogInput)
-        return analogInput->process(m_handler, m_currentTime);
+    const auto axisHandles = device->axisHandles();
+    for (const HAxis axisHandle : axisHandles) {
+        Axis *axis = m_handler->axisManager()->data(axisHandle);
+        // The axis was destroyed since the handles were resolved
+        if (!axis) {
+            device->markHandlesDirty();
+            continue;
+        }
+
+        if (axis->areInputHandlesDirty())
+            resolveInputHandles(axis);
 
-    ButtonAxisInput *buttonInput = m_handler->buttonAxisInputManager()->lookupResource(axisInputId);
-    if (buttonInput)
-        return buttonInput->process(m_handler, m_currentTime);
+        float axisValue = 0.0f;
+        const auto processAxisInput = [this, &axisValue] (AbstractAxisInput *axisInput) {
+            axisValue += axisInput->process(m_handler, m_currentTime);
+        };
+        processInputs(axis, m_handler->analogAxisInputManager(), axis->analogAxisInputHandles(), processAxisInput);
+        processInputs(axis, m_handler->buttonAxisInputManager(), axis->buttonAxisInputHandles(), processAxisInput);
 
-    Q_UNREACHABLE();
-    return 0.0f;
+        // Clamp the axisValue -1/1
+        axisValue = qMin(1.0f, qMax(axisValue, -1.0f));
+        axis->setAxisValue(axisValue);
+    }
 }
 
 } // Input
@@ -65,24 +65,35 @@ class QAbstractPhysicalDeviceBackendNode;
 namespace Input {
 
 class AbstractAxisInput;
+class Action;
+class Axis;
 class ButtonAxisInput;
 class InputHandler;
 
-class UpdateAxisActionJob : public Qt3DCore::QAspectJob
+class Q_AUTOTEST_EXPORT UpdateAxisActionJob : public Qt3DCore::QAspectJob
 {
 public:
-    explicit UpdateAxisActionJob(qint64 currentTime, InputHandler *handler, HLogicalDevice handle);
+    explicit UpdateAxisActionJob(InputHandler *handler);
+
+    void setCurrentTime(qint64 currentTime) { m_currentTime = currentTime; }
+    qint64 currentTime() const { return m_currentTime; }
+
+    // The batch of logical devices evaluated by this job
+    void setDevices(const QVector<HLogicalDevice> &handles) { m_handles = handles; }
+    QVector<HLogicalDevice> devices() const { return m_handles; }
+
     void run() Q_DECL_FINAL;
 
 private:
+    void resolveHandles(LogicalDevice *device);
+    void resolveInputHandles(Action *action);
+    void resolveInputHandles(Axis *axis);
     void updateAction(LogicalDevice *device);
-    bool processActionInput(const Qt3DCore::QNodeId actionInputId);
     void updateAxis(LogicalDevice *device);
-    float processAxisInput(const Qt3DCore::QNodeId axisInputId);
 
-    const qint64 m_currentTime;
+    qint64 m_currentTime;
     InputHandler *m_handler;
-    HLogicalDevice m_handle;
+    QVector<HLogicalDevice> m_handles;
 };
 
 typedef QSharedPointer<UpdateAxisActionJob> UpdateAxisActionJobPtr;
@@ -63,6 +63,7 @@
 #endif
 #include <QtCore/QLibraryInfo>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QThread>
 
 #include <Qt3DInput/private/action_p.h>
 #include <Qt3DInput/private/actioninput_p.h>
@@ -194,6 +195,55 @@ void QInputAspectPrivate::loadInputDevicePlugins()
     }
 }
 
+/*!
+    \internal
+
+    Splits the enabled logical devices into batches and returns one
+    UpdateAxisActionJob per batch. The jobs are kept from one frame to the
+    next, so the number of jobs scheduled is bounded by the number of
+    threads rather than by the number of logical devices.
+ */
+QVector<Input::UpdateAxisActionJobPtr> QInputAspectPrivate::updateAxisActionJobs(qint64 time)
+{
+    // Below that number of devices per batch, splitting the work further
+    // costs more in scheduling than it saves
+    const int minDevicesPerJob = 32;
+
+    Input::LogicalDeviceManager *manager = m_inputHandler->logicalDeviceManager();
+    const QVector<Input::HLogicalDevice> activeHandles = manager->activeDevices();
+    QVector<Input::HLogicalDevice> enabledHandles;
+    enabledHandles.reserve(activeHandles.size());
+    for (const Input::HLogicalDevice handle : activeHandles) {
+        const Input::LogicalDevice *device = manager->data(handle);
+        if (device && device->isEnabled())
+            enabledHandles.push_back(handle);
+    }
+
+    QVector<Input::UpdateAxisActionJobPtr> jobs;
+    if (enabledHandles.isEmpty())
+        return jobs;
+
+    const int maxJobCount = qMax(1, QThread::idealThreadCount());
+    const int jobCount = qMin(maxJobCount, (enabledHandles.size() + minDevicesPerJob - 1) / minDevicesPerJob);
+    const int devicesPerJob = (enabledHandles.size() + jobCount - 1) / jobCount;
+
+    while (m_updateAxisActionJobs.size() < jobCount)
+        m_updateAxisActionJobs.push_back(Input::UpdateAxisActionJobPtr::create(m_inputHandler.data()));
+
+    jobs.reserve(jobCount);
+    for (int i = 0; i < jobCount; ++i) {
+        const Input::UpdateAxisActionJobPtr &job = m_updateAxisActionJobs.at(i);
+        job->setCurrentTime(time);
+        job->setDevices(enabledHandles.mid(i * devicesPerJob, devicesPerJob));
+        // Dependencies are added again by jobsToExecute every frame
+        const QVector<QWeakPointer<Qt3DCore::QAspectJob>> dependencies = job->dependencies();
+        for (const QWeakPointer<Qt3DCore::QAspectJob> &dependency : dependencies)
+            job->removeDependency(dependency);
+        jobs.push_back(job);
+    }
+    return jobs;
+}
+
 /*!
     Create a physical device identified by \a name using the input device integrations present
     returns a Q_NULLPTR if it is not found.
@@ -255,19 +305,11 @@ QVector<QAspectJobPtr> QInputAspect::jobsToExecute(qint64 time)
     const QVector<QAspectJobPtr> dependsOnJobs = jobs;
 
     // Jobs that update Axis/Action (store combined axis/action value)
-    const auto devHandles = d->m_inputHandler->logicalDeviceManager()->activeDevices();
-    QVector<QAspectJobPtr> axisActionJobs;
-    axisActionJobs.reserve(devHandles.size());
-    for (Input::HLogicalDevice devHandle : devHandles) {
-        const auto device = d->m_inputHandler->logicalDeviceManager()->data(devHandle);
-        if (!device->isEnabled())
-            continue;
-
-        QAspectJobPtr updateAxisActionJob(new Input::UpdateAxisActionJob(time, d->m_inputHandler.data(), devHandle));
-        jobs += updateAxisActionJob;
-        axisActionJobs.push_back(updateAxisActionJob);
+    const QVector<Input::UpdateAxisActionJobPtr> axisActionJobs = d->updateAxisActionJobs(time);
+    for (const Input::UpdateAxisActionJobPtr &updateAxisActionJob : axisActionJobs) {
         for (const QAspectJobPtr &job : dependsOnJobs)
             updateAxisActionJob->addDependency(job);
+        jobs.push_back(updateAxisActionJob);
     }
 
     // Once all the axes have been updated we can step the integrations on
@@ -275,7 +317,7 @@ QVector<QAspectJobPtr> QInputAspect::jobsToExecute(qint64 time)
     auto accumulateJob = Input::AxisAccumulatorJobPtr::create(d->m_inputHandler->axisAccumulatorManager(),
                                                               d->m_inputHandler->axisManager());
     accumulateJob->setDeltaTime(dt);
-    for (const QAspectJobPtr &job : qAsConst(axisActionJobs))
+    for (const Input::UpdateAxisActionJobPtr &job : axisActionJobs)
         accumulateJob->addDependency(job);
     jobs.push_back(accumulateJob);
 
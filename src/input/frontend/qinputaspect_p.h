@@ -52,6 +52,7 @@
 //
 
 #include <Qt3DCore/private/qabstractaspect_p.h>
+#include <Qt3DInput/private/updateaxisactionjob_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -69,10 +70,12 @@ class QInputAspectPrivate : public Qt3DCore::QAbstractAspectPrivate
 public:
     QInputAspectPrivate();
     void loadInputDevicePlugins();
+    QVector<Input::UpdateAxisActionJobPtr> updateAxisActionJobs(qint64 time);
 
     Q_DECLARE_PUBLIC(QInputAspect)
     QScopedPointer<Input::InputHandler> m_inputHandler;
     QScopedPointer<Input::KeyboardMouseGenericDeviceIntegration> m_keyboardMouseIntegration;
+    QVector<Input::UpdateAxisActionJobPtr> m_updateAxisActionJobs;
     qint64 m_time;
 };
 
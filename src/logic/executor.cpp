@@ -55,6 +55,9 @@ namespace Logic {
 Executor::Executor(QObject *parent)
     : QObject(parent)
     , m_scene(nullptr)
+    , m_semaphore(nullptr)
+    , m_asyncDt(0.0f)
+    , m_asyncUpdatePending(false)
 {
 }
 
@@ -66,6 +69,10 @@ void Executor::clearQueueAndProceed()
     m_nodeIds.clear();
     if (m_semaphore->available() == 0)
         m_semaphore->release();
+
+    QMutexLocker lock(&m_asyncMutex);
+    m_asyncNodeIds.clear();
+    m_asyncDt = 0.0f;
 }
 
 void Executor::enqueueLogicFrameUpdates(const QVector<Qt3DCore::QNodeId> &nodeIds)
@@ -73,11 +80,34 @@ void Executor::enqueueLogicFrameUpdates(const QVector<Qt3DCore::QNodeId> &nodeId
     m_nodeIds = nodeIds;
 }
 
+/*!
+   \internal
+
+   Called from the context of the logic aspect job in the asynchronous mode.
+   Records the frame update for \a nodeIds with time delta \a dt. Returns
+   true if the caller needs to post a FrameUpdateEvent, or false if an update
+   is still pending on the main thread, in which case this frame is merged
+   into it and its \a dt accumulated.
+*/
+bool Executor::enqueueAsynchronousLogicFrameUpdates(const QVector<Qt3DCore::QNodeId> &nodeIds, float dt)
+{
+    QMutexLocker lock(&m_asyncMutex);
+    m_asyncNodeIds = nodeIds;
+    m_asyncDt += dt;
+    if (m_asyncUpdatePending)
+        return false;
+    m_asyncUpdatePending = true;
+    return true;
+}
+
 bool Executor::event(QEvent *e)
 {
     if (e->type() == QEvent::User) {
         FrameUpdateEvent *ev = static_cast<FrameUpdateEvent *>(e);
-        processLogicFrameUpdates(ev->deltaTime());
+        if (ev->mode() == FrameUpdateEvent::Asynchronous)
+            processAsynchronousLogicFrameUpdates();
+        else
+            processLogicFrameUpdates(ev->deltaTime());
         e->setAccepted(true);
         return true;
     }
@@ -91,17 +121,49 @@ bool Executor::event(QEvent *e)
 */
 void Executor::processLogicFrameUpdates(float dt)
 {
-    Q_ASSERT(m_scene);
     Q_ASSERT(m_semaphore);
-    const QVector<QNode *> nodes = m_scene->lookupNodes(m_nodeIds);
+    executeFrameActions(m_nodeIds, dt);
+
+    // Release the semaphore so the calling Manager can continue
+    m_semaphore->release();
+}
+
+/*!
+   \internal
+
+   Called from context of main thread in the asynchronous mode. Triggers the
+   frame actions once with the time accumulated since the last trigger.
+*/
+void Executor::processAsynchronousLogicFrameUpdates()
+{
+    QVector<Qt3DCore::QNodeId> nodeIds;
+    float dt = 0.0f;
+    {
+        QMutexLocker lock(&m_asyncMutex);
+        nodeIds = std::move(m_asyncNodeIds);
+        m_asyncNodeIds.clear();
+        dt = m_asyncDt;
+        m_asyncDt = 0.0f;
+        m_asyncUpdatePending = false;
+    }
+    executeFrameActions(nodeIds, dt);
+}
+
+/*!
+   \internal
+
+   Triggers the enabled frame actions among \a nodeIds with time delta \a dt
+   in the calling thread.
+*/
+void Executor::executeFrameActions(const QVector<Qt3DCore::QNodeId> &nodeIds, float dt)
+{
+    Q_ASSERT(m_scene);
+    const QVector<QNode *> nodes = m_scene->lookupNodes(nodeIds);
     for (QNode *node : nodes) {
         QFrameAction *frameAction = qobject_cast<QFrameAction *>(node);
         if (frameAction && frameAction->isEnabled())
             frameAction->onTriggered(dt);
     }
-
-    // Release the semaphore so the calling Manager can continue
-    m_semaphore->release();
 }
 
 } // namespace Logic
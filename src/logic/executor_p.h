@@ -53,6 +53,7 @@
 
 #include <QtCore/qobject.h>
 #include <QtCore/qcoreevent.h>
+#include <QtCore/qmutex.h>
 #include <Qt3DCore/qnodeid.h>
 
 QT_BEGIN_NAMESPACE
@@ -69,18 +70,26 @@ namespace Logic {
 class FrameUpdateEvent : public QEvent
 {
 public:
-    FrameUpdateEvent(float dt)
+    enum Mode {
+        Synchronous,
+        Asynchronous
+    };
+
+    FrameUpdateEvent(float dt, Mode mode = Synchronous)
         : QEvent(QEvent::User)
         , m_dt(dt)
+        , m_mode(mode)
     {}
 
     float deltaTime() const { return m_dt; }
+    Mode mode() const { return m_mode; }
 
 private:
     float m_dt;
+    Mode m_mode;
 };
 
-class Executor : public QObject
+class Q_AUTOTEST_EXPORT Executor : public QObject
 {
     Q_OBJECT
 public:
@@ -90,17 +99,27 @@ public:
     void setSemephore(QSemaphore *semaphore) { m_semaphore = semaphore; }
     void clearQueueAndProceed();
 
+    bool enqueueAsynchronousLogicFrameUpdates(const QVector<Qt3DCore::QNodeId> &nodeIds, float dt);
+    void executeFrameActions(const QVector<Qt3DCore::QNodeId> &nodeIds, float dt);
+
 public Q_SLOTS:
     void enqueueLogicFrameUpdates(const QVector<Qt3DCore::QNodeId> &nodeIds);
 
 protected:
     bool event(QEvent *e);
     void processLogicFrameUpdates(float dt);
+    void processAsynchronousLogicFrameUpdates();
 
 private:
     QVector<Qt3DCore::QNodeId> m_nodeIds;
     Qt3DCore::QScene *m_scene;
     QSemaphore *m_semaphore;
+
+    // Pending state of the asynchronous mode, shared with the aspect thread
+    QMutex m_asyncMutex;
+    QVector<Qt3DCore::QNodeId> m_asyncNodeIds;
+    float m_asyncDt;
+    bool m_asyncUpdatePending;
 };
 
 } // namespace Logic
@@ -62,7 +62,7 @@ namespace Logic {
 
 class Manager;
 
-class Handler : public Qt3DCore::QBackendNode
+class Q_AUTOTEST_EXPORT Handler : public Qt3DCore::QBackendNode
 {
 public:
     Handler();
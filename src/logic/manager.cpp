@@ -56,8 +56,11 @@ namespace Logic {
 
 Manager::Manager()
     : m_logicHandlerManager(new HandlerManager)
+    , m_logicAspect(nullptr)
+    , m_executor(nullptr)
     , m_semaphore(1)
     , m_dt(0.0f)
+    , m_executionMode(QLogicAspect::Synchronous)
 {
     m_semaphore.acquire();
 }
@@ -94,15 +97,33 @@ void Manager::triggerLogicFrameUpdates()
 
     // Don't use blocking queued connections to main thread if it is already
     // in the process of shutting down as that will deadlock.
-    if (Qt3DCore::QAbstractAspectPrivate::get(m_logicAspect)->m_aspectManager->isShuttingDown())
-        return;
-
-    // Trigger the main thread to process logic frame updates for each
-    // logic component and then wait until done. The Executor will
-    // release the semaphore when it has completed its work.
-    m_executor->enqueueLogicFrameUpdates(m_logicComponentIds);
-    qApp->postEvent(m_executor, new FrameUpdateEvent(m_dt));
-    m_semaphore.acquire();
+    if (m_logicAspect) {
+        Qt3DCore::QAspectManager *aspectManager = Qt3DCore::QAbstractAspectPrivate::get(m_logicAspect)->m_aspectManager;
+        if (aspectManager && aspectManager->isShuttingDown())
+            return;
+    }
+
+    switch (m_executionMode) {
+    case QLogicAspect::Synchronous:
+        // Trigger the main thread to process logic frame updates for each
+        // logic component and then wait until done. The Executor will
+        // release the semaphore when it has completed its work.
+        m_executor->enqueueLogicFrameUpdates(m_logicComponentIds);
+        qApp->postEvent(m_executor, new FrameUpdateEvent(m_dt));
+        m_semaphore.acquire();
+        break;
+
+    case QLogicAspect::Asynchronous:
+        // Only post an event if the main thread has consumed the previous
+        // one. Otherwise this frame is coalesced into the pending update.
+        if (m_executor->enqueueAsynchronousLogicFrameUpdates(m_logicComponentIds, m_dt))
+            qApp->postEvent(m_executor, new FrameUpdateEvent(0.0f, FrameUpdateEvent::Asynchronous));
+        break;
+
+    case QLogicAspect::WorkerThread:
+        m_executor->executeFrameActions(m_logicComponentIds, m_dt);
+        break;
+    }
 }
 
 } // namespace Logic
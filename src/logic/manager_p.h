@@ -52,6 +52,7 @@
 //
 
 #include <Qt3DLogic/qt3dlogic_global.h>
+#include <Qt3DLogic/qlogicaspect.h>
 #include <Qt3DCore/qnodeid.h>
 #include <QtCore/qmutex.h>
 #include <QtCore/qscopedpointer.h>
@@ -62,15 +63,12 @@
 QT_BEGIN_NAMESPACE
 
 namespace Qt3DLogic {
-
-class QLogicAspect;
-
 namespace Logic {
 
 class Executor;
 class HandlerManager;
 
-class Manager
+class Q_AUTOTEST_EXPORT Manager
 {
 public:
     Manager();
@@ -88,6 +86,9 @@ public:
 
     void setDeltaTime(float dt) { m_dt = dt; }
 
+    void setExecutionMode(QLogicAspect::ExecutionMode mode) { m_executionMode = mode; }
+    QLogicAspect::ExecutionMode executionMode() const { return m_executionMode; }
+
 private:
     QScopedPointer<HandlerManager> m_logicHandlerManager;
     QVector<HHandler> m_logicHandlers;
@@ -96,6 +97,7 @@ private:
     Executor *m_executor;
     QSemaphore m_semaphore;
     float m_dt;
+    QLogicAspect::ExecutionMode m_executionMode;
 };
 
 } // namespace Logic
@@ -67,10 +67,31 @@ namespace Qt3DLogic {
  \since 5.7
 */
 
+/*!
+    \enum Qt3DLogic::QLogicAspect::ExecutionMode
+
+    This enum specifies how the frame actions are executed each frame.
+
+    \value Synchronous The frame actions are triggered on the main thread
+    and the logic aspect waits until all of them have completed before the
+    frame can proceed. This is the default.
+    \value Asynchronous The frame actions are triggered on the main thread
+    but the logic aspect does not wait for them. If the main thread is busy
+    and misses frames, the pending updates are coalesced into a single
+    trigger whose time delta is the sum of the missed frames.
+    \value WorkerThread The frame actions are triggered directly from the
+    thread pool running the logic aspect job. This avoids any round trip to
+    the main thread but must only be used if all frame actions, and the
+    slots connected to them with direct connections, are thread safe and are
+    not destroyed while the engine is running.
+    \since 5.10
+*/
+
 QLogicAspectPrivate::QLogicAspectPrivate()
     : QAbstractAspectPrivate()
     , m_time(0)
     , m_initialized(false)
+    , m_executionMode(QLogicAspect::Synchronous)
     , m_manager(new Logic::Manager)
     , m_executor(new Logic::Executor)
     , m_callbackJob(new Logic::CallbackJob)
@@ -113,6 +134,30 @@ QLogicAspect::~QLogicAspect()
 {
 }
 
+/*!
+    Sets the execution \a mode used to trigger the frame actions. The mode
+    should be set before the aspect is registered with an aspect engine.
+
+    \since 5.10
+*/
+void QLogicAspect::setExecutionMode(ExecutionMode mode)
+{
+    Q_D(QLogicAspect);
+    d->m_executionMode = mode;
+    d->m_manager->setExecutionMode(mode);
+}
+
+/*!
+    Returns the execution mode used to trigger the frame actions.
+
+    \since 5.10
+*/
+QLogicAspect::ExecutionMode QLogicAspect::executionMode() const
+{
+    Q_D(const QLogicAspect);
+    return d->m_executionMode;
+}
+
 /*! \internal */
 QVector<QAspectJobPtr> QLogicAspect::jobsToExecute(qint64 time)
 {
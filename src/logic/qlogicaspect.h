@@ -53,9 +53,19 @@ class QT3DLOGICSHARED_EXPORT QLogicAspect : public Qt3DCore::QAbstractAspect
 {
     Q_OBJECT
 public:
+    enum ExecutionMode {
+        Synchronous,
+        Asynchronous,
+        WorkerThread
+    };
+    Q_ENUM(ExecutionMode)
+
     explicit QLogicAspect(QObject *parent = nullptr);
     ~QLogicAspect();
 
+    void setExecutionMode(ExecutionMode mode);
+    ExecutionMode executionMode() const;
+
 private:
     QVector<Qt3DCore::QAspectJobPtr> jobsToExecute(qint64 time) Q_DECL_OVERRIDE;
     void onRegistered() Q_DECL_OVERRIDE;
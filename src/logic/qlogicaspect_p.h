@@ -54,6 +54,7 @@
 #include <QtCore/qsharedpointer.h>
 
 #include <Qt3DCore/private/qabstractaspect_p.h>
+#include <Qt3DLogic/qlogicaspect.h>
 #include <Qt3DLogic/private/callbackjob_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -76,6 +77,7 @@ class QLogicAspectPrivate : public Qt3DCore::QAbstractAspectPrivate
 
     qint64 m_time;
     bool m_initialized;
+    QLogicAspect::ExecutionMode m_executionMode;
     QScopedPointer<Logic::Manager> m_manager;
     QScopedPointer<Logic::Executor> m_executor;
     QSharedPointer<Logic::CallbackJob> m_callbackJob;
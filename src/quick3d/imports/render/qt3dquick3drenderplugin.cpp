@@ -77,6 +77,7 @@
 #include <Qt3DRender/qnodepthmask.h>
 #include <Qt3DRender/qnodraw.h>
 #include <Qt3DRender/qobjectpicker.h>
+#include <Qt3DRender/qocclusionculling.h>
 #include <Qt3DRender/qparameter.h>
 #include <Qt3DRender/qpickevent.h>
 #include <Qt3DRender/qpickingsettings.h>
@@ -156,6 +157,7 @@ void Qt3DQuick3DRenderPlugin::registerTypes(const char *uri)
 
     // Renderer setttings
     qmlRegisterType<Qt3DRender::QRenderSettings>(uri, 2, 0, "RenderSettings");
+    qmlRegisterRevision<Qt3DRender::QRenderSettings, 10>(uri, 2, 10);
     qmlRegisterType<Qt3DRender::QPickingSettings>(uri, 2, 0, "PickingSettings");
 
     // @uri Qt3D.Render
@@ -250,6 +252,7 @@ void Qt3DQuick3DRenderPlugin::registerTypes(const char *uri)
     qmlRegisterUncreatableType<Qt3DRender::QRenderCaptureReply>(uri, 2, 1, "RenderCaptureReply", QStringLiteral("RenderCaptureReply is only instantiated by RenderCapture"));
     qmlRegisterType<Qt3DRender::QBufferCapture>(uri, 2, 9, "BufferCapture");
     Qt3DRender::Quick::registerExtendedType<Qt3DRender::QMemoryBarrier, Qt3DRender::Render::Quick::Quick3DMemoryBarrier>("QMemoryBarrier", "Qt3D.Render/MemoryBarrier", uri, 2, 9, "MemoryBarrier");
+    qmlRegisterType<Qt3DRender::QOcclusionCulling>(uri, 2, 10, "OcclusionCulling");
 
     // RenderTarget
     qmlRegisterType<Qt3DRender::QRenderTargetOutput>(uri, 2, 0, "RenderTargetOutput");
@@ -260,6 +263,7 @@ void Qt3DQuick3DRenderPlugin::registerTypes(const char *uri)
 
     // Sorting
     qmlRegisterType<Qt3DRender::QSortPolicy>(uri, 2, 0, "SortPolicy");
+    qmlRegisterRevision<Qt3DRender::QSortPolicy, 10>(uri, 2, 10);
 
     // RenderStates
     qmlRegisterUncreatableType<Qt3DRender::QRenderState>(uri, 2, 0, "RenderState", QStringLiteral("QRenderState is a base class"));
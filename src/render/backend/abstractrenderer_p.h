@@ -99,6 +99,7 @@ public:
         MaterialDirty    = 1 << 1,
         GeometryDirty    = 1 << 2,
         ComputeDirty     = 1 << 3,
+        FrameGraphDirty  = 1 << 4,
         AllDirty         = 1 << 15
     };
     Q_DECLARE_FLAGS(BackendNodeDirtySet, BackendNodeDirtyFlag)
@@ -44,6 +44,7 @@
 #include <Qt3DRender/private/rendercommand_p.h>
 #include <Qt3DRender/private/nodemanagers_p.h>
 #include <Qt3DRender/private/geometryrenderermanager_p.h>
+#include <Qt3DRender/private/gltexturemanager_p.h>
 #include <Qt3DRender/private/stringtoint_p.h>
 #include <QJsonObject>
 #include <QJsonDocument>
@@ -362,6 +363,15 @@ void CommandExecuter::performAsynchronousCommandExecution(const QVector<Render::
 
             replyObj.insert(QLatin1String("renderViews"), viewArray);
             reply->setData(QJsonDocument(replyObj).toJson());
+        } else if (reply->commandName() == QLatin1String("texturememory")) {
+            QJsonObject replyObj;
+            const Render::TextureResidencyStatistics stats = m_renderer->nodeManagers()->glTextureManager()->residencyStatistics();
+            replyObj.insert(QLatin1String("budget"), double(stats.budget));
+            replyObj.insert(QLatin1String("residentSize"), double(stats.residentSize));
+            replyObj.insert(QLatin1String("residentTextures"), stats.residentTextures);
+            replyObj.insert(QLatin1String("evictedTextures"), stats.evictedTextures);
+            replyObj.insert(QLatin1String("totalEvictedTextures"), double(stats.totalEvictedTextures));
+            reply->setData(QJsonDocument(replyObj).toJson());
         }
         reply->setFinished(true);
     }
@@ -373,7 +383,8 @@ QVariant CommandExecuter::executeCommand(const QStringList &args)
     // Note: The replies will be deleted by the AspectCommandDebugger
     if (args.length() > 0 &&
             (args.first() == QLatin1String("glinfo") ||
-             args.first() == QLatin1String("rendercommands"))) {
+             args.first() == QLatin1String("rendercommands") ||
+             args.first() == QLatin1String("texturememory"))) {
         auto reply = new Qt3DCore::Debug::AsynchronousCommandReply(args.first());
         QMutexLocker lock(m_renderer->mutex());
         m_pendingCommands.push_back(reply);
@@ -78,8 +78,10 @@ namespace Render {
 Entity::Entity()
     : BackendNode()
     , m_nodeManagers(nullptr)
+    , m_componentTypes()
     , m_boundingDirty(false)
     , m_treeEnabled(true)
+    , m_componentHandlesDirty(false)
 {
 }
 
@@ -99,6 +101,9 @@ void Entity::cleanup()
         // We need to release using peerId otherwise the handle will be cleared
         // but would still remain in the Id to Handle table
         m_nodeManagers->worldMatrixManager()->releaseResource(peerId());
+        // Our handle index will be reused by another Entity
+        for (const QNodeId layerId : qAsConst(m_layerComponents))
+            setLayerMembership(layerId, false);
 
         qCDebug(Render::RenderNodes) << Q_FUNC_INFO;
 
@@ -114,6 +119,13 @@ void Entity::cleanup()
     m_objectPickerComponent = QNodeId();
     m_boundingVolumeDebugComponent = QNodeId();
     m_computeComponent = QNodeId();
+    m_transformHandle = HTransform();
+    m_materialHandle = HMaterial();
+    m_cameraHandle = HCamera();
+    m_geometryRendererHandle = HGeometryRenderer();
+    m_objectPickerHandle = HObjectPicker();
+    m_computeHandle = HComputeCommand();
+    m_componentHandlesDirty = false;
     m_childrenHandles.clear();
     m_layerComponents.clear();
     m_levelOfDetailComponents.clear();
@@ -124,6 +136,8 @@ void Entity::cleanup()
     m_worldBoundingVolume.reset();
     m_worldBoundingVolumeWithChildren.reset();
     m_boundingDirty = false;
+    // Leave the archetype table, our handle index will be reused
+    updateComponentTypes();
     QBackendNode::setEnabled(false);
 }
 
@@ -290,6 +304,7 @@ void Entity::addComponent(Qt3DCore::QComponent *component)
         m_cameraComponent = component->id();
     } else if (qobject_cast<QLayer *>(component) != nullptr) {
         m_layerComponents.append(component->id());
+        setLayerMembership(component->id(), true);
     } else if (qobject_cast<QLevelOfDetail *>(component) != nullptr) {
         m_levelOfDetailComponents.append(component->id());
     } else if (qobject_cast<QMaterial *>(component) != nullptr) {
@@ -310,6 +325,8 @@ void Entity::addComponent(Qt3DCore::QComponent *component)
     } else if (qobject_cast<QComputeCommand *>(component) != nullptr) {
         m_computeComponent = component->id();
     }
+    updateComponentTypes();
+    markComponentHandlesDirty();
 }
 
 void Entity::addComponent(Qt3DCore::QNodeIdTypePair idAndType)
@@ -325,6 +342,7 @@ void Entity::addComponent(Qt3DCore::QNodeIdTypePair idAndType)
         m_cameraComponent = id;
     } else if (type->inherits(&QLayer::staticMetaObject)) {
         m_layerComponents.append(id);
+        setLayerMembership(id, true);
     } else if (type->inherits(&QLevelOfDetail::staticMetaObject)) {
         m_levelOfDetailComponents.append(id);
     } else if (type->inherits(&QMaterial::staticMetaObject)) {
@@ -345,6 +363,8 @@ void Entity::addComponent(Qt3DCore::QNodeIdTypePair idAndType)
     } else if (type->inherits(&QComputeCommand::staticMetaObject)) {
         m_computeComponent = id;
     }
+    updateComponentTypes();
+    markComponentHandlesDirty();
 }
 
 void Entity::removeComponent(Qt3DCore::QNodeId nodeId)
@@ -355,6 +375,7 @@ void Entity::removeComponent(Qt3DCore::QNodeId nodeId)
         m_cameraComponent = QNodeId();
     } else if (m_layerComponents.contains(nodeId)) {
         m_layerComponents.removeAll(nodeId);
+        setLayerMembership(nodeId, false);
     } else if (m_levelOfDetailComponents.contains(nodeId)) {
         m_levelOfDetailComponents.removeAll(nodeId);
     } else if (m_materialComponent == nodeId) {
@@ -375,6 +396,126 @@ void Entity::removeComponent(Qt3DCore::QNodeId nodeId)
     } else if (m_computeComponent == nodeId) {
         m_computeComponent = QNodeId();
     }
+    updateComponentTypes();
+    markComponentHandlesDirty();
+}
+
+void Entity::setLayerMembership(Qt3DCore::QNodeId layerId, bool member)
+{
+    if (m_nodeManagers == nullptr || m_handle.isNull())
+        return;
+    // The Layer backend may not have been created yet, the
+    // NodeFunctor will then reuse the instance created here
+    LayerManager *layerManager = m_nodeManagers->layerManager();
+    Layer *layer = member ? layerManager->getOrCreateResource(layerId)
+                          : layerManager->lookupResource(layerId);
+    if (layer == nullptr)
+        return;
+    if (member)
+        layer->addEntity(m_handle.index());
+    else
+        layer->removeEntity(m_handle.index());
+}
+
+void Entity::markComponentHandlesDirty()
+{
+    // Cached handles may point to a component that is still alive but no
+    // longer attached to us, drop them until the next resolution
+    m_transformHandle = HTransform();
+    m_materialHandle = HMaterial();
+    m_cameraHandle = HCamera();
+    m_geometryRendererHandle = HGeometryRenderer();
+    m_objectPickerHandle = HObjectPicker();
+    m_computeHandle = HComputeCommand();
+
+    if (m_componentHandlesDirty)
+        return;
+    m_componentHandlesDirty = true;
+    if (m_nodeManagers != nullptr && !m_handle.isNull())
+        m_nodeManagers->renderNodesManager()->markComponentHandlesDirty(m_handle);
+}
+
+void Entity::updateComponentTypes()
+{
+    ComponentTypes types;
+    if (!m_transformComponent.isNull())
+        types |= TransformComponent;
+    if (!m_cameraComponent.isNull())
+        types |= CameraLensComponent;
+    if (!m_materialComponent.isNull())
+        types |= MaterialComponent;
+    if (!m_layerComponents.isEmpty())
+        types |= LayerComponent;
+    if (!m_levelOfDetailComponents.isEmpty())
+        types |= LevelOfDetailComponent;
+    if (!m_shaderDataComponents.isEmpty())
+        types |= ShaderDataComponent;
+    if (!m_lightComponents.isEmpty())
+        types |= LightComponent;
+    if (!m_environmentLightComponents.isEmpty())
+        types |= EnvironmentLightComponent;
+    if (!m_geometryRendererComponent.isNull())
+        types |= GeometryRendererComponent;
+    if (!m_objectPickerComponent.isNull())
+        types |= ObjectPickerComponent;
+    if (!m_computeComponent.isNull())
+        types |= ComputeCommandComponent;
+
+    if (types == m_componentTypes)
+        return;
+    m_componentTypes = types;
+    if (m_nodeManagers != nullptr && !m_handle.isNull())
+        m_nodeManagers->renderNodesManager()->setComponentTypes(m_handle, types);
+}
+
+namespace {
+
+template<typename Manager, typename Handle>
+bool resolveHandle(Manager *manager, QNodeId id, Handle &handle)
+{
+    if (id.isNull())
+        return true;
+    handle = manager->lookupHandle(id);
+    return !handle.isNull();
+}
+
+template<typename Manager, typename Handle>
+Handle cachedHandle(Manager *manager, QNodeId id, const Handle &handle)
+{
+    if (!handle.isNull() && manager->data(handle) != nullptr)
+        return handle;
+    return manager->lookupHandle(id);
+}
+
+template<typename Manager, typename Handle>
+auto cachedResource(Manager *manager, QNodeId id, const Handle &handle) -> decltype(manager->data(handle))
+{
+    if (!handle.isNull()) {
+        const auto resource = manager->data(handle);
+        if (resource != nullptr)
+            return resource;
+    }
+    return manager->lookupResource(id);
+}
+
+} // anonymous
+
+// Called from the aspect thread before the frame jobs are launched, so that
+// jobs only have to dereference handles instead of going through the id tables.
+// Returns false if one of the components has no backend node yet.
+bool Entity::resolveComponentHandles()
+{
+    if (m_nodeManagers == nullptr)
+        return false;
+
+    bool resolved = resolveHandle(m_nodeManagers->transformManager(), m_transformComponent, m_transformHandle);
+    resolved &= resolveHandle(m_nodeManagers->materialManager(), m_materialComponent, m_materialHandle);
+    resolved &= resolveHandle(m_nodeManagers->cameraManager(), m_cameraComponent, m_cameraHandle);
+    resolved &= resolveHandle(m_nodeManagers->geometryRendererManager(), m_geometryRendererComponent, m_geometryRendererHandle);
+    resolved &= resolveHandle(m_nodeManagers->objectPickerManager(), m_objectPickerComponent, m_objectPickerHandle);
+    resolved &= resolveHandle(m_nodeManagers->computeJobManager(), m_computeComponent, m_computeHandle);
+    m_componentHandlesDirty = !resolved;
+    return resolved;
 }
 
 bool Entity::isBoundingVolumeDirty() const
@@ -392,31 +533,31 @@ void Entity::unsetBoundingVolumeDirty()
 template<>
 HMaterial Entity::componentHandle<Material>() const
 {
-    return m_nodeManagers->materialManager()->lookupHandle(m_materialComponent);
+    return cachedHandle(m_nodeManagers->materialManager(), m_materialComponent, m_materialHandle);
 }
 
 template<>
 HCamera Entity::componentHandle<CameraLens>() const
 {
-    return m_nodeManagers->cameraManager()->lookupHandle(m_cameraComponent);
+    return cachedHandle(m_nodeManagers->cameraManager(), m_cameraComponent, m_cameraHandle);
 }
 
 template<>
 HTransform Entity::componentHandle<Transform>() const
 {
-    return m_nodeManagers->transformManager()->lookupHandle(m_transformComponent);
+    return cachedHandle(m_nodeManagers->transformManager(), m_transformComponent, m_transformHandle);
 }
 
 template<>
 HGeometryRenderer Entity::componentHandle<GeometryRenderer>() const
 {
-    return m_nodeManagers->geometryRendererManager()->lookupHandle(m_geometryRendererComponent);
+    return cachedHandle(m_nodeManagers->geometryRendererManager(), m_geometryRendererComponent, m_geometryRendererHandle);
 }
 
 template<>
 HObjectPicker Entity::componentHandle<ObjectPicker>() const
 {
-    return m_nodeManagers->objectPickerManager()->lookupHandle(m_objectPickerComponent);
+    return cachedHandle(m_nodeManagers->objectPickerManager(), m_objectPickerComponent, m_objectPickerHandle);
 }
 
 template<>
@@ -478,7 +619,7 @@ QVector<HEnvironmentLight> Entity::componentsHandle<EnvironmentLight>() const
 template<>
 HComputeCommand Entity::componentHandle<ComputeCommand>() const
 {
-    return m_nodeManagers->computeJobManager()->lookupHandle(m_computeComponent);
+    return cachedHandle(m_nodeManagers->computeJobManager(), m_computeComponent, m_computeHandle);
 }
 
 // Render components
@@ -486,31 +627,31 @@ HComputeCommand Entity::componentHandle<ComputeCommand>() const
 template<>
 Material *Entity::renderComponent<Material>() const
 {
-    return m_nodeManagers->materialManager()->lookupResource(m_materialComponent);
+    return cachedResource(m_nodeManagers->materialManager(), m_materialComponent, m_materialHandle);
 }
 
 template<>
 CameraLens *Entity::renderComponent<CameraLens>() const
 {
-    return m_nodeManagers->cameraManager()->lookupResource(m_cameraComponent);
+    return cachedResource(m_nodeManagers->cameraManager(), m_cameraComponent, m_cameraHandle);
 }
 
 template<>
 Transform *Entity::renderComponent<Transform>() const
 {
-    return m_nodeManagers->transformManager()->lookupResource(m_transformComponent);
+    return cachedResource(m_nodeManagers->transformManager(), m_transformComponent, m_transformHandle);
 }
 
 template<>
 GeometryRenderer *Entity::renderComponent<GeometryRenderer>() const
 {
-    return m_nodeManagers->geometryRendererManager()->lookupResource(m_geometryRendererComponent);
+    return cachedResource(m_nodeManagers->geometryRendererManager(), m_geometryRendererComponent, m_geometryRendererHandle);
 }
 
 template<>
 ObjectPicker *Entity::renderComponent<ObjectPicker>() const
 {
-    return m_nodeManagers->objectPickerManager()->lookupResource(m_objectPickerComponent);
+    return cachedResource(m_nodeManagers->objectPickerManager(), m_objectPickerComponent, m_objectPickerHandle);
 }
 
 template<>
@@ -572,7 +713,7 @@ QVector<EnvironmentLight *> Entity::renderComponents<EnvironmentLight>() const
 template<>
 ComputeCommand *Entity::renderComponent<ComputeCommand>() const
 {
-    return m_nodeManagers->computeJobManager()->lookupResource(m_computeComponent);
+    return cachedResource(m_nodeManagers->computeJobManager(), m_computeComponent, m_computeHandle);
 }
 
 // Uuid
@@ -639,6 +780,11 @@ void RenderEntityFunctor::destroy(Qt3DCore::QNodeId id) const
     m_nodeManagers->renderNodesManager()->releaseResource(id);
 }
 
+void RenderEntityFunctor::destroy(const QVector<Qt3DCore::QNodeId> &ids) const
+{
+    m_nodeManagers->renderNodesManager()->releaseResources(ids);
+}
+
 } // namespace Render
 } // namespace Qt3DRender
 
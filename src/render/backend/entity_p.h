@@ -56,6 +56,7 @@
 #include <Qt3DRender/private/renderer_p.h>
 #include <Qt3DRender/private/handle_types_p.h>
 #include <Qt3DCore/qnodecreatedchange.h>
+#include <Qt3DCore/private/qbackendnode_p.h>
 #include <Qt3DCore/private/qentity_p.h>
 #include <Qt3DCore/private/qhandle_p.h>
 #include <QVector>
@@ -120,6 +121,9 @@ public:
     void setTreeEnabled(bool enabled) { m_treeEnabled = enabled; }
     bool isTreeEnabled() const { return m_treeEnabled; }
 
+    bool resolveComponentHandles();
+    bool areComponentHandlesDirty() const { return m_componentHandlesDirty; }
+
     template<class Backend, uint INDEXBITS>
     Qt3DCore::QHandle<Backend, INDEXBITS> componentHandle() const
     {
@@ -156,21 +160,46 @@ public:
         return QVector<Qt3DCore::QNodeId>();
     }
 
+    // One bit per component type, the mask of an Entity is its signature in
+    // the archetype table of the EntityManager
+    enum ComponentType {
+        TransformComponent          = 1 << 0,
+        CameraLensComponent         = 1 << 1,
+        MaterialComponent           = 1 << 2,
+        LayerComponent              = 1 << 3,
+        LevelOfDetailComponent      = 1 << 4,
+        ShaderDataComponent         = 1 << 5,
+        LightComponent              = 1 << 6,
+        EnvironmentLightComponent   = 1 << 7,
+        GeometryRendererComponent   = 1 << 8,
+        ObjectPickerComponent       = 1 << 9,
+        ComputeCommandComponent     = 1 << 10
+    };
+    Q_DECLARE_FLAGS(ComponentTypes, ComponentType)
+
+    ComponentTypes componentTypes() const { return m_componentTypes; }
+
     template<typename T>
-    bool containsComponentsOfType() const
+    static ComponentTypes componentTypesOf() Q_DECL_NOTHROW;
+
+    template<typename T, typename Ts, typename ... Ts2>
+    static ComponentTypes componentTypesOf() Q_DECL_NOTHROW
     {
-        return !componentUuid<T>().isNull();
+        return componentTypesOf<T>() | componentTypesOf<Ts, Ts2...>();
     }
 
-    template<typename T, typename Ts, typename ... Ts2>
+    template<typename T, typename ... Ts>
     bool containsComponentsOfType() const
     {
-        return containsComponentsOfType<T>() && containsComponentsOfType<Ts, Ts2...>();
+        const ComponentTypes types = componentTypesOf<T, Ts...>();
+        return (m_componentTypes & types) == types;
     }
 
-
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
+    void markComponentHandlesDirty();
+    void updateComponentTypes();
+    void setLayerMembership(Qt3DCore::QNodeId layerId, bool member);
 
     NodeManagers *m_nodeManagers;
     HEntity m_handle;
@@ -196,12 +225,59 @@ private:
     Qt3DCore::QNodeId m_boundingVolumeDebugComponent;
     Qt3DCore::QNodeId m_computeComponent;
 
+    // Handles resolved from the ids above, refreshed by the EntityManager
+    HTransform m_transformHandle;
+    HMaterial m_materialHandle;
+    HCamera m_cameraHandle;
+    HGeometryRenderer m_geometryRendererHandle;
+    HObjectPicker m_objectPickerHandle;
+    HComputeCommand m_computeHandle;
+
+    ComponentTypes m_componentTypes;
+
     QString m_objectName;
     bool m_boundingDirty;
+    bool m_componentHandlesDirty;
     // true only if this and all parent nodes are enabled
     bool m_treeEnabled;
 };
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(Entity::ComponentTypes)
+
+// Component type bits
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<Transform>() Q_DECL_NOTHROW { return TransformComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<CameraLens>() Q_DECL_NOTHROW { return CameraLensComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<Material>() Q_DECL_NOTHROW { return MaterialComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<Layer>() Q_DECL_NOTHROW { return LayerComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<LevelOfDetail>() Q_DECL_NOTHROW { return LevelOfDetailComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<ShaderData>() Q_DECL_NOTHROW { return ShaderDataComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<Light>() Q_DECL_NOTHROW { return LightComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<EnvironmentLight>() Q_DECL_NOTHROW { return EnvironmentLightComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<GeometryRenderer>() Q_DECL_NOTHROW { return GeometryRendererComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<ObjectPicker>() Q_DECL_NOTHROW { return ObjectPickerComponent; }
+
+template<>
+inline Entity::ComponentTypes Entity::componentTypesOf<ComputeCommand>() Q_DECL_NOTHROW { return ComputeCommandComponent; }
+
 // Handles
 template<>
 HMaterial Entity::componentHandle<Material>() const;
@@ -313,13 +389,14 @@ Q_AUTOTEST_EXPORT QVector<Qt3DCore::QNodeId> Entity::componentsUuid<Light>() con
 template<>
 Q_AUTOTEST_EXPORT QVector<Qt3DCore::QNodeId> Entity::componentsUuid<EnvironmentLight>() const;
 
-class RenderEntityFunctor : public Qt3DCore::QBackendNodeMapper
+class RenderEntityFunctor : public Qt3DCore::QBackendNodeMapper, public Qt3DCore::QBackendNodeBatchDestroyer
 {
 public:
     explicit RenderEntityFunctor(AbstractRenderer *renderer, NodeManagers *manager);
     Qt3DCore::QBackendNode *create(const Qt3DCore::QNodeCreatedChangeBasePtr &change) const Q_DECL_OVERRIDE;
     Qt3DCore::QBackendNode *get(Qt3DCore::QNodeId id) const Q_DECL_OVERRIDE;
     void destroy(Qt3DCore::QNodeId id) const Q_DECL_OVERRIDE;
+    void destroy(const QVector<Qt3DCore::QNodeId> &ids) const Q_DECL_OVERRIDE;
 
 private:
     NodeManagers *m_nodeManagers;
@@ -99,33 +99,33 @@ typedef Qt3DCore::QHandle<RenderTargetOutput, 16> HAttachment;
 typedef Qt3DCore::QHandle<CameraLens, 8> HCamera;
 typedef Qt3DCore::QHandle<FilterKey, 16> HFilterKey;
 typedef Qt3DCore::QHandle<Effect, 16> HEffect;
-typedef Qt3DCore::QHandle<Entity, 16> HEntity;
+typedef Qt3DCore::QHandle<Entity, 32> HEntity;
 typedef Qt3DCore::QHandle<FrameGraphNode *, 8> HFrameGraphNode;
 typedef Qt3DCore::QHandle<Layer, 16> HLayer;
 typedef Qt3DCore::QHandle<LevelOfDetail, 16> HLevelOfDetail;
-typedef Qt3DCore::QHandle<Material, 16> HMaterial;
-typedef Qt3DCore::QHandle<QMatrix4x4, 16> HMatrix;
+typedef Qt3DCore::QHandle<Material, 32> HMaterial;
+typedef Qt3DCore::QHandle<QMatrix4x4, 32> HMatrix;
 typedef Qt3DCore::QHandle<OpenGLVertexArrayObject, 16> HVao;
 typedef Qt3DCore::QHandle<Shader, 16> HShader;
 typedef Qt3DCore::QHandle<Technique, 16> HTechnique;
 typedef Qt3DCore::QHandle<Texture, 16> HTexture;
-typedef Qt3DCore::QHandle<Transform, 16> HTransform;
+typedef Qt3DCore::QHandle<Transform, 32> HTransform;
 typedef Qt3DCore::QHandle<RenderTarget, 8> HTarget;
 typedef Qt3DCore::QHandle<RenderPass, 16> HRenderPass;
 typedef Qt3DCore::QHandle<QTextureImageData, 16> HTextureData;
 typedef Qt3DCore::QHandle<Parameter, 16> HParameter;
 typedef Qt3DCore::QHandle<ShaderData, 16> HShaderData;
 typedef Qt3DCore::QHandle<TextureImage, 16> HTextureImage;
-typedef Qt3DCore::QHandle<Buffer, 16> HBuffer;
-typedef Qt3DCore::QHandle<Attribute, 20> HAttribute;
-typedef Qt3DCore::QHandle<Geometry, 16> HGeometry;
-typedef Qt3DCore::QHandle<GeometryRenderer, 16> HGeometryRenderer;
+typedef Qt3DCore::QHandle<Buffer, 32> HBuffer;
+typedef Qt3DCore::QHandle<Attribute, 32> HAttribute;
+typedef Qt3DCore::QHandle<Geometry, 32> HGeometry;
+typedef Qt3DCore::QHandle<GeometryRenderer, 32> HGeometryRenderer;
 typedef Qt3DCore::QHandle<ObjectPicker, 16> HObjectPicker;
 typedef Qt3DCore::QHandle<BoundingVolumeDebug, 16> HBoundingVolumeDebug;
 typedef Qt3DCore::QHandle<Light, 16> HLight;
 typedef Qt3DCore::QHandle<EnvironmentLight, 16> HEnvironmentLight;
 typedef Qt3DCore::QHandle<ComputeCommand, 16> HComputeCommand;
-typedef Qt3DCore::QHandle<GLBuffer, 16> HGLBuffer;
+typedef Qt3DCore::QHandle<GLBuffer, 32> HGLBuffer;
 typedef Qt3DCore::QHandle<RenderStateNode, 16> HRenderState;
 
 } // namespace Render
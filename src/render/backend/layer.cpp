@@ -64,6 +64,20 @@ Layer::~Layer()
 void Layer::cleanup()
 {
     QBackendNode::setEnabled(false);
+    m_entities.clear();
+}
+
+void Layer::addEntity(uint entityIndex)
+{
+    if (int(entityIndex) >= m_entities.size())
+        m_entities.resize(qMax(int(entityIndex) + 1, m_entities.size() * 2));
+    m_entities.setBit(int(entityIndex));
+}
+
+void Layer::removeEntity(uint entityIndex)
+{
+    if (int(entityIndex) < m_entities.size())
+        m_entities.clearBit(int(entityIndex));
 }
 
 } // namespace Render
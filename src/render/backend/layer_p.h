@@ -54,6 +54,7 @@
 #include <Qt3DRender/private/backendnode_p.h>
 #include <Qt3DRender/qt3drender_global.h>
 #include <QStringList>
+#include <QBitArray>
 
 QT_BEGIN_NAMESPACE
 
@@ -65,12 +66,21 @@ namespace Render {
 
 class LayerManager;
 
-class Layer : public BackendNode
+class Q_AUTOTEST_EXPORT Layer : public BackendNode
 {
 public:
     Layer();
     ~Layer();
     void cleanup();
+
+    // Bit i is set if the Entity with handle index i references the layer,
+    // kept up to date by the Entities as components are added and removed
+    inline const QBitArray &entities() const Q_DECL_NOTHROW { return m_entities; }
+    void addEntity(uint entityIndex);
+    void removeEntity(uint entityIndex);
+
+private:
+    QBitArray m_entities;
 };
 
 } // namespace Render
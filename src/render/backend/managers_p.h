@@ -80,6 +80,8 @@
 #include <Qt3DRender/private/environmentlight_p.h>
 #include <Qt3DRender/private/computecommand_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 namespace Qt3DRender {
@@ -134,7 +136,7 @@ public:
 class Q_AUTOTEST_EXPORT EntityManager : public Qt3DCore::QResourceManager<
         Entity,
         Qt3DCore::QNodeId,
-        16,
+        32,
         Qt3DCore::ArrayAllocatingPolicy,
         Qt3DCore::NonLockingPolicy>
 {
@@ -148,6 +150,81 @@ public:
                 e->setNodeManagers(nullptr);
         }
     }
+
+    // Entities are only marked from the aspect thread (node creation and
+    // scene change events), so no locking is needed here
+    void markComponentHandlesDirty(HEntity handle)
+    {
+        m_dirtyComponentHandles.push_back(handle);
+    }
+
+    void resolveDirtyComponentHandles()
+    {
+        if (m_dirtyComponentHandles.isEmpty())
+            return;
+        QVector<HEntity> unresolved;
+        for (const HEntity &handle : qAsConst(m_dirtyComponentHandles)) {
+            Entity *entity = data(handle);
+            // Entities whose components don't have a backend node yet are retried next frame
+            if (entity != nullptr && entity->areComponentHandlesDirty() && !entity->resolveComponentHandles())
+                unresolved.push_back(handle);
+        }
+        m_dirtyComponentHandles.swap(unresolved);
+    }
+
+    QVector<HEntity> dirtyComponentHandles() const { return m_dirtyComponentHandles; }
+
+    // Archetype table: entities grouped by component signature. Only updated
+    // from the aspect thread, jobs then read it concurrently. Each archetype
+    // is kept in handle index order so that queries only have to merge them
+    void setComponentTypes(HEntity handle, Entity::ComponentTypes types)
+    {
+        const int index = int(handle.index());
+        if (index >= m_archetypeSlots.size())
+            m_archetypeSlots.resize(index + 1);
+        Entity::ComponentTypes &slotTypes = m_archetypeSlots[index];
+        if (slotTypes == types)
+            return;
+
+        if (slotTypes) {
+            auto it = m_archetypes.find(uint(slotTypes));
+            QVector<HEntity> &entities = it.value();
+            entities.erase(std::lower_bound(entities.begin(), entities.end(), handle, handleIndexLessThan));
+            if (entities.isEmpty())
+                m_archetypes.erase(it);
+        }
+
+        slotTypes = types;
+        if (types) {
+            QVector<HEntity> &entities = m_archetypes[uint(types)];
+            entities.insert(std::lower_bound(entities.begin(), entities.end(), handle, handleIndexLessThan), handle);
+        }
+    }
+
+    // Entities having at least all the given component types, in handle index order
+    QVector<HEntity> entitiesWithComponentTypes(Entity::ComponentTypes types) const
+    {
+        QVector<HEntity> handles;
+        for (auto it = m_archetypes.cbegin(), end = m_archetypes.cend(); it != end; ++it) {
+            if ((it.key() & uint(types)) == uint(types)) {
+                const int middle = handles.size();
+                handles += it.value();
+                if (middle > 0)
+                    std::inplace_merge(handles.begin(), handles.begin() + middle, handles.end(), handleIndexLessThan);
+            }
+        }
+        return handles;
+    }
+
+private:
+    static bool handleIndexLessThan(const HEntity &a, const HEntity &b)
+    {
+        return a.index() < b.index();
+    }
+
+    QVector<HEntity> m_dirtyComponentHandles;
+    QVector<Entity::ComponentTypes> m_archetypeSlots;
+    QHash<uint, QVector<HEntity>> m_archetypes;
 };
 
 class FrameGraphNode;
@@ -192,7 +269,7 @@ public:
 class MaterialManager : public Qt3DCore::QResourceManager<
         Material,
         Qt3DCore::QNodeId,
-        16,
+        32,
         Qt3DCore::ArrayAllocatingPolicy,
         Qt3DCore::NonLockingPolicy>
 {
@@ -203,7 +280,7 @@ public:
 class MatrixManager : public Qt3DCore::QResourceManager<
         QMatrix4x4,
         Qt3DCore::QNodeId,
-        16,
+        32,
         Qt3DCore::ArrayAllocatingPolicy,
         Qt3DCore::NonLockingPolicy>
 {
@@ -251,7 +328,7 @@ private:
 class TransformManager : public Qt3DCore::QResourceManager<
         Transform,
         Qt3DCore::QNodeId,
-        16,
+        32,
         Qt3DCore::ArrayAllocatingPolicy,
         Qt3DCore::NonLockingPolicy>
 {
@@ -318,7 +395,7 @@ public:
 class GLBufferManager : public Qt3DCore::QResourceManager<
         GLBuffer,
         Qt3DCore::QNodeId,
-        16,
+        32,
         Qt3DCore::ArrayAllocatingPolicy,
         Qt3DCore::NonLockingPolicy>
 {
@@ -336,7 +413,7 @@ class TextureImageManager : public Qt3DCore::QResourceManager<
 class AttributeManager : public Qt3DCore::QResourceManager<
         Attribute,
         Qt3DCore::QNodeId,
-        20,
+        32,
         Qt3DCore::ArrayAllocatingPolicy,
         Qt3DCore::NonLockingPolicy>
 {
@@ -345,7 +422,7 @@ class AttributeManager : public Qt3DCore::QResourceManager<
 class GeometryManager : public Qt3DCore::QResourceManager<
         Geometry,
         Qt3DCore::QNodeId,
-        16,
+        32,
         Qt3DCore::ArrayAllocatingPolicy,
         Qt3DCore::NonLockingPolicy>
 {
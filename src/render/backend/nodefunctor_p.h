@@ -52,6 +52,7 @@
 //
 
 #include <Qt3DCore/qnode.h>
+#include <Qt3DCore/private/qbackendnode_p.h>
 #include <Qt3DRender/private/backendnode_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -63,7 +64,7 @@ namespace Render {
 class AbstractRenderer;
 
 template<class Backend, class Manager>
-class NodeFunctor : public Qt3DCore::QBackendNodeMapper
+class NodeFunctor : public Qt3DCore::QBackendNodeMapper, public Qt3DCore::QBackendNodeBatchDestroyer
 {
 public:
     explicit NodeFunctor(AbstractRenderer *renderer)
@@ -89,6 +90,11 @@ public:
         m_manager->releaseResource(id);
     }
 
+    void destroy(const QVector<Qt3DCore::QNodeId> &ids) const Q_DECL_FINAL
+    {
+        m_manager->releaseResources(ids);
+    }
+
 private:
     Manager *m_manager;
     AbstractRenderer *m_renderer;
@@ -29,6 +29,7 @@ HEADERS += \
     $$PWD/buffervisitor_p.h \
     $$PWD/bufferutils_p.h \
     $$PWD/trianglesvisitor_p.h \
+    $$PWD/softwaredepthbuffer_p.h \
     $$PWD/abstractrenderer_p.h \
     $$PWD/computecommand_p.h \
     $$PWD/rendersettings_p.h \
@@ -64,6 +65,7 @@ SOURCES += \
     $$PWD/triangleboundingvolume.cpp \
     $$PWD/trianglesextractor.cpp \
     $$PWD/trianglesvisitor.cpp \
+    $$PWD/softwaredepthbuffer.cpp \
     $$PWD/computecommand.cpp \
     $$PWD/rendersettings.cpp \
     $$PWD/stringtoint.cpp \
@@ -46,6 +46,7 @@ namespace Render {
 
 RenderCommand::RenderCommand()
     : m_stateSet(nullptr)
+    , m_instanceTransformLocation(-1)
     , m_depth(0.0f)
     , m_changeCost(0)
     , m_type(RenderCommand::Draw)
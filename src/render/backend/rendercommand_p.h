@@ -56,6 +56,7 @@
 #include <Qt3DRender/private/shaderparameterpack_p.h>
 #include <Qt3DRender/private/handle_types_p.h>
 #include <Qt3DRender/qgeometryrenderer.h>
+#include <Qt3DRender/qattribute.h>
 #include <QOpenGLShaderProgram>
 #include <QOpenGLTexture>
 #include <QMatrix4x4>
@@ -70,6 +71,56 @@ namespace Render {
 
 class RenderStateSet;
 
+// One indexed draw of a multi draw submission. The layout matches the
+// DrawElementsIndirectCommand structure so that ranges can be uploaded as is
+// to an indirect draw buffer
+struct MultiDrawRange
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+};
+QT3D_DECLARE_TYPEINFO_2(Qt3DRender, Render, MultiDrawRange, Q_PRIMITIVE_TYPE)
+
+// Where a vertex attribute read by the shader sources its data from. Two
+// attributes with the same layout feed the same values to the shader, even
+// when they belong to different geometries
+struct VertexAttributeLayout
+{
+    VertexAttributeLayout()
+        : nameId(-1)
+        , vertexBaseType(QAttribute::Float)
+        , vertexSize(0)
+        , byteOffset(0)
+        , byteStride(0)
+        , divisor(0)
+    {}
+
+    Qt3DCore::QNodeId bufferId;
+    int nameId;
+    QAttribute::VertexBaseType vertexBaseType;
+    uint vertexSize;
+    uint byteOffset;
+    uint byteStride;
+    uint divisor;
+};
+QT3D_DECLARE_TYPEINFO_2(Qt3DRender, Render, VertexAttributeLayout, Q_PRIMITIVE_TYPE)
+
+inline bool operator==(const VertexAttributeLayout &a, const VertexAttributeLayout &b)
+{
+    return a.bufferId == b.bufferId && a.nameId == b.nameId
+            && a.vertexBaseType == b.vertexBaseType && a.vertexSize == b.vertexSize
+            && a.byteOffset == b.byteOffset && a.byteStride == b.byteStride
+            && a.divisor == b.divisor;
+}
+
+inline bool operator!=(const VertexAttributeLayout &a, const VertexAttributeLayout &b)
+{
+    return !(a == b);
+}
+
 class Q_AUTOTEST_EXPORT RenderCommand
 {
 public:
@@ -91,6 +142,20 @@ public:
     // This is a temporary fix in the meantime, to remove the hacked methods in Technique
     QVector<int> m_attributes;
 
+    // World transforms fed to the instanceModelMatrix attribute, one per
+    // instance once identical commands have been merged
+    QVector<QMatrix4x4> m_instanceTransforms;
+    int m_instanceTransformLocation;
+
+    // Layouts of the vertex attributes used by the shader, sorted by name,
+    // and index buffer. Commands reading their vertices from the same buffer
+    // ranges can be drawn with a single multi draw call.
+    QVector<VertexAttributeLayout> m_vertexAttributeLayouts;
+    Qt3DCore::QNodeId m_indexBufferId;
+    // Draws of the commands merged into this one, the command draws itself
+    // through these when not empty
+    QVector<MultiDrawRange> m_multiDrawRanges;
+
     float m_depth;
     int m_changeCost;
     uint m_shaderDna;
@@ -162,6 +162,7 @@ Renderer::Renderer(QRenderAspect::RenderType type)
     , m_pickEventFilter(new PickEventFilter())
     , m_exposed(0)
     , m_changeSet(0)
+    , m_frameGraphDirty(true)
     , m_lastFrameCorrect(0)
     , m_glContext(nullptr)
     , m_shareContext(nullptr)
@@ -180,6 +181,9 @@ Renderer::Renderer(QRenderAspect::RenderType type)
     , m_updateLevelOfDetailJob(Render::UpdateLevelOfDetailJobPtr::create())
     , m_updateMeshTriangleListJob(Render::UpdateMeshTriangleListJobPtr::create())
     , m_filterCompatibleTechniqueJob(Render::FilterCompatibleTechniqueJobPtr::create())
+    , m_renderableEntityFilterJob(Render::RenderableEntityFilterPtr::create())
+    , m_computableEntityFilterJob(Render::ComputableEntityFilterPtr::create())
+    , m_lightGathererJob(Render::LightGathererPtr::create())
     , m_bufferGathererJob(Render::GenericLambdaJobPtr<std::function<void ()>>::create([this] { lookForDirtyBuffers(); }, JobTypes::DirtyBufferGathering))
     , m_vaoGathererJob(Render::GenericLambdaJobPtr<std::function<void ()>>::create([this] { lookForAbandonedVaos(); }, JobTypes::DirtyVaoGathering))
     , m_textureGathererJob(Render::GenericLambdaJobPtr<std::function<void ()>>::create([this] { lookForDirtyTextures(); }, JobTypes::DirtyTextureGathering))
@@ -277,6 +281,9 @@ void Renderer::setNodeManagers(NodeManagers *managers)
     m_updateLevelOfDetailJob->setManagers(m_nodesManager);
     m_updateMeshTriangleListJob->setManagers(m_nodesManager);
     m_filterCompatibleTechniqueJob->setManager(m_nodesManager->techniqueManager());
+    m_renderableEntityFilterJob->setManager(m_nodesManager->renderNodesManager());
+    m_computableEntityFilterJob->setManager(m_nodesManager->renderNodesManager());
+    m_lightGathererJob->setManager(m_nodesManager->renderNodesManager());
 }
 
 NodeManagers *Renderer::nodeManagers() const
@@ -434,6 +441,7 @@ void Renderer::releaseGraphicsResources()
             GLBuffer *buffer = m_nodesManager->glBufferManager()->data(bufferHandle);
             buffer->destroy(m_graphicsContext.data());
         }
+        m_graphicsContext->destroyGeneratedBuffers();
 
         // Do the same thing with VAOs
         const QVector<HVao> activeVaos = m_nodesManager->vaoManager()->activeHandles();
@@ -509,6 +517,7 @@ void Renderer::registerEventFilter(QEventFilterService *service)
 void Renderer::setSettings(RenderSettings *settings)
 {
     m_settings = settings;
+    m_frameGraphDirty = true;
 }
 
 RenderSettings *Renderer::settings() const
@@ -599,6 +608,9 @@ void Renderer::doRender()
                         m_graphicsContext->setCurrentStateSet(nullptr);
                     beganDrawing = m_graphicsContext->beginDrawing(surface);
                     if (beganDrawing) {
+                        // Textures activated from now on are used by this frame
+                        m_graphicsContext->setCurrentFrame(m_graphicsContext->currentFrame() + 1);
+                        m_nodesManager->glTextureManager()->setCurrentFrame(m_graphicsContext->currentFrame());
                         // 1) Execute commands for buffer uploads, texture updates, shader loading first
                         updateGLResources();
                         // 2) Update VAO and copy data into commands to allow concurrent submission
@@ -773,6 +785,8 @@ QSurfaceFormat Renderer::format()
 }
 
 // When this function is called, we must not be processing the commands for frame n+1
+// The draw parameters and the uniforms to submit were resolved by the RenderView
+// jobs, only the resources requiring the GL context are updated here
 void Renderer::prepareCommandsSubmission(const QVector<RenderView *> &renderViews)
 {
     OpenGLVertexArrayObject *vao = nullptr;
@@ -835,85 +849,6 @@ void Renderer::prepareCommandsSubmission(const QVector<RenderView *> &renderView
                 // so we cannot unset its dirtiness at this point
                 if (rGeometryRenderer->isDirty())
                     rGeometryRenderer->unsetDirty();
-
-                // Prepare the ShaderParameterPack based on the active uniforms of the shader
-                shader->prepareUniforms(command->m_parameterPack);
-
-                // TO DO: The step below could be performed by the RenderCommand builder job
-                { // Scoped to show extent
-                    command->m_isValid = !command->m_attributes.empty();
-                    if (!command->m_isValid)
-                        continue;
-
-                    // Update the draw command with what's going to be needed for the drawing
-                    uint primitiveCount = rGeometryRenderer->vertexCount();
-                    uint estimatedCount = 0;
-                    Attribute *indexAttribute = nullptr;
-                    Attribute *indirectAttribute = nullptr;
-
-                    const QVector<Qt3DCore::QNodeId> attributeIds = rGeometry->attributes();
-                    for (Qt3DCore::QNodeId attributeId : attributeIds) {
-                        Attribute *attribute = m_nodesManager->attributeManager()->lookupResource(attributeId);
-                        switch (attribute->attributeType()) {
-                        case QAttribute::IndexAttribute:
-                            indexAttribute = attribute;
-                            break;
-                        case QAttribute::DrawIndirectAttribute:
-                            indirectAttribute = attribute;
-                            break;
-                        case QAttribute::VertexAttribute: {
-                            if (command->m_attributes.contains(attribute->nameId()))
-                                estimatedCount = qMax(attribute->count(), estimatedCount);
-                            break;
-                        }
-                        default:
-                            Q_UNREACHABLE();
-                            break;
-                        }
-                    }
-
-                    command->m_drawIndexed = (indexAttribute != nullptr);
-                    command->m_drawIndirect = (indirectAttribute != nullptr);
-
-                    // Update the draw command with all the information required for the drawing
-                    if (command->m_drawIndexed) {
-                        command->m_indexAttributeDataType = GraphicsContext::glDataTypeFromAttributeDataType(indexAttribute->vertexBaseType());
-                        command->m_indexAttributeByteOffset = indexAttribute->byteOffset();
-                    }
-
-                    // Note: we only care about the primitiveCount when using direct draw calls
-                    // For indirect draw calls it is assumed the buffer was properly set already
-                    if (command->m_drawIndirect) {
-                        command->m_indirectAttributeByteOffset = indirectAttribute->byteOffset();
-                        command->m_indirectDrawBuffer = m_nodesManager->bufferManager()->lookupHandle(indirectAttribute->bufferId());
-                    } else {
-                        // Use the count specified by the GeometryRender
-                        // If not specify use the indexAttribute count if present
-                        // Otherwise tries to use the count from the attribute with the highest count
-                        if (primitiveCount == 0) {
-                            if (indexAttribute)
-                                primitiveCount = indexAttribute->count();
-                            else
-                                primitiveCount = estimatedCount;
-                        }
-                    }
-
-                    command->m_primitiveCount = primitiveCount;
-                    command->m_primitiveType = rGeometryRenderer->primitiveType();
-                    command->m_primitiveRestartEnabled = rGeometryRenderer->primitiveRestartEnabled();
-                    command->m_restartIndexValue = rGeometryRenderer->restartIndexValue();
-                    command->m_firstInstance = rGeometryRenderer->firstInstance();
-                    command->m_instanceCount = rGeometryRenderer->instanceCount();
-                    command->m_firstVertex = rGeometryRenderer->firstVertex();
-                    command->m_indexOffset = rGeometryRenderer->indexOffset();
-                    command->m_verticesPerPatch = rGeometryRenderer->verticesPerPatch();
-                } // scope
-            } else if (command->m_type == RenderCommand::Compute) {
-                Shader *shader = m_nodesManager->data<Shader, ShaderManager>(command->m_shader);
-                Q_ASSERT(shader);
-
-                // Prepare the ShaderParameterPack based on the active uniforms of the shader
-                shader->prepareUniforms(command->m_parameterPack);
             }
         }
     }
@@ -1052,11 +987,10 @@ void Renderer::updateGLResources()
     // Note: we perform this step in second so that the previous updateTexture call
     // has a chance to find a shared texture
     const QVector<Qt3DCore::QNodeId> cleanedUpTextureIds = m_nodesManager->textureManager()->takeTexturesIdsToCleanup();
-    for (const Qt3DCore::QNodeId textureCleanedUpId: cleanedUpTextureIds) {
+    for (const Qt3DCore::QNodeId textureCleanedUpId: cleanedUpTextureIds)
         cleanupTexture(m_nodesManager->textureManager()->lookupResource(textureCleanedUpId));
-        // We can really release the texture at this point
-        m_nodesManager->textureManager()->releaseResource(textureCleanedUpId);
-    }
+    // We can really release the textures at this point
+    m_nodesManager->textureManager()->releaseResources(cleanedUpTextureIds);
 }
 
 // Render Thread
@@ -1348,6 +1282,12 @@ void Renderer::markDirty(BackendNodeDirtySet changes, BackendNode *node)
 {
     Q_UNUSED(node);
     m_changeSet |= changes;
+    // Gathered material parameters are reused until the material system changes
+    if (changes & AbstractRenderer::MaterialDirty)
+        m_materialParameterGathererCache.clear();
+    // The RenderView jobs are reused until the frame graph changes
+    if (changes & AbstractRenderer::FrameGraphDirty)
+        m_frameGraphDirty = true;
 }
 
 Renderer::BackendNodeDirtySet Renderer::dirtyBits()
@@ -1386,6 +1326,9 @@ QVector<Qt3DCore::QAspectJobPtr> Renderer::renderBinJobs()
 {
     QVector<QAspectJobPtr> renderBinJobs;
 
+    // Refresh the component handles cached on entities before jobs read them
+    m_nodesManager->renderNodesManager()->resolveDirtyComponentHandles();
+
     // Create the jobs to build the frame
     const QVector<QAspectJobPtr> bufferJobs = createRenderBufferJobs();
 
@@ -1433,18 +1376,37 @@ QVector<Qt3DCore::QAspectJobPtr> Renderer::renderBinJobs()
         // RenderView and set its configuration then create a job to
         // populate the RenderView with a set of RenderCommands that get
         // their details from the RenderNodes that are visible to the
-        // Camera selected by the framegraph configuration
-        FrameGraphVisitor visitor(m_nodesManager->frameGraphManager());
-        const QVector<FrameGraphNode *> fgLeaves = visitor.traverse(frameGraphRoot());
-
-        const int fgBranchCount = fgLeaves.size();
-        for (int i = 0; i < fgBranchCount; ++i) {
-            RenderViewBuilder builder(fgLeaves.at(i), i, this);
-            renderBinJobs.append(builder.buildJobHierachy());
+        // Camera selected by the framegraph configuration. The jobs and
+        // their dependencies are kept and reused for the following frames
+        // until the framegraph is modified.
+        if (m_frameGraphDirty) {
+            m_renderViewBuilders.clear();
+            m_renderViewJobs.clear();
+
+            FrameGraphVisitor visitor(m_nodesManager->frameGraphManager());
+            const QVector<FrameGraphNode *> fgLeaves = visitor.traverse(frameGraphRoot());
+
+            const int fgBranchCount = fgLeaves.size();
+            m_renderViewBuilders.reserve(fgBranchCount);
+            for (int i = 0; i < fgBranchCount; ++i) {
+                QSharedPointer<RenderViewBuilder> builder = QSharedPointer<RenderViewBuilder>::create(fgLeaves.at(i), i, this);
+                m_renderViewJobs.append(builder->buildJobHierachy());
+                m_renderViewBuilders.push_back(builder);
+            }
+            m_frameGraphDirty = false;
+        } else {
+            for (const QSharedPointer<RenderViewBuilder> &builder : qAsConst(m_renderViewBuilders))
+                builder->prepareJobs();
         }
+        // Entity scans which don't depend on the RenderView configuration
+        // are performed once and shared by all the RenderViews
+        renderBinJobs.push_back(m_renderableEntityFilterJob);
+        renderBinJobs.push_back(m_computableEntityFilterJob);
+        renderBinJobs.push_back(m_lightGathererJob);
+        renderBinJobs.append(m_renderViewJobs);
 
         // Set target number of RenderViews
-        m_renderQueue->setTargetRenderViewCount(fgBranchCount);
+        m_renderQueue->setTargetRenderViewCount(m_renderViewBuilders.size());
     }
 
     return renderBinJobs;
@@ -1512,15 +1474,19 @@ void Renderer::performDraw(RenderCommand *command)
         }
 
     } else { // Direct Draw Calls
-        // TO DO: Add glMulti Draw variants
         if (command->m_primitiveType == QGeometryRenderer::Patches)
             m_graphicsContext->setVerticesPerPatch(command->m_verticesPerPatch);
 
         if (command->m_primitiveRestartEnabled)
             m_graphicsContext->enablePrimitiveRestart(command->m_restartIndexValue);
 
-        // TO DO: Add glMulti Draw variants
-        if (command->m_drawIndexed) {
+        // Commands batched by the RenderView draw each merged geometry
+        if (!command->m_multiDrawRanges.isEmpty()) {
+            Profiling::GLTimeRecorder recorder(Profiling::DrawElement);
+            m_graphicsContext->multiDrawElements(command->m_primitiveType,
+                                                 command->m_indexAttributeDataType,
+                                                 command->m_multiDrawRanges);
+        } else if (command->m_drawIndexed) {
             Profiling::GLTimeRecorder recorder(Profiling::DrawElement);
             m_graphicsContext->drawElementsInstancedBaseVertexBaseInstance(command->m_primitiveType,
                                                                            command->m_primitiveCount,
@@ -1612,11 +1578,13 @@ bool Renderer::executeCommandsSubmission(const RenderView *rv)
     // Save the RenderView base stateset
     RenderStateSet *globalState = m_graphicsContext->currentStateSet();
     OpenGLVertexArrayObject *vao = nullptr;
+    OpenGLVertexArrayObject *boundVao = nullptr;
 
     for (RenderCommand *command : qAsConst(commands)) {
 
         if (command->m_type == RenderCommand::Compute) { // Compute Call
             performCompute(rv, command);
+            boundVao = nullptr;
         } else { // Draw Command
             // Check if we have a valid command that can be drawn
             if (!command->m_isValid) {
@@ -1643,8 +1611,13 @@ bool Renderer::executeCommandsSubmission(const RenderView *rv)
 
             {
                 Profiling::GLTimeRecorder recorder(Profiling::VAOUpdate);
-                // Bind VAO
-                vao->bind();
+                // Bind VAO, consecutive commands often share the same one
+                if (vao != boundVao) {
+                    vao->bind();
+                    boundVao = vao;
+                } else {
+                    m_graphicsContext->glStateShadow()->countRedundantCall(GLStateShadow::VertexArrayBinding);
+                }
             }
 
             {
@@ -1674,8 +1647,22 @@ bool Renderer::executeCommandsSubmission(const RenderView *rv)
             // Uniforms for Effect, Material and Technique should already have been correctly resolved
             // at that point
 
+            // Per instance world transforms are streamed for each draw, the
+            // divisor lets all the instances of an entity share its transform
+            const bool hasInstanceTransforms = !command->m_instanceTransforms.isEmpty();
+            if (hasInstanceTransforms) {
+                Profiling::GLTimeRecorder recorder(Profiling::VAOUpdate);
+                const int divisor = qMax(1, command->m_instanceCount / command->m_instanceTransforms.size());
+                m_graphicsContext->specifyInstanceTransforms(command->m_instanceTransforms,
+                                                             command->m_instanceTransformLocation,
+                                                             divisor);
+            }
+
             //// Draw Calls
             performDraw(command);
+
+            if (hasInstanceTransforms)
+                m_graphicsContext->releaseInstanceTransforms(command->m_instanceTransformLocation);
         }
     } // end of RenderCommands loop
 
@@ -1784,6 +1771,24 @@ void Renderer::cleanGraphicsResources()
         delete tex;
     }
 
+    // Evict the least recently used textures when over the texture memory budget
+    GLTextureManager *glTextureManager = m_nodesManager->glTextureManager();
+    glTextureManager->setTextureMemoryBudget(m_settings ? qint64(m_settings->textureMemoryBudget()) * 1024 * 1024 : 0);
+    const QVector<GLTexture*> texturesToEvict = glTextureManager->takeTexturesToEvict(m_graphicsContext->currentFrame());
+    for (GLTexture *tex : texturesToEvict)
+        tex->evictGLTexture();
+    if (!texturesToEvict.empty()) {
+        const TextureResidencyStatistics stats = glTextureManager->residencyStatistics();
+        qCDebug(Memory) << "Evicted" << stats.evictedTextures << "textures,"
+                        << stats.residentTextures << "textures using" << stats.residentSize
+                        << "bytes out of a budget of" << stats.budget << "remain on the GPU";
+    }
+
+    // Release the uniform buffers generated for ShaderData and shaders that
+    // are no longer drawn
+    const qint64 maxUnusedUniformBufferFrames = 60;
+    m_graphicsContext->releaseUnusedUniformBlockBuffers(maxUnusedUniformBufferFrames);
+
     // Delete abandoned VAOs
     m_abandonedVaosMutex.lock();
     const QVector<HVao> abandonedVaos = std::move(m_abandonedVaos);
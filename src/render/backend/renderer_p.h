@@ -75,6 +75,9 @@
 #include <Qt3DRender/private/genericlambdajob_p.h>
 #include <Qt3DRender/private/updatemeshtrianglelistjob_p.h>
 #include <Qt3DRender/private/filtercompatibletechniquejob_p.h>
+#include <Qt3DRender/private/filterentitybycomponentjob_p.h>
+#include <Qt3DRender/private/lightgatherer_p.h>
+#include <Qt3DRender/private/materialparametergatherercache_p.h>
 
 #include <QHash>
 #include <QMatrix4x4>
@@ -131,6 +134,7 @@ class Entity;
 class RenderCommand;
 class RenderQueue;
 class RenderView;
+class RenderViewBuilder;
 class Effect;
 class RenderPass;
 class RenderThread;
@@ -202,6 +206,10 @@ public:
     inline UpdateLevelOfDetailJobPtr updateLevelOfDetailJob() const { return m_updateLevelOfDetailJob; }
     inline UpdateMeshTriangleListJobPtr updateMeshTriangleListJob() const { return m_updateMeshTriangleListJob; }
     inline FilterCompatibleTechniqueJobPtr filterCompatibleTechniqueJob() const { return m_filterCompatibleTechniqueJob; }
+    inline RenderableEntityFilterPtr renderableEntityFilterJob() const { return m_renderableEntityFilterJob; }
+    inline ComputableEntityFilterPtr computableEntityFilterJob() const { return m_computableEntityFilterJob; }
+    inline LightGathererPtr lightGathererJob() const { return m_lightGathererJob; }
+    inline MaterialParameterGathererCache *materialParameterGathererCache() { return &m_materialParameterGathererCache; }
     inline SynchronizerJobPtr textureLoadSyncJob() const { return m_syncTextureLoadingJob; }
 
     Qt3DCore::QAbstractFrameAdvanceService *frameAdvanceService() const Q_DECL_OVERRIDE;
@@ -302,6 +310,9 @@ private:
     QVector<Geometry *> m_dirtyGeometry;
     QAtomicInt m_exposed;
     BackendNodeDirtySet m_changeSet;
+    bool m_frameGraphDirty;
+    QVector<QSharedPointer<RenderViewBuilder>> m_renderViewBuilders;
+    QVector<Qt3DCore::QAspectJobPtr> m_renderViewJobs;
     QAtomicInt m_lastFrameCorrect;
     QOpenGLContext *m_glContext;
     QOpenGLContext *m_shareContext;
@@ -323,6 +334,10 @@ private:
     UpdateLevelOfDetailJobPtr m_updateLevelOfDetailJob;
     UpdateMeshTriangleListJobPtr m_updateMeshTriangleListJob;
     FilterCompatibleTechniqueJobPtr m_filterCompatibleTechniqueJob;
+    RenderableEntityFilterPtr m_renderableEntityFilterJob;
+    ComputableEntityFilterPtr m_computableEntityFilterJob;
+    LightGathererPtr m_lightGathererJob;
+    MaterialParameterGathererCache m_materialParameterGathererCache;
 
     QVector<Qt3DCore::QNodeId> m_pendingRenderCaptureSendRequests;
 
@@ -57,6 +57,7 @@ RenderSettings::RenderSettings()
     , m_pickMethod(QPickingSettings::BoundingVolumePicking)
     , m_pickResultMode(QPickingSettings::NearestPick)
     , m_faceOrientationPickingMode(QPickingSettings::FrontFace)
+    , m_textureMemoryBudget(0)
     , m_activeFrameGraph()
 {
 }
@@ -70,6 +71,7 @@ void RenderSettings::initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePt
     m_pickMethod = data.pickMethod;
     m_pickResultMode = data.pickResultMode;
     m_faceOrientationPickingMode = data.faceOrientationPickingMode;
+    m_textureMemoryBudget = data.textureMemoryBudget;
 }
 
 void RenderSettings::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
@@ -82,10 +84,14 @@ void RenderSettings::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
             m_pickResultMode = propertyChange->value().value<QPickingSettings::PickResultMode>();
         else if (propertyChange->propertyName() == QByteArrayLiteral("faceOrientationPickingMode"))
             m_faceOrientationPickingMode = propertyChange->value().value<QPickingSettings::FaceOrientationPickingMode>();
-        else if (propertyChange->propertyName() == QByteArrayLiteral("activeFrameGraph"))
+        else if (propertyChange->propertyName() == QByteArrayLiteral("activeFrameGraph")) {
             m_activeFrameGraph = propertyChange->value().value<QNodeId>();
+            markDirty(AbstractRenderer::FrameGraphDirty);
+        }
         else if (propertyChange->propertyName() == QByteArrayLiteral("renderPolicy"))
             m_renderPolicy = propertyChange->value().value<QRenderSettings::RenderPolicy>();
+        else if (propertyChange->propertyName() == QByteArrayLiteral("textureMemoryBudget"))
+            m_textureMemoryBudget = propertyChange->value().toInt();
         markDirty(AbstractRenderer::AllDirty);
     }
 
@@ -74,6 +74,7 @@ public:
     QPickingSettings::PickMethod pickMethod() const { return m_pickMethod; }
     QPickingSettings::PickResultMode pickResultMode() const { return m_pickResultMode; }
     QPickingSettings::FaceOrientationPickingMode faceOrientationPickingMode() const { return m_faceOrientationPickingMode; }
+    int textureMemoryBudget() const { return m_textureMemoryBudget; }
 
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
@@ -82,6 +83,7 @@ private:
     QPickingSettings::PickMethod m_pickMethod;
     QPickingSettings::PickResultMode m_pickResultMode;
     QPickingSettings::FaceOrientationPickingMode m_faceOrientationPickingMode;
+    int m_textureMemoryBudget;
     Qt3DCore::QNodeId m_activeFrameGraph;
 };
 
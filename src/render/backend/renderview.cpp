@@ -96,6 +96,8 @@ const int MAX_LIGHTS = 8;
 #define LIGHT_INTENSITY_NAME QLatin1String(".intensity")
 
 int LIGHT_COUNT_NAME_ID = 0;
+int INSTANCE_MODEL_MATRIX_NAME_ID = 0;
+int VIEW_UNIFORM_BLOCK_NAME_ID = 0;
 int LIGHT_POSITION_NAMES[MAX_LIGHTS];
 int LIGHT_TYPE_NAMES[MAX_LIGHTS];
 int LIGHT_COLOR_NAMES[MAX_LIGHTS];
@@ -214,6 +216,7 @@ UniformValue RenderView::standardUniformValue(RenderView::StandardUniform standa
 RenderView::RenderView()
     : m_isDownloadBuffersEnable(false)
     , m_renderer(nullptr)
+    , m_manager(nullptr)
     , m_devicePixelRatio(1.)
     , m_viewport(QRectF(0.0f, 0.0f, 1.0f, 1.0f))
     , m_gamma(2.2f)
@@ -223,6 +226,9 @@ RenderView::RenderView()
     , m_noDraw(false)
     , m_compute(false)
     , m_frustumCulling(false)
+    , m_occlusionCulling(false)
+    , m_instancing(false)
+    , m_multiDraw(false)
     , m_memoryBarrier(QMemoryBarrier::None)
     , m_environmentLight(nullptr)
 {
@@ -236,6 +242,8 @@ RenderView::RenderView()
         wasInitialized = true;
         RenderView::ms_standardUniformSetters = RenderView::initializeStandardUniformSetters();
         LIGHT_COUNT_NAME_ID = StringToInt::lookupId(QLatin1String("lightCount"));
+        INSTANCE_MODEL_MATRIX_NAME_ID = StringToInt::lookupId(QLatin1String("instanceModelMatrix"));
+        VIEW_UNIFORM_BLOCK_NAME_ID = StringToInt::lookupId(QLatin1String("qt3d_render_view_uniforms"));
         for (int i = 0; i < MAX_LIGHTS; ++i) {
             Q_STATIC_ASSERT_X(MAX_LIGHTS < 10, "can't use the QChar trick anymore");
             LIGHT_STRUCT_NAMES[i] = QLatin1String("lights[") + QLatin1Char(char('0' + i)) + QLatin1Char(']');
@@ -420,12 +428,226 @@ void sortCommandRange(QVector<RenderCommand *> &commands, int begin, const int e
     }
 }
 
+bool haveSameRenderStates(RenderStateSet *a, RenderStateSet *b)
+{
+    if (a == nullptr || b == nullptr)
+        return a == b;
+    return a->changeCost(b) == 0 && b->changeCost(a) == 0;
+}
+
+bool haveSameBuffers(const ShaderParameterPack &a, const ShaderParameterPack &b)
+{
+    const QVector<BlockToUBO> ubosA = a.uniformBuffers();
+    const QVector<BlockToUBO> ubosB = b.uniformBuffers();
+    if (ubosA.size() != ubosB.size())
+        return false;
+    for (int i = 0, m = ubosA.size(); i < m; ++i) {
+        if (ubosA.at(i).m_blockIndex != ubosB.at(i).m_blockIndex ||
+                ubosA.at(i).m_bufferID != ubosB.at(i).m_bufferID ||
+                ubosA.at(i).m_data != ubosB.at(i).m_data)
+            return false;
+    }
+
+    const QVector<BlockToSSBO> ssbosA = a.shaderStorageBuffers();
+    const QVector<BlockToSSBO> ssbosB = b.shaderStorageBuffers();
+    if (ssbosA.size() != ssbosB.size())
+        return false;
+    for (int i = 0, m = ssbosA.size(); i < m; ++i) {
+        if (ssbosA.at(i).m_blockIndex != ssbosB.at(i).m_blockIndex ||
+                ssbosA.at(i).m_bufferID != ssbosB.at(i).m_bufferID)
+            return false;
+    }
+    return true;
+}
+
+int attributeLocation(const Shader *shader, int nameId)
+{
+    const QVector<ShaderAttribute> attributes = shader->attributes();
+    for (const ShaderAttribute &attribute : attributes) {
+        if (attribute.m_nameId == nameId)
+            return attribute.m_location;
+    }
+    return -1;
+}
+
+MultiDrawRange multiDrawRange(const RenderCommand *command, int baseInstance)
+{
+    MultiDrawRange range;
+    range.count = GLuint(command->m_primitiveCount);
+    range.instanceCount = GLuint(qMax(1, command->m_instanceTransforms.size()));
+    range.firstIndex = command->m_indexAttributeByteOffset / qMax(GLuint(1), GraphicsContext::byteSizeFromType(command->m_indexAttributeDataType));
+    range.baseVertex = command->m_indexOffset;
+    range.baseInstance = GLuint(baseInstance);
+    return range;
+}
+
 } // anonymous
 
+bool RenderView::isPerObjectUniform(int glslNameId)
+{
+    const auto it = ms_standardUniformSetters.constFind(glslNameId);
+    if (it == ms_standardUniformSetters.cend())
+        return false;
+
+    switch (it.value()) {
+    case ModelMatrix:
+    case ModelViewMatrix:
+    case ModelViewProjectionMatrix:
+    case InverseModelMatrix:
+    case InverseModelViewMatrix:
+    case InverseModelViewProjectionMatrix:
+    case ModelNormalMatrix:
+    case ModelViewNormalMatrix:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns whether both commands use the same shader, states and parameters.
+// Model dependent uniforms are ignored when the commands draw with instance
+// transforms
+bool RenderView::haveSameDrawParameters(const RenderCommand *a, const RenderCommand *b, bool ignorePerObjectUniforms)
+{
+    if (a->m_type != RenderCommand::Draw || b->m_type != RenderCommand::Draw)
+        return false;
+    if (!a->m_isValid || !b->m_isValid)
+        return false;
+    // Don't interfere with geometries that are already instanced or
+    // whose draw parameters come from a buffer
+    if (a->m_instanceCount != 1 || b->m_instanceCount != 1 || a->m_firstInstance != 0 || b->m_firstInstance != 0)
+        return false;
+    if (a->m_drawIndirect || b->m_drawIndirect)
+        return false;
+    if (a->m_shaderDna != b->m_shaderDna)
+        return false;
+    if (!haveSameRenderStates(a->m_stateSet, b->m_stateSet))
+        return false;
+    if (!haveSameBuffers(a->m_parameterPack, b->m_parameterPack))
+        return false;
+
+    // Textures are compared through the uniforms referencing them
+    const PackUniformHash &uniformsA = a->m_parameterPack.uniforms();
+    const PackUniformHash &uniformsB = b->m_parameterPack.uniforms();
+    if (uniformsA.size() != uniformsB.size())
+        return false;
+    for (auto it = uniformsA.cbegin(), end = uniformsA.cend(); it != end; ++it) {
+        const auto other = uniformsB.constFind(it.key());
+        if (other == uniformsB.cend())
+            return false;
+        if (ignorePerObjectUniforms && isPerObjectUniform(it.key()))
+            continue;
+        if (!(other.value() == it.value()))
+            return false;
+    }
+    return true;
+}
+
+// Two commands can be drawn with a single instanced draw call if they only
+// differ by their world transform
+bool RenderView::canBeInstancedTogether(const RenderCommand *a, const RenderCommand *b)
+{
+    if (a->m_instanceTransforms.isEmpty() || b->m_instanceTransforms.isEmpty())
+        return false;
+    if (a->m_geometry != b->m_geometry || a->m_geometryRenderer != b->m_geometryRenderer)
+        return false;
+    return haveSameDrawParameters(a, b, true);
+}
+
+// Two commands can be drawn with a single multi draw call if the vertex
+// attributes of their geometries have the same layouts in the same buffers
+// and if they share their index buffer. Without instance
+// transforms, every uniform has to match as they can't vary per draw
+bool RenderView::canBeMultiDrawnTogether(const RenderCommand *a, const RenderCommand *b)
+{
+    if (!a->m_drawIndexed || !b->m_drawIndexed)
+        return false;
+    if (a->m_firstVertex != 0 || b->m_firstVertex != 0)
+        return false;
+    if (a->m_primitiveType != b->m_primitiveType ||
+            a->m_indexAttributeDataType != b->m_indexAttributeDataType ||
+            a->m_primitiveRestartEnabled != b->m_primitiveRestartEnabled ||
+            a->m_restartIndexValue != b->m_restartIndexValue ||
+            a->m_verticesPerPatch != b->m_verticesPerPatch)
+        return false;
+    if (a->m_indexBufferId.isNull() || a->m_indexBufferId != b->m_indexBufferId)
+        return false;
+    if (a->m_vertexAttributeLayouts.isEmpty() || a->m_vertexAttributeLayouts != b->m_vertexAttributeLayouts)
+        return false;
+    const bool hasInstanceTransforms = !a->m_instanceTransforms.isEmpty();
+    if (hasInstanceTransforms != !b->m_instanceTransforms.isEmpty())
+        return false;
+    return haveSameDrawParameters(a, b, hasInstanceTransforms);
+}
+
+// The batch draws its own range first, each appended command gets the next
+// range with its instance transforms following those of the previous ranges
+void RenderView::appendToMultiDraw(RenderCommand *batch, const RenderCommand *command)
+{
+    if (batch->m_multiDrawRanges.isEmpty())
+        batch->m_multiDrawRanges.push_back(multiDrawRange(batch, 0));
+    batch->m_multiDrawRanges.push_back(multiDrawRange(command, batch->m_instanceTransforms.size()));
+    batch->m_instanceTransforms += command->m_instanceTransforms;
+}
+
+// Merges runs of consecutive commands that can be drawn together into the
+// first command of the run, preserving the sorted order
+void RenderView::mergeBatchableCommands()
+{
+    int mergedCount = 0;
+    for (int i = 0, m = m_commands.size(); i < m; ++i) {
+        RenderCommand *command = m_commands.at(i);
+        if (mergedCount > 0) {
+            RenderCommand *batch = m_commands.at(mergedCount - 1);
+            // Instances of a multi draw batch are addressed per range
+            bool merged = false;
+            if (m_instancing && batch->m_multiDrawRanges.isEmpty() && canBeInstancedTogether(batch, command)) {
+                batch->m_instanceTransforms += command->m_instanceTransforms;
+                merged = true;
+            } else if (m_multiDraw && canBeMultiDrawnTogether(batch, command)) {
+                appendToMultiDraw(batch, command);
+                merged = true;
+            }
+            if (merged) {
+                delete command->m_stateSet;
+                delete command;
+                continue;
+            }
+        }
+        m_commands[mergedCount++] = command;
+    }
+    m_commands.resize(mergedCount);
+
+    // Merged commands draw the geometry renderer instances once per transform
+    for (RenderCommand *command : qAsConst(m_commands)) {
+        if (command->m_instanceTransforms.size() > 1)
+            command->m_instanceCount *= command->m_instanceTransforms.size();
+    }
+}
+
+// Selects the uniforms of the parameter packs that are active in the shaders,
+// once the redundant ones have been stripped
+void RenderView::prepareSubmissionUniforms()
+{
+    if (m_manager == nullptr)
+        return;
+
+    for (RenderCommand *command : qAsConst(m_commands)) {
+        Shader *shader = m_manager->data<Shader, ShaderManager>(command->m_shader);
+        if (shader != nullptr)
+            shader->prepareUniforms(command->m_parameterPack);
+    }
+}
+
 void RenderView::sort()
 {
      sortCommandRange(m_commands, 0, m_commands.size(), 0, m_data.m_sortingTypes);
 
+    // Merging has to happen before redundant uniforms are stripped
+    // as it relies on the commands having complete parameter packs
+    if (m_instancing || m_multiDraw)
+        mergeBatchableCommands();
+
     // For RenderCommand with the same shader
     // We compute the adjacent change cost
 
@@ -469,6 +691,8 @@ void RenderView::sort()
         }
         ++i;
     }
+
+    prepareSubmissionUniforms();
 }
 
 void RenderView::setRenderer(Renderer *renderer)
@@ -602,27 +826,74 @@ QVector<RenderCommand *> RenderView::buildDrawRenderCommands(const QVector<Entit
                     uint primitiveCount = geometryRenderer->vertexCount();
                     uint estimatedCount = 0;
                     Attribute *indexAttribute = nullptr;
+                    Attribute *indirectAttribute = nullptr;
+
+                    bool geometryHasInstanceTransforms = false;
 
                     const QVector<Qt3DCore::QNodeId> attributeIds = geometry->attributes();
                     for (Qt3DCore::QNodeId attributeId : attributeIds) {
                         Attribute *attribute = m_manager->attributeManager()->lookupResource(attributeId);
-                        if (attribute->attributeType() == QAttribute::IndexAttribute)
+                        if (attribute->attributeType() == QAttribute::IndexAttribute) {
                             indexAttribute = attribute;
-                        else if (command->m_attributes.contains(attribute->nameId()))
+                        } else if (attribute->attributeType() == QAttribute::DrawIndirectAttribute) {
+                            indirectAttribute = attribute;
+                        } else if (command->m_attributes.contains(attribute->nameId())) {
                             estimatedCount = qMax(attribute->count(), estimatedCount);
+                            if (m_multiDraw && attribute->attributeType() == QAttribute::VertexAttribute) {
+                                VertexAttributeLayout layout;
+                                layout.bufferId = attribute->bufferId();
+                                layout.nameId = attribute->nameId();
+                                layout.vertexBaseType = attribute->vertexBaseType();
+                                layout.vertexSize = attribute->vertexSize();
+                                layout.byteOffset = attribute->byteOffset();
+                                layout.byteStride = attribute->byteStride();
+                                layout.divisor = attribute->divisor();
+                                command->m_vertexAttributeLayouts.push_back(layout);
+                            }
+                        }
+                        if (attribute->nameId() == INSTANCE_MODEL_MATRIX_NAME_ID)
+                            geometryHasInstanceTransforms = true;
+                    }
+
+                    // Geometries whose attributes read the same buffer ranges
+                    // only differ by their indices and can be batched in a
+                    // multi draw
+                    if (m_multiDraw) {
+                        std::sort(command->m_vertexAttributeLayouts.begin(), command->m_vertexAttributeLayouts.end(),
+                                  [] (const VertexAttributeLayout &a, const VertexAttributeLayout &b) {
+                            return a.nameId < b.nameId;
+                        });
+                        if (indexAttribute != nullptr)
+                            command->m_indexBufferId = indexAttribute->bufferId();
+                    }
+
+                    // Unless the geometry provides it, the instanceModelMatrix
+                    // attribute is fed with the world transform so that
+                    // commands can later be merged into instanced draws
+                    if (!geometryHasInstanceTransforms && command->m_attributes.contains(INSTANCE_MODEL_MATRIX_NAME_ID)) {
+                        const Shader *shader = m_manager->data<Shader, ShaderManager>(command->m_shader);
+                        command->m_instanceTransformLocation = attributeLocation(shader, INSTANCE_MODEL_MATRIX_NAME_ID);
+                        if (command->m_instanceTransformLocation >= 0)
+                            command->m_instanceTransforms.push_back(*node->worldTransform());
                     }
 
                     // Update the draw command with all the information required for the drawing
                     command->m_drawIndexed = (indexAttribute != nullptr);
+                    command->m_drawIndirect = (indirectAttribute != nullptr);
                     if (command->m_drawIndexed) {
                         command->m_indexAttributeDataType = GraphicsContext::glDataTypeFromAttributeDataType(indexAttribute->vertexBaseType());
                         command->m_indexAttributeByteOffset = indexAttribute->byteOffset();
                     }
 
-                    // Use the count specified by the GeometryRender
-                    // If not specified use the indexAttribute count if present
-                    // Otherwise tries to use the count from the attribute with the highest count
-                    if (primitiveCount == 0) {
+                    // Note: we only care about the primitiveCount when using direct draw calls
+                    // For indirect draw calls it is assumed the buffer was properly set already
+                    if (command->m_drawIndirect) {
+                        command->m_indirectAttributeByteOffset = indirectAttribute->byteOffset();
+                        command->m_indirectDrawBuffer = m_manager->bufferManager()->lookupHandle(indirectAttribute->bufferId());
+                    } else if (primitiveCount == 0) {
+                        // Use the count specified by the GeometryRender
+                        // If not specified use the indexAttribute count if present
+                        // Otherwise tries to use the count from the attribute with the highest count
                         if (indexAttribute)
                             primitiveCount = indexAttribute->count();
                         else
@@ -744,74 +1015,198 @@ void RenderView::setStandardUniformValue(ShaderParameterPack &uniformPack, int g
     uniformPack.setUniform(glslNameId, standardUniformValue(ms_standardUniformSetters[nameId], worldTransform));
 }
 
+void RenderView::setViewUniformBlockValue(ShaderParameterPack &uniformPack,
+                                          Shader *shader,
+                                          const ShaderUniformBlock &block) const
+{
+    BlockToUBO uniformBlockUBO;
+    uniformBlockUBO.m_blockIndex = block.m_index;
+    // Views rendered with the same camera usually have the same block content
+    uniformBlockUBO.m_bufferID = m_data.m_renderCameraNode ? m_data.m_renderCameraNode->peerId() : Qt3DCore::QNodeId();
+    uniformBlockUBO.m_needsUpdate = true;
+    uniformBlockUBO.m_data = viewUniformBlockData(shader, block);
+    uniformPack.setUniformBuffer(std::move(uniformBlockUBO));
+}
+
+QByteArray RenderView::shaderDataUniformBlockData(Shader *shader,
+                                                  ShaderData *shaderData,
+                                                  const ShaderUniformBlock &block) const
+{
+    const UniformBlockDataKey key = { shaderData->peerId(), shader->dna(), block.m_index };
+    {
+        QMutexLocker lock(&m_uniformBlockDataMutex);
+        const auto it = m_uniformBlockData.constFind(key);
+        if (it != m_uniformBlockData.cend())
+            return it.value();
+    }
+
+    UniformBlockValueBuilder *builder = m_localData.localData();
+    builder->activeUniformNamesToValue.clear();
+
+    // Set the view matrix to be used to transform "Transformed" properties in the ShaderData
+    builder->viewMatrix = m_data.m_viewMatrix;
+    // Force to update the whole block
+    builder->updatedPropertiesOnly = false;
+    // Retrieve names and description of each active uniforms in the uniform block
+    builder->uniforms = shader->activeUniformsForUniformBlock(block.m_index);
+    // Build name-value map for the block
+    builder->buildActiveUniformNameValueMapStructHelper(shaderData, block.m_name);
+
+    QByteArray data(block.m_size, '\0');
+    builder->fillBlockData(data);
+
+    // Another job may have serialized the same block in the meantime, keep
+    // the first one so that all the commands share the same data
+    QMutexLocker lock(&m_uniformBlockDataMutex);
+    auto it = m_uniformBlockData.find(key);
+    if (it == m_uniformBlockData.end())
+        it = m_uniformBlockData.insert(key, data);
+    return it.value();
+}
+
+QByteArray RenderView::viewUniformBlockData(Shader *shader, const ShaderUniformBlock &block) const
+{
+    const UniformBlockDataKey key = { Qt3DCore::QNodeId(), shader->dna(), block.m_index };
+    {
+        QMutexLocker lock(&m_uniformBlockDataMutex);
+        const auto it = m_uniformBlockData.constFind(key);
+        if (it != m_uniformBlockData.cend())
+            return it.value();
+    }
+
+    UniformBlockValueBuilder *builder = m_localData.localData();
+    builder->activeUniformNamesToValue.clear();
+    builder->viewMatrix = m_data.m_viewMatrix;
+    builder->updatedPropertiesOnly = false;
+    builder->uniforms = shader->activeUniformsForUniformBlock(block.m_index);
+
+    QByteArray data(block.m_size, '\0');
+    const QString prefix = block.m_name + QLatin1Char('.');
+    const auto setMember = [&] (const QString &name, const UniformValue &value) {
+        const auto it = builder->uniforms.constFind(prefix + name);
+        if (it != builder->uniforms.cend())
+            fillUniformBlockMember(data, it.value(), value);
+    };
+
+    // Standard uniforms which don't depend on the model matrix
+    for (auto it = builder->uniforms.cbegin(), end = builder->uniforms.cend(); it != end; ++it) {
+        const int memberNameId = StringToInt::lookupId(it.key().mid(prefix.size()));
+        const auto setterIt = ms_standardUniformSetters.constFind(memberNameId);
+        if (setterIt != ms_standardUniformSetters.cend() && isViewUniform(setterIt.value()))
+            fillUniformBlockMember(data, it.value(), standardUniformValue(setterIt.value(), QMatrix4x4()));
+    }
+
+    // Lights, unlike the default block ones they are not sorted by distance
+    // to each entity when there are more than MAX_LIGHTS
+    int lightIdx = 0;
+    for (const LightSource &lightSource : qAsConst(m_lightSources)) {
+        if (lightIdx == MAX_LIGHTS)
+            break;
+        Entity *lightEntity = lightSource.entity;
+        const QVector3D worldPos = lightEntity->worldBoundingVolume()->center();
+        for (Light *light : lightSource.lights) {
+            if (!light->isEnabled())
+                continue;
+
+            ShaderData *shaderData = m_manager->shaderDataManager()->lookupResource(light->shaderData());
+            if (!shaderData)
+                continue;
+
+            if (lightIdx == MAX_LIGHTS)
+                break;
+
+            setMember(LIGHT_STRUCT_NAMES[lightIdx] + LIGHT_POSITION_NAME, UniformValue(worldPos));
+            setMember(LIGHT_STRUCT_NAMES[lightIdx] + LIGHT_TYPE_NAME, UniformValue(int(QAbstractLight::PointLight)));
+            setMember(LIGHT_STRUCT_NAMES[lightIdx] + LIGHT_COLOR_NAME, UniformValue(QVector3D(1.0f, 1.0f, 1.0f)));
+            setMember(LIGHT_STRUCT_NAMES[lightIdx] + LIGHT_INTENSITY_NAME, UniformValue(0.5f));
+
+            QMatrix4x4 *worldTransform = lightEntity->worldTransform();
+            if (worldTransform)
+                shaderData->updateWorldTransform(*worldTransform);
+
+            builder->buildActiveUniformNameValueMapStructHelper(shaderData, prefix + LIGHT_STRUCT_NAMES[lightIdx]);
+            ++lightIdx;
+        }
+    }
+    setMember(QStringLiteral("lightCount"), UniformValue(qMax(1, lightIdx)));
+
+    // If no active light sources and no environment light, add a default light
+    if (m_lightSources.isEmpty() && !m_environmentLight) {
+        setMember(LIGHT_STRUCT_NAMES[0] + LIGHT_POSITION_NAME, UniformValue(QVector3D(10.0f, 10.0f, 0.0f)));
+        setMember(LIGHT_STRUCT_NAMES[0] + LIGHT_TYPE_NAME, UniformValue(int(QAbstractLight::PointLight)));
+        setMember(LIGHT_STRUCT_NAMES[0] + LIGHT_COLOR_NAME, UniformValue(QVector3D(1.0f, 1.0f, 1.0f)));
+        setMember(LIGHT_STRUCT_NAMES[0] + LIGHT_INTENSITY_NAME, UniformValue(0.5f));
+    }
+
+    // Environment Light
+    int envLightCount = 0;
+    if (m_environmentLight && m_environmentLight->isEnabled()) {
+        ShaderData *shaderData = m_manager->shaderDataManager()->lookupResource(m_environmentLight->shaderData());
+        if (shaderData) {
+            builder->buildActiveUniformNameValueMapStructHelper(shaderData, prefix + QLatin1String("envLight"));
+            envLightCount = 1;
+        }
+    }
+    setMember(QStringLiteral("envLightCount"), UniformValue(envLightCount));
+
+    // Light ShaderData properties override the defaults set above
+    builder->fillBlockData(data);
+
+    QMutexLocker lock(&m_uniformBlockDataMutex);
+    auto it = m_uniformBlockData.find(key);
+    if (it == m_uniformBlockData.end())
+        it = m_uniformBlockData.insert(key, data);
+    return it.value();
+}
+
+bool RenderView::isViewUniform(StandardUniform standardUniformType)
+{
+    switch (standardUniformType) {
+    case ViewMatrix:
+    case ProjectionMatrix:
+    case ViewProjectionMatrix:
+    case InverseViewMatrix:
+    case InverseProjectionMatrix:
+    case InverseViewProjectionMatrix:
+    case ViewportMatrix:
+    case InverseViewportMatrix:
+    case Time:
+    case Exposure:
+    case Gamma:
+    case EyePosition:
+        return true;
+    default:
+        return false;
+    }
+}
+
 void RenderView::setUniformBlockValue(ShaderParameterPack &uniformPack,
                                       Shader *shader,
                                       const ShaderUniformBlock &block,
                                       const UniformValue &value) const
 {
-    Q_UNUSED(shader)
-
     if (value.valueType() == UniformValue::NodeId) {
+        const Qt3DCore::QNodeId id = *value.constData<Qt3DCore::QNodeId>();
 
         Buffer *buffer = nullptr;
-        if ((buffer = m_manager->bufferManager()->lookupResource(*value.constData<Qt3DCore::QNodeId>())) != nullptr) {
+        ShaderData *shaderData = nullptr;
+        if ((buffer = m_manager->bufferManager()->lookupResource(id)) != nullptr) {
             BlockToUBO uniformBlockUBO;
             uniformBlockUBO.m_blockIndex = block.m_index;
             uniformBlockUBO.m_bufferID = buffer->peerId();
             uniformBlockUBO.m_needsUpdate = false;
             uniformPack.setUniformBuffer(std::move(uniformBlockUBO));
             // Buffer update to GL buffer will be done at render time
+        } else if ((shaderData = m_manager->shaderDataManager()->lookupResource(id)) != nullptr) {
+            // The block is serialized with the layout of the shader, the
+            // GL buffer is only updated at render time if the content changed
+            BlockToUBO uniformBlockUBO;
+            uniformBlockUBO.m_blockIndex = block.m_index;
+            uniformBlockUBO.m_bufferID = shaderData->peerId();
+            uniformBlockUBO.m_needsUpdate = true;
+            uniformBlockUBO.m_data = shaderDataUniformBlockData(shader, shaderData, block);
+            uniformPack.setUniformBuffer(std::move(uniformBlockUBO));
         }
-
-
-        //ShaderData *shaderData = nullptr;
-        // if ((shaderData = m_manager->shaderDataManager()->lookupResource(value.value<Qt3DCore::QNodeId>())) != nullptr) {
-        // UBO are indexed by <ShaderId, ShaderDataId> so that a same QShaderData can be used among different shaders
-        // while still making sure that if they have a different layout everything will still work
-        // If two shaders define the same block with the exact same layout, in that case the UBO could be shared
-        // but how do we know that ? We'll need to compare ShaderUniformBlocks
-
-        // Note: we assume that if a buffer is shared across multiple shaders
-        // then it implies that they share the same layout
-
-        // Temporarly disabled
-
-        //        BufferShaderKey uboKey(shaderData->peerId(),
-        //                               shader->peerId());
-
-        //        BlockToUBO uniformBlockUBO;
-        //        uniformBlockUBO.m_blockIndex = block.m_index;
-        //        uniformBlockUBO.m_shaderDataID = shaderData->peerId();
-        //        bool uboNeedsUpdate = false;
-
-        //        // build UBO at uboId if not created before
-        //        if (!m_manager->glBufferManager()->contains(uboKey)) {
-        //            m_manager->glBufferManager()->getOrCreateResource(uboKey);
-        //            uboNeedsUpdate = true;
-        //        }
-
-        //        // If shaderData  has been updated (property has changed or one of the nested properties has changed)
-        //        // foreach property defined in the QShaderData, we try to fill the value of the corresponding active uniform(s)
-        //        // for all the updated properties (all the properties if the UBO was just created)
-        //        if (shaderData->updateViewTransform(*m_data->m_viewMatrix) || uboNeedsUpdate) {
-        //            // Clear previous values remaining in the hash
-        //            m_data->m_uniformBlockBuilder.activeUniformNamesToValue.clear();
-        //            // Update only update properties if uboNeedsUpdate is true, otherwise update the whole block
-        //            m_data->m_uniformBlockBuilder.updatedPropertiesOnly = uboNeedsUpdate;
-        //            // Retrieve names and description of each active uniforms in the uniform block
-        //            m_data->m_uniformBlockBuilder.uniforms = shader->activeUniformsForUniformBlock(block.m_index);
-        //            // Builds the name-value map for the block
-        //            m_data->m_uniformBlockBuilder.buildActiveUniformNameValueMapStructHelper(shaderData, block.m_name);
-        //            if (!uboNeedsUpdate)
-        //                shaderData->markDirty();
-        //            // copy the name-value map into the BlockToUBO
-        //            uniformBlockUBO.m_updatedProperties = m_data->m_uniformBlockBuilder.activeUniformNamesToValue;
-        //            uboNeedsUpdate = true;
-        //        }
-
-        //        uniformBlockUBO.m_needsUpdate = uboNeedsUpdate;
-        //        uniformPack.setUniformBuffer(std::move(uniformBlockUBO));
-        // }
     }
 }
 
@@ -925,6 +1320,10 @@ void RenderView::setShaderAndUniforms(RenderCommand *command, RenderPass *rPass,
                         setStandardUniformValue(command->m_parameterPack, uniformNameId, uniformNameId, worldTransform);
                 }
 
+                // Camera, viewport and lights shared by all the commands of the view
+                if (uniformBlockNamesIds.contains(VIEW_UNIFORM_BLOCK_NAME_ID))
+                    setViewUniformBlockValue(command->m_parameterPack, shader, shader->uniformBlockForBlockNameId(VIEW_UNIFORM_BLOCK_NAME_ID));
+
                 // Set default attributes
                 for (const int attributeNameId : attributeNamesIds)
                     command->m_attributes.push_back(attributeNameId);
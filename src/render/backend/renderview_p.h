@@ -72,6 +72,7 @@
 #include <QSurface>
 #include <QMutex>
 #include <QColor>
+#include <QSize>
 
 QT_BEGIN_NAMESPACE
 
@@ -172,6 +173,16 @@ public:
     const int *computeWorkGroups() const Q_DECL_NOTHROW { return m_workGroups; }
     inline bool frustumCulling() const Q_DECL_NOTHROW { return m_frustumCulling; }
     void setFrustumCulling(bool frustumCulling) Q_DECL_NOTHROW { m_frustumCulling = frustumCulling; }
+    inline bool occlusionCulling() const Q_DECL_NOTHROW { return m_occlusionCulling; }
+    void setOcclusionCulling(bool occlusionCulling) Q_DECL_NOTHROW { m_occlusionCulling = occlusionCulling; }
+    inline Qt3DCore::QNodeId occluderLayerId() const Q_DECL_NOTHROW { return m_occluderLayerId; }
+    void setOccluderLayerId(Qt3DCore::QNodeId occluderLayerId) Q_DECL_NOTHROW { m_occluderLayerId = occluderLayerId; }
+    inline QSize occlusionDepthBufferSize() const Q_DECL_NOTHROW { return m_occlusionDepthBufferSize; }
+    void setOcclusionDepthBufferSize(const QSize &size) Q_DECL_NOTHROW { m_occlusionDepthBufferSize = size; }
+    inline bool isInstancingEnabled() const Q_DECL_NOTHROW { return m_instancing; }
+    void setInstancingEnabled(bool instancing) Q_DECL_NOTHROW { m_instancing = instancing; }
+    inline bool isMultiDrawEnabled() const Q_DECL_NOTHROW { return m_multiDraw; }
+    void setMultiDrawEnabled(bool multiDraw) Q_DECL_NOTHROW { m_multiDraw = multiDraw; }
 
     inline void setMaterialParameterTable(const QHash<Qt3DCore::QNodeId, QVector<RenderPassParameterData>> &parameters) Q_DECL_NOTHROW { m_parameters = parameters; }
 
@@ -253,6 +264,14 @@ public:
     void setIsDownloadBuffersEnable(bool isDownloadBuffersEnable);
 
 private:
+    void mergeBatchableCommands();
+    void prepareSubmissionUniforms();
+    static bool canBeInstancedTogether(const RenderCommand *a, const RenderCommand *b);
+    static bool canBeMultiDrawnTogether(const RenderCommand *a, const RenderCommand *b);
+    static void appendToMultiDraw(RenderCommand *batch, const RenderCommand *command);
+    static bool haveSameDrawParameters(const RenderCommand *a, const RenderCommand *b, bool ignorePerObjectUniforms);
+    static bool isPerObjectUniform(int glslNameId);
+
     void setShaderAndUniforms(RenderCommand *command, RenderPass *pass, ParameterInfoList &parameters, const QMatrix4x4 &worldTransform,
                               const QVector<LightSource> &activeLightSources, EnvironmentLight *environmentLight) const;
 
@@ -282,8 +301,13 @@ private:
     bool m_noDraw:1;
     bool m_compute:1;
     bool m_frustumCulling:1;
+    bool m_occlusionCulling:1;
+    bool m_instancing:1;
+    bool m_multiDraw:1;
     int m_workGroups[3];
     QMemoryBarrier::Operations m_memoryBarrier;
+    Qt3DCore::QNodeId m_occluderLayerId;
+    QSize m_occlusionDepthBufferSize;
 
     // We do not use pointers to RenderNodes or Drawable's here so that the
     // render aspect is free to change the drawables on the next frame whilst
@@ -294,6 +318,11 @@ private:
 
     QHash<Qt3DCore::QNodeId, QVector<RenderPassParameterData>> m_parameters;
 
+    // Uniform blocks are serialized once per RenderView and shared by all
+    // the commands referencing them, builder jobs run concurrently
+    mutable QMutex m_uniformBlockDataMutex;
+    mutable QHash<UniformBlockDataKey, QByteArray> m_uniformBlockData;
+
     enum StandardUniform
     {
         ModelMatrix,
@@ -338,6 +367,14 @@ private:
                                                Shader *shader,
                                                ShaderData *shaderData,
                                                const QString &structName) const;
+    void setViewUniformBlockValue(ShaderParameterPack &uniformPack,
+                                  Shader *shader,
+                                  const ShaderUniformBlock &block) const;
+    QByteArray shaderDataUniformBlockData(Shader *shader,
+                                          ShaderData *shaderData,
+                                          const ShaderUniformBlock &block) const;
+    QByteArray viewUniformBlockData(Shader *shader, const ShaderUniformBlock &block) const;
+    static bool isViewUniform(StandardUniform standardUniformType);
     void prepareForSorting(RenderCommand *command) const;
 };
 
@@ -72,9 +72,13 @@ public:
         QVector<RenderCommand *> commands;
         commands.reserve(totalCommandCount);
 
-        // Reduction
-        for (const auto &renderViewCommandBuilder : qAsConst(m_renderViewBuilderJobs))
-            commands += std::move(renderViewCommandBuilder->commands());
+        // Reduction, the builders are left empty as the RenderView now
+        // owns the commands
+        for (const auto &renderViewCommandBuilder : qAsConst(m_renderViewBuilderJobs)) {
+            QVector<RenderCommand *> builderCommands;
+            qSwap(builderCommands, renderViewCommandBuilder->commands());
+            commands += builderCommands;
+        }
         rv->setCommands(commands);
 
         // Sort the commands
@@ -94,9 +98,11 @@ class SyncFrustumCulling
 {
 public:
     explicit SyncFrustumCulling(const RenderViewInitializerJobPtr &renderViewJob,
-                                const FrustumCullingJobPtr &frustumCulling)
+                                const FrustumCullingJobPtr &frustumCulling,
+                                const OcclusionCullingJobPtr &occlusionCulling)
         : m_renderViewJob(renderViewJob)
         , m_frustumCullingJob(frustumCulling)
+        , m_occlusionCullingJob(occlusionCulling)
     {}
 
     void operator()()
@@ -108,11 +114,15 @@ public:
 
         // Frustum culling
         m_frustumCullingJob->setViewProjection(rv->viewProjectionMatrix());
+
+        // Occlusion culling
+        m_occlusionCullingJob->setViewProjection(rv->viewProjectionMatrix());
     }
 
 private:
     RenderViewInitializerJobPtr m_renderViewJob;
     FrustumCullingJobPtr m_frustumCullingJob;
+    OcclusionCullingJobPtr m_occlusionCullingJob;
 };
 
 class SyncRenderViewInitialization
@@ -120,11 +130,13 @@ class SyncRenderViewInitialization
 public:
     explicit SyncRenderViewInitialization(const RenderViewInitializerJobPtr &renderViewJob,
                                           const FrustumCullingJobPtr &frustumCullingJob,
+                                          const OcclusionCullingJobPtr &occlusionCullingJob,
                                           const FilterLayerEntityJobPtr &filterEntityByLayerJob,
                                           const QVector<MaterialParameterGathererJobPtr> &materialGathererJobs,
                                           const QVector<RenderViewBuilderJobPtr> &renderViewBuilderJobs)
         : m_renderViewJob(renderViewJob)
         , m_frustumCullingJob(frustumCullingJob)
+        , m_occlusionCullingJob(occlusionCullingJob)
         , m_filterEntityByLayerJob(filterEntityByLayerJob)
         , m_materialGathererJobs(materialGathererJobs)
         , m_renderViewBuilderJobs(renderViewBuilderJobs)
@@ -150,11 +162,17 @@ public:
 
         // Set whether frustum culling is enabled or not
         m_frustumCullingJob->setActive(rv->frustumCulling());
+
+        // Set whether occlusion culling is enabled or not
+        m_occlusionCullingJob->setActive(rv->occlusionCulling() && !rv->isCompute() && !rv->noDraw());
+        m_occlusionCullingJob->setOccluderLayerId(rv->occluderLayerId());
+        m_occlusionCullingJob->setDepthBufferSize(rv->occlusionDepthBufferSize());
     }
 
 private:
     RenderViewInitializerJobPtr m_renderViewJob;
     FrustumCullingJobPtr m_frustumCullingJob;
+    OcclusionCullingJobPtr m_occlusionCullingJob;
     FilterLayerEntityJobPtr m_filterEntityByLayerJob;
     QVector<MaterialParameterGathererJobPtr> m_materialGathererJobs;
     QVector<RenderViewBuilderJobPtr> m_renderViewBuilderJobs;
@@ -165,6 +183,7 @@ class SyncRenderCommandBuilding
 public:
     explicit SyncRenderCommandBuilding(const RenderViewInitializerJobPtr &renderViewJob,
                                        const FrustumCullingJobPtr &frustumCullingJob,
+                                       const OcclusionCullingJobPtr &occlusionCullingJob,
                                        const FilterLayerEntityJobPtr &filterEntityByLayerJob,
                                        const LightGathererPtr &lightGathererJob,
                                        const RenderableEntityFilterPtr &renderableEntityFilterJob,
@@ -173,6 +192,7 @@ public:
                                        const QVector<RenderViewBuilderJobPtr> &renderViewBuilderJobs)
         : m_renderViewJob(renderViewJob)
         , m_frustumCullingJob(frustumCullingJob)
+        , m_occlusionCullingJob(occlusionCullingJob)
         , m_filterEntityByLayerJob(filterEntityByLayerJob)
         , m_lightGathererJob(lightGathererJob)
         , m_renderableEntityFilterJob(renderableEntityFilterJob)
@@ -188,16 +208,14 @@ public:
         RenderView *rv = m_renderViewJob->renderView();
 
         if (!rv->noDraw()) {
-            rv->setEnvironmentLight(m_lightGathererJob->takeEnvironmentLight());
+            rv->setEnvironmentLight(m_lightGathererJob->environmentLight());
 
             // We sort the vector so that the removal can then be performed linearly
 
-            QVector<Entity *> renderableEntities;
+            // The entity filters are shared by all the RenderViews, work on a copy
             const bool isDraw = !rv->isCompute();
-            if (isDraw)
-                renderableEntities = std::move(m_renderableEntityFilterJob->filteredEntities());
-            else
-                renderableEntities = std::move(m_computableEntityFilterJob->filteredEntities());
+            QVector<Entity *> renderableEntities = isDraw ? m_renderableEntityFilterJob->filteredEntities()
+                                                          : m_computableEntityFilterJob->filteredEntities();
 
             // Filter out entities that weren't selected by the layer filters
             std::sort(renderableEntities.begin(), renderableEntities.end());
@@ -218,6 +236,10 @@ public:
             if (isDraw && rv->frustumCulling())
                 RenderViewBuilder::removeEntitiesNotInSubset(renderableEntities, m_frustumCullingJob->visibleEntities());
 
+            // Filter out entities hidden behind the occluders
+            if (isDraw && rv->occlusionCulling())
+                m_occlusionCullingJob->removeOccludedEntities(renderableEntities);
+
             // Split among the number of command builders
             int i = 0;
             const int m = RenderViewBuilder::optimalJobCount() - 1;
@@ -241,6 +263,7 @@ public:
 private:
     RenderViewInitializerJobPtr m_renderViewJob;
     FrustumCullingJobPtr m_frustumCullingJob;
+    OcclusionCullingJobPtr m_occlusionCullingJob;
     FilterLayerEntityJobPtr m_filterEntityByLayerJob;
     LightGathererPtr m_lightGathererJob;
     RenderableEntityFilterPtr m_renderableEntityFilterJob;
@@ -277,20 +300,14 @@ RenderViewBuilder::RenderViewBuilder(Render::FrameGraphNode *leafNode, int rende
     , m_renderer(renderer)
     , m_renderViewJob(RenderViewInitializerJobPtr::create())
     , m_filterEntityByLayerJob(Render::FilterLayerEntityJobPtr::create())
-    , m_lightGathererJob(Render::LightGathererPtr::create())
-    , m_renderableEntityFilterJob(RenderableEntityFilterPtr::create())
-    , m_computableEntityFilterJob(ComputableEntityFilterPtr::create())
-    , m_frustumCullingJob(Render::FrustumCullingJobPtr::create())
-    , m_syncFrustumCullingJob(SynchronizerJobPtr::create(SyncFrustumCulling(m_renderViewJob, m_frustumCullingJob), JobTypes::SyncFrustumCulling))
+    , m_frustumCullingJob(Render::FrustumCullingJobPtr::create(RenderViewBuilder::m_optimalParallelJobCount))
+    , m_occlusionCullingJob(Render::OcclusionCullingJobPtr::create(RenderViewBuilder::m_optimalParallelJobCount))
+    , m_syncFrustumCullingJob(SynchronizerJobPtr::create(SyncFrustumCulling(m_renderViewJob, m_frustumCullingJob, m_occlusionCullingJob), JobTypes::SyncFrustumCulling))
     , m_setClearDrawBufferIndexJob(SynchronizerJobPtr::create(SetClearDrawBufferIndex(m_renderViewJob), JobTypes::ClearBufferDrawIndex))
 {
     // Init what we can here
-    EntityManager *entityManager = m_renderer->nodeManagers()->renderNodesManager();
     m_filterEntityByLayerJob->setManager(m_renderer->nodeManagers());
-    m_renderableEntityFilterJob->setManager(entityManager);
-    m_computableEntityFilterJob->setManager(entityManager);
-    m_frustumCullingJob->setRoot(m_renderer->sceneRoot());
-    m_lightGathererJob->setManager(entityManager);
+    m_occlusionCullingJob->setManagers(m_renderer->nodeManagers());
     m_renderViewJob->setRenderer(m_renderer);
     m_renderViewJob->setFrameGraphLeafNode(leafNode);
     m_renderViewJob->setSubmitOrderIndex(m_renderViewIndex);
@@ -306,23 +323,19 @@ RenderViewBuilder::RenderViewBuilder(Render::FrameGraphNode *leafNode, int rende
     }
 
     // Since Material gathering is an heavy task, we split it
-    const QVector<HMaterial> materialHandles = m_renderer->nodeManagers()->materialManager()->activeHandles();
-    const int elementsPerJob =  materialHandles.size() / RenderViewBuilder::m_optimalParallelJobCount;
-    const int lastRemaingElements = materialHandles.size() % RenderViewBuilder::m_optimalParallelJobCount;
     m_materialGathererJobs.reserve(RenderViewBuilder::m_optimalParallelJobCount);
     for (auto i = 0; i < RenderViewBuilder::m_optimalParallelJobCount; ++i) {
         auto materialGatherer = Render::MaterialParameterGathererJobPtr::create();
         materialGatherer->setNodeManagers(m_renderer->nodeManagers());
         materialGatherer->setRenderer(m_renderer);
-        if (i == RenderViewBuilder::m_optimalParallelJobCount - 1)
-            materialGatherer->setHandles(materialHandles.mid(i * elementsPerJob, elementsPerJob + lastRemaingElements));
-        else
-            materialGatherer->setHandles(materialHandles.mid(i * elementsPerJob, elementsPerJob));
+        materialGatherer->setCache(m_renderer->materialParameterGathererCache());
         m_materialGathererJobs.push_back(materialGatherer);
     }
+    prepareJobs();
 
     m_syncRenderViewInitializationJob = SynchronizerJobPtr::create(SyncRenderViewInitialization(m_renderViewJob,
                                                                                                 m_frustumCullingJob,
+                                                                                                m_occlusionCullingJob,
                                                                                                 m_filterEntityByLayerJob,
                                                                                                 m_materialGathererJobs,
                                                                                                 m_renderViewBuilderJobs),
@@ -330,10 +343,11 @@ RenderViewBuilder::RenderViewBuilder(Render::FrameGraphNode *leafNode, int rende
 
     m_syncRenderCommandBuildingJob = SynchronizerJobPtr::create(SyncRenderCommandBuilding(m_renderViewJob,
                                                                                           m_frustumCullingJob,
+                                                                                          m_occlusionCullingJob,
                                                                                           m_filterEntityByLayerJob,
-                                                                                          m_lightGathererJob,
-                                                                                          m_renderableEntityFilterJob,
-                                                                                          m_computableEntityFilterJob,
+                                                                                          m_renderer->lightGathererJob(),
+                                                                                          m_renderer->renderableEntityFilterJob(),
+                                                                                          m_renderer->computableEntityFilterJob(),
                                                                                           m_materialGathererJobs,
                                                                                           m_renderViewBuilderJobs),
                                                                 JobTypes::SyncRenderViewCommandBuilding);
@@ -344,6 +358,25 @@ RenderViewBuilder::RenderViewBuilder(Render::FrameGraphNode *leafNode, int rende
                                                                     JobTypes::SyncRenderViewCommandBuilder);
 }
 
+// The jobs of a RenderViewBuilder are reused by the Renderer across frames as
+// long as the frame graph isn't modified. This refreshes the inputs which may
+// change from one frame to the next without affecting the frame graph.
+void RenderViewBuilder::prepareJobs()
+{
+    m_frustumCullingJob->setRoot(m_renderer->sceneRoot());
+
+    const QVector<HMaterial> materialHandles = m_renderer->nodeManagers()->materialManager()->activeHandles();
+    const int elementsPerJob =  materialHandles.size() / RenderViewBuilder::m_optimalParallelJobCount;
+    const int lastRemaingElements = materialHandles.size() % RenderViewBuilder::m_optimalParallelJobCount;
+    for (auto i = 0; i < RenderViewBuilder::m_optimalParallelJobCount; ++i) {
+        const MaterialParameterGathererJobPtr &materialGatherer = m_materialGathererJobs.at(i);
+        if (i == RenderViewBuilder::m_optimalParallelJobCount - 1)
+            materialGatherer->setHandles(materialHandles.mid(i * elementsPerJob, elementsPerJob + lastRemaingElements));
+        else
+            materialGatherer->setHandles(materialHandles.mid(i * elementsPerJob, elementsPerJob));
+    }
+}
+
 RenderViewInitializerJobPtr RenderViewBuilder::renderViewJob() const
 {
     return m_renderViewJob;
@@ -354,19 +387,22 @@ FilterLayerEntityJobPtr RenderViewBuilder::filterEntityByLayerJob() const
     return m_filterEntityByLayerJob;
 }
 
+// Shared by all the RenderViews
 LightGathererPtr RenderViewBuilder::lightGathererJob() const
 {
-    return m_lightGathererJob;
+    return m_renderer->lightGathererJob();
 }
 
+// Shared by all the RenderViews
 RenderableEntityFilterPtr RenderViewBuilder::renderableEntityFilterJob() const
 {
-    return m_renderableEntityFilterJob;
+    return m_renderer->renderableEntityFilterJob();
 }
 
+// Shared by all the RenderViews
 ComputableEntityFilterPtr RenderViewBuilder::computableEntityFilterJob() const
 {
-    return m_computableEntityFilterJob;
+    return m_renderer->computableEntityFilterJob();
 }
 
 FrustumCullingJobPtr RenderViewBuilder::frustumCullingJob() const
@@ -374,6 +410,11 @@ FrustumCullingJobPtr RenderViewBuilder::frustumCullingJob() const
     return m_frustumCullingJob;
 }
 
+OcclusionCullingJobPtr RenderViewBuilder::occlusionCullingJob() const
+{
+    return m_occlusionCullingJob;
+}
+
 QVector<RenderViewBuilderJobPtr> RenderViewBuilder::renderViewBuilderJobs() const
 {
     return m_renderViewBuilderJobs;
@@ -413,7 +454,10 @@ QVector<Qt3DCore::QAspectJobPtr> RenderViewBuilder::buildJobHierachy() const
 {
     QVector<Qt3DCore::QAspectJobPtr> jobs;
 
-    jobs.reserve(m_materialGathererJobs.size() + m_renderViewBuilderJobs.size() + 11);
+    const QVector<FrustumCullingChunkJobPtr> frustumCullingChunkJobs = m_frustumCullingJob->chunkJobs();
+    const QVector<OcclusionRasterizerJobPtr> occlusionRasterizerJobs = m_occlusionCullingJob->rasterizerJobs();
+    jobs.reserve(m_materialGathererJobs.size() + m_renderViewBuilderJobs.size()
+                 + frustumCullingChunkJobs.size() + occlusionRasterizerJobs.size() + 9);
 
     // Set dependencies
     m_syncFrustumCullingJob->addDependency(m_renderer->updateWorldTransformJob());
@@ -423,6 +467,21 @@ QVector<Qt3DCore::QAspectJobPtr> RenderViewBuilder::buildJobHierachy() const
     m_frustumCullingJob->addDependency(m_renderer->expandBoundingVolumeJob());
     m_frustumCullingJob->addDependency(m_syncFrustumCullingJob);
 
+    // The frustum culling job tests the top of the scene and splits the
+    // remaining subtrees among its chunk jobs
+    for (const auto &frustumCullingChunkJob : frustumCullingChunkJobs)
+        frustumCullingChunkJob->addDependency(m_frustumCullingJob);
+
+    // The occlusion culling job gathers the occluders and splits the depth
+    // buffer rows among its rasterizer jobs
+    m_occlusionCullingJob->addDependency(m_syncFrustumCullingJob);
+    m_occlusionCullingJob->addDependency(m_renderer->updateTreeEnabledJob());
+    // Occluder triangles are read from buffers which the buffer loading and
+    // bounding volume jobs write or read as well
+    m_occlusionCullingJob->addDependency(m_renderer->expandBoundingVolumeJob());
+    for (const auto &occlusionRasterizerJob : occlusionRasterizerJobs)
+        occlusionRasterizerJob->addDependency(m_occlusionCullingJob);
+
     m_setClearDrawBufferIndexJob->addDependency(m_syncRenderViewInitializationJob);
 
     m_syncRenderViewInitializationJob->addDependency(m_renderViewJob);
@@ -436,11 +495,16 @@ QVector<Qt3DCore::QAspectJobPtr> RenderViewBuilder::buildJobHierachy() const
         materialGatherer->addDependency(m_renderer->filterCompatibleTechniqueJob());
         m_syncRenderCommandBuildingJob->addDependency(materialGatherer);
     }
-    m_syncRenderCommandBuildingJob->addDependency(m_renderableEntityFilterJob);
-    m_syncRenderCommandBuildingJob->addDependency(m_computableEntityFilterJob);
+    m_syncRenderCommandBuildingJob->addDependency(m_renderer->renderableEntityFilterJob());
+    m_syncRenderCommandBuildingJob->addDependency(m_renderer->computableEntityFilterJob());
     m_syncRenderCommandBuildingJob->addDependency(m_filterEntityByLayerJob);
-    m_syncRenderCommandBuildingJob->addDependency(m_lightGathererJob);
+    m_syncRenderCommandBuildingJob->addDependency(m_renderer->lightGathererJob());
     m_syncRenderCommandBuildingJob->addDependency(m_frustumCullingJob);
+    for (const auto &frustumCullingChunkJob : frustumCullingChunkJobs)
+        m_syncRenderCommandBuildingJob->addDependency(frustumCullingChunkJob);
+    m_syncRenderCommandBuildingJob->addDependency(m_occlusionCullingJob);
+    for (const auto &occlusionRasterizerJob : occlusionRasterizerJobs)
+        m_syncRenderCommandBuildingJob->addDependency(occlusionRasterizerJob);
 
     for (const auto &renderViewCommandBuilder : qAsConst(m_renderViewBuilderJobs)) {
         renderViewCommandBuilder->addDependency(m_syncRenderCommandBuildingJob);
@@ -451,12 +515,9 @@ QVector<Qt3DCore::QAspectJobPtr> RenderViewBuilder::buildJobHierachy() const
     m_renderer->frameCleanupJob()->addDependency(m_setClearDrawBufferIndexJob);
 
     // Add jobs
+    // Note: the renderable, computable and light gathering jobs are shared
+    // between all the RenderViews and added by the Renderer
     jobs.push_back(m_renderViewJob); // Step 1
-    jobs.push_back(m_renderableEntityFilterJob); // Step 1
-    jobs.push_back(m_lightGathererJob); // Step 1
-
-    // Note: do it only if OpenGL 4.3+ available
-    jobs.push_back(m_computableEntityFilterJob); // Step 1
 
     jobs.push_back(m_syncRenderViewInitializationJob); // Step 2
 
@@ -468,12 +529,20 @@ QVector<Qt3DCore::QAspectJobPtr> RenderViewBuilder::buildJobHierachy() const
         jobs.push_back(materialGatherer);
 
     jobs.push_back(m_frustumCullingJob); // Step 4
-    jobs.push_back(m_syncRenderCommandBuildingJob); // Step 4
+    jobs.push_back(m_occlusionCullingJob); // Step 4
+
+    for (const auto &frustumCullingChunkJob : frustumCullingChunkJobs) // Step 5
+        jobs.push_back(frustumCullingChunkJob);
+
+    for (const auto &occlusionRasterizerJob : occlusionRasterizerJobs) // Step 5
+        jobs.push_back(occlusionRasterizerJob);
+
+    jobs.push_back(m_syncRenderCommandBuildingJob); // Step 6
 
-    for (const auto &renderViewCommandBuilder : qAsConst(m_renderViewBuilderJobs)) // Step 5
+    for (const auto &renderViewCommandBuilder : qAsConst(m_renderViewBuilderJobs)) // Step 7
         jobs.push_back(renderViewCommandBuilder);
 
-    jobs.push_back(m_syncRenderViewCommandBuildersJob); // Step 6
+    jobs.push_back(m_syncRenderViewCommandBuildersJob); // Step 8
 
     return jobs;
 }
@@ -61,6 +61,7 @@
 #include <Qt3DRender/private/renderviewbuilderjob_p.h>
 #include <Qt3DRender/private/renderview_p.h>
 #include <Qt3DRender/private/frustumcullingjob_p.h>
+#include <Qt3DRender/private/occlusioncullingjob_p.h>
 #include <Qt3DRender/private/lightgatherer_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -72,8 +73,6 @@ namespace Render {
 class Renderer;
 
 using SynchronizerJobPtr = GenericLambdaJobPtr<std::function<void()>>;
-using ComputableEntityFilterPtr = FilterEntityByComponentJobPtr<Render::ComputeCommand, Render::Material>;
-using RenderableEntityFilterPtr = FilterEntityByComponentJobPtr<Render::GeometryRenderer, Render::Material>;
 
 class Q_AUTOTEST_EXPORT RenderViewBuilder
 {
@@ -86,6 +85,7 @@ public:
     RenderableEntityFilterPtr renderableEntityFilterJob() const;
     ComputableEntityFilterPtr computableEntityFilterJob() const;
     FrustumCullingJobPtr frustumCullingJob() const;
+    OcclusionCullingJobPtr occlusionCullingJob() const;
     QVector<RenderViewBuilderJobPtr> renderViewBuilderJobs() const;
     QVector<MaterialParameterGathererJobPtr> materialGathererJobs() const;
     SynchronizerJobPtr syncRenderViewInitializationJob() const;
@@ -94,6 +94,7 @@ public:
     SynchronizerJobPtr syncRenderViewCommandBuildersJob() const;
     SynchronizerJobPtr setClearDrawBufferIndexJob() const;
 
+    void prepareJobs();
     QVector<Qt3DCore::QAspectJobPtr> buildJobHierachy() const;
 
     Renderer *renderer() const;
@@ -108,10 +109,8 @@ private:
 
     RenderViewInitializerJobPtr m_renderViewJob;
     FilterLayerEntityJobPtr m_filterEntityByLayerJob;
-    LightGathererPtr m_lightGathererJob;
-    RenderableEntityFilterPtr m_renderableEntityFilterJob;
-    ComputableEntityFilterPtr m_computableEntityFilterJob;
     FrustumCullingJobPtr m_frustumCullingJob;
+    OcclusionCullingJobPtr m_occlusionCullingJob;
     QVector<RenderViewBuilderJobPtr> m_renderViewBuilderJobs;
     QVector<MaterialParameterGathererJobPtr> m_materialGathererJobs;
 
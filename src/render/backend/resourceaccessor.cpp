@@ -85,6 +85,9 @@ bool ResourceAccessor::accessResource(ResourceType type, Qt3DCore::QNodeId nodeI
         if (glTex->isDirty())
             return false;
 
+        // keep the texture from being evicted while the plugin uses it
+        glTex->setLastUsedFrame(m_glTextureManager->currentFrame());
+
         QOpenGLTexture **glTextureHandle = reinterpret_cast<QOpenGLTexture **>(handle);
         *glTextureHandle = glTex->getOrCreateGLTexture();
         *lock = glTex->textureLock();
@@ -75,12 +75,31 @@ class GraphicsContext;
 
 struct BlockToUBO {
     int m_blockIndex;
-    Qt3DCore::QNodeId m_bufferID;
+    Qt3DCore::QNodeId m_bufferID; // Buffer, or data source when m_data is set
     bool m_needsUpdate;
-    QHash<QString, QVariant> m_updatedProperties;
+    QByteArray m_data; // Block content serialized from a ShaderData or the RenderView
 };
 QT3D_DECLARE_TYPEINFO_2(Qt3DRender, Render, BlockToUBO, Q_MOVABLE_TYPE)
 
+// Identifies a serialized uniform block: the layout depends on the shader,
+// the content on the data source
+struct UniformBlockDataKey
+{
+    Qt3DCore::QNodeId sourceId;
+    uint shaderDna;
+    int blockIndex;
+};
+
+inline bool operator==(const UniformBlockDataKey &a, const UniformBlockDataKey &b) Q_DECL_NOTHROW
+{
+    return a.sourceId == b.sourceId && a.shaderDna == b.shaderDna && a.blockIndex == b.blockIndex;
+}
+
+inline uint qHash(const UniformBlockDataKey &key, uint seed = 0) Q_DECL_NOTHROW
+{
+    return qHash(key.sourceId, seed) ^ qHash(key.shaderDna) ^ uint(key.blockIndex);
+}
+
 struct BlockToSSBO {
     int m_blockIndex;
     Qt3DCore::QNodeId m_bufferID;
@@ -52,6 +52,7 @@
 //
 
 #include <Qt3DRender/qt3drender_global.h>
+#include <Qt3DRender/private/uniform_p.h>
 #include <QOpenGLContext>
 
 QT_BEGIN_NAMESPACE
@@ -89,6 +90,7 @@ struct ShaderUniform
         , m_arrayStride(-1)
         , m_matrixStride(-1)
         , m_rawByteSize(0)
+        , m_uniformType(Unknown)
     {}
 
     QString m_name;
@@ -102,6 +104,7 @@ struct ShaderUniform
     int m_matrixStride; // -1 is the default, >= 0 uniform defined in uniform block and is a matrix
     uint m_rawByteSize; // contains byte size (size / type / strides)
     // size, offset and strides are in bytes
+    UniformType m_uniformType; // m_type resolved by the graphics helper at introspection
 };
 QT3D_DECLARE_TYPEINFO_2(Qt3DRender, Render, ShaderUniform, Q_MOVABLE_TYPE)
 
@@ -0,0 +1,291 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "softwaredepthbuffer_p.h"
+#include <QtCore/private/qsimd_p.h>
+
+#include <algorithm>
+#include <cmath>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+namespace {
+
+const float FarDepth = 1.0f;
+
+// Coefficients of the edge function going from p to q, positive on the
+// left side of the edge: e(x, y) = a * x + b * y + c
+struct EdgeFunction
+{
+    EdgeFunction(const QVector3D &p, const QVector3D &q)
+        : a(p.y() - q.y())
+        , b(q.x() - p.x())
+        , c(-(a * p.x() + b * p.y()))
+    {}
+
+    inline float operator()(float x, float y) const Q_DECL_NOTHROW { return a * x + b * y + c; }
+
+    float a;
+    float b;
+    float c;
+};
+
+} // anonymous
+
+SoftwareDepthBuffer::SoftwareDepthBuffer()
+{
+    resize(QSize(1, 1));
+}
+
+void SoftwareDepthBuffer::resize(const QSize &size)
+{
+    int width = std::max(size.width(), 1);
+    int height = std::max(size.height(), 1);
+    if (m_levels.size() > 0 && m_levels.first().width == width && m_levels.first().height == height)
+        return;
+
+    m_levels.clear();
+    for (;;) {
+        Level level;
+        level.width = width;
+        level.height = height;
+        // Level 0 rows are padded so that they can be processed 4 pixels at a time
+        level.stride = m_levels.isEmpty() ? (width + 3) & ~3 : width;
+        level.depths.fill(FarDepth, level.stride * height);
+        m_levels.push_back(level);
+        if (width == 1 && height == 1)
+            break;
+        width = (width + 1) / 2;
+        height = (height + 1) / 2;
+    }
+}
+
+QSize SoftwareDepthBuffer::size() const Q_DECL_NOTHROW
+{
+    return QSize(m_levels.first().width, m_levels.first().height);
+}
+
+void SoftwareDepthBuffer::clear()
+{
+    for (Level &level : m_levels)
+        level.depths.fill(FarDepth);
+}
+
+void SoftwareDepthBuffer::rasterizeTriangle(const QVector3D &a, const QVector3D &b, const QVector3D &c)
+{
+    rasterizeTriangle(a, b, c, 0, m_levels.first().height);
+}
+
+// Only the rows in [firstRow, lastRow) are written
+void SoftwareDepthBuffer::rasterizeTriangle(const QVector3D &a, const QVector3D &b, const QVector3D &c,
+                                             int firstRow, int lastRow)
+{
+    Level &level = m_levels.first();
+
+    // Make the triangle counter clockwise so that inside pixels have
+    // positive edge functions whatever the winding of the occluder
+    QVector3D v0 = a;
+    QVector3D v1 = b;
+    QVector3D v2 = c;
+    float area = EdgeFunction(v0, v1)(v2.x(), v2.y());
+    if (std::abs(area) < 1e-6f)
+        return;
+    if (area < 0.0f) {
+        std::swap(v1, v2);
+        area = -area;
+    }
+
+    const int minX = std::max(int(std::floor(std::min({v0.x(), v1.x(), v2.x()}))), 0);
+    const int maxX = std::min(int(std::ceil(std::max({v0.x(), v1.x(), v2.x()}))), level.width - 1);
+    const int minY = std::max(int(std::floor(std::min({v0.y(), v1.y(), v2.y()}))), std::max(firstRow, 0));
+    const int maxY = std::min(int(std::ceil(std::max({v0.y(), v1.y(), v2.y()}))), std::min(lastRow, level.height) - 1);
+    if (minX > maxX || minY > maxY)
+        return;
+
+    const EdgeFunction e0(v1, v2);
+    const EdgeFunction e1(v2, v0);
+    const EdgeFunction e2(v0, v1);
+
+    // Depth is interpolated linearly in screen space: z(x, y) = za * x + zb * y + zc
+    const float za = (e0.a * v0.z() + e1.a * v1.z() + e2.a * v2.z()) / area;
+    const float zb = (e0.b * v0.z() + e1.b * v1.z() + e2.b * v2.z()) / area;
+    const float zc = (e0.c * v0.z() + e1.c * v1.z() + e2.c * v2.z()) / area;
+
+    float *depths = level.depths.data();
+
+#if defined(__SSE2__)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 e0a = _mm_set1_ps(e0.a);
+    const __m128 e1a = _mm_set1_ps(e1.a);
+    const __m128 e2a = _mm_set1_ps(e2.a);
+    const __m128 zav = _mm_set1_ps(za);
+    const int startX = minX & ~3;
+
+    for (int y = minY; y <= maxY; ++y) {
+        const float py = float(y) + 0.5f;
+        const __m128 e0Row = _mm_set1_ps(e0.b * py + e0.c);
+        const __m128 e1Row = _mm_set1_ps(e1.b * py + e1.c);
+        const __m128 e2Row = _mm_set1_ps(e2.b * py + e2.c);
+        const __m128 zRow = _mm_set1_ps(zb * py + zc);
+        float *row = depths + y * level.stride;
+
+        for (int x = startX; x <= maxX; x += 4) {
+            const __m128 px = _mm_add_ps(_mm_set1_ps(float(x)), offsets);
+            const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e0a, px), e0Row), zero),
+                                                        _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e1a, px), e1Row), zero)),
+                                             _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e2a, px), e2Row), zero));
+            if (_mm_movemask_ps(inside) == 0)
+                continue;
+            const __m128 z = _mm_add_ps(_mm_mul_ps(zav, px), zRow);
+            const __m128 current = _mm_loadu_ps(row + x);
+            const __m128 nearest = _mm_min_ps(current, z);
+            _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, current)));
+        }
+    }
+#else
+    for (int y = minY; y <= maxY; ++y) {
+        const float py = float(y) + 0.5f;
+        float *row = depths + y * level.stride;
+
+        for (int x = minX; x <= maxX; ++x) {
+            const float px = float(x) + 0.5f;
+            if (e0(px, py) < 0.0f || e1(px, py) < 0.0f || e2(px, py) < 0.0f)
+                continue;
+            row[x] = std::min(row[x], za * px + zb * py + zc);
+        }
+    }
+#endif
+}
+
+float SoftwareDepthBuffer::depth(int x, int y) const
+{
+    const Level &level = m_levels.first();
+    return level.depths.at(y * level.stride + x);
+}
+
+void SoftwareDepthBuffer::buildPyramid()
+{
+    for (int i = 1, m = m_levels.size(); i < m; ++i) {
+        const Level &previous = m_levels.at(i - 1);
+        Level &level = m_levels[i];
+        const float *source = previous.depths.constData();
+        float *destination = level.depths.data();
+
+        for (int y = 0; y < level.height; ++y) {
+            const int y0 = 2 * y;
+            const int y1 = std::min(y0 + 1, previous.height - 1);
+            for (int x = 0; x < level.width; ++x) {
+                const int x0 = 2 * x;
+                const int x1 = std::min(x0 + 1, previous.width - 1);
+                destination[y * level.stride + x] = std::max(std::max(source[y0 * previous.stride + x0],
+                                                                      source[y0 * previous.stride + x1]),
+                                                             std::max(source[y1 * previous.stride + x0],
+                                                                      source[y1 * previous.stride + x1]));
+            }
+        }
+    }
+}
+
+int SoftwareDepthBuffer::levelCount() const Q_DECL_NOTHROW
+{
+    return m_levels.size();
+}
+
+QSize SoftwareDepthBuffer::levelSize(int level) const
+{
+    return QSize(m_levels.at(level).width, m_levels.at(level).height);
+}
+
+float SoftwareDepthBuffer::maxDepth(int level, int x, int y) const
+{
+    const Level &l = m_levels.at(level);
+    return l.depths.at(y * l.stride + x);
+}
+
+// Returns true if a region covering rect whose nearest depth is nearestDepth
+// is entirely behind the rasterized occluders. Requires an up to date pyramid.
+//
+// Occluders are only sampled at pixel centres, so a pixel can be partially
+// covered and its depth is the one at its centre. The region is extended by
+// one pixel on each side: an occluder edge or a depth slope crossing a pixel
+// then also reaches one of the pixels tested around it.
+bool SoftwareDepthBuffer::isOccluded(const QRectF &rect, float nearestDepth) const
+{
+    const Level &level0 = m_levels.first();
+    const int left = int(std::floor(rect.left()));
+    const int right = int(std::ceil(rect.right())) - 1;
+    const int top = int(std::floor(rect.top()));
+    const int bottom = int(std::ceil(rect.bottom())) - 1;
+
+    // Off screen regions are left to frustum culling
+    if (left > level0.width - 1 || right < 0 || top > level0.height - 1 || bottom < 0 || left > right || top > bottom)
+        return false;
+
+    const int minX = std::max(left - 1, 0);
+    const int maxX = std::min(right + 1, level0.width - 1);
+    const int minY = std::max(top - 1, 0);
+    const int maxY = std::min(bottom + 1, level0.height - 1);
+
+    // Pick the finest level where the region spans at most 2x2 cells
+    int l = 0;
+    while (l + 1 < m_levels.size()
+           && ((maxX >> l) - (minX >> l) > 1 || (maxY >> l) - (minY >> l) > 1))
+        ++l;
+
+    const Level &level = m_levels.at(l);
+    for (int y = minY >> l; y <= (maxY >> l); ++y) {
+        for (int x = minX >> l; x <= (maxX >> l); ++x) {
+            if (nearestDepth <= level.depths.at(y * level.stride + x))
+                return false;
+        }
+    }
+    return true;
+}
+
+} // Render
+
+} // Qt3DRender
+
+QT_END_NAMESPACE
@@ -0,0 +1,114 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QT3DRENDER_RENDER_SOFTWAREDEPTHBUFFER_P_H
+#define QT3DRENDER_RENDER_SOFTWAREDEPTHBUFFER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <Qt3DRender/private/qt3drender_global_p.h>
+#include <QRectF>
+#include <QSize>
+#include <QVector>
+#include <QVector3D>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+// CPU side depth buffer used for occlusion culling. Occluders are rasterized
+// into level 0, keeping the nearest depth per pixel. Each upper level of the
+// pyramid keeps the farthest depth of the 2x2 cells it covers so that a single
+// lookup gives a conservative depth for a whole screen region.
+//
+// Coordinates are in pixels with y going down, depths are in [0, 1] with 0
+// being the near plane. Distinct row ranges of level 0 can be rasterized
+// concurrently.
+class Q_AUTOTEST_EXPORT SoftwareDepthBuffer
+{
+public:
+    SoftwareDepthBuffer();
+
+    void resize(const QSize &size);
+    QSize size() const Q_DECL_NOTHROW;
+    void clear();
+
+    void rasterizeTriangle(const QVector3D &a, const QVector3D &b, const QVector3D &c);
+    void rasterizeTriangle(const QVector3D &a, const QVector3D &b, const QVector3D &c,
+                           int firstRow, int lastRow);
+    float depth(int x, int y) const;
+
+    void buildPyramid();
+    int levelCount() const Q_DECL_NOTHROW;
+    QSize levelSize(int level) const;
+    float maxDepth(int level, int x, int y) const;
+
+    bool isOccluded(const QRectF &rect, float nearestDepth) const;
+
+private:
+    struct Level {
+        Level() : width(0), height(0), stride(0) {}
+        QVector<float> depths;
+        int width;
+        int height;
+        int stride;
+    };
+
+    QVector<Level> m_levels;
+};
+
+} // Render
+
+} // Qt3DRender
+
+QT_END_NAMESPACE
+
+#endif // QT3DRENDER_RENDER_SOFTWAREDEPTHBUFFER_P_H
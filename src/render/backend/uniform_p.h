@@ -170,6 +170,7 @@ public:
 
     ValueType valueType() const { return m_valueType; }
     UniformType storedType() const { return m_storedType; }
+    int byteSize() const { return m_data.size() * int(sizeof(float)); }
 
     static UniformValue fromVariant(const QVariant &variant);
 
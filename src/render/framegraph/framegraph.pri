@@ -52,7 +52,10 @@ HEADERS += \
     $$PWD/qframegraphnodecreatedchange_p.h \
     $$PWD/qmemorybarrier.h \
     $$PWD/qmemorybarrier_p.h \
-    $$PWD/memorybarrier_p.h
+    $$PWD/memorybarrier_p.h \
+    $$PWD/qocclusionculling.h \
+    $$PWD/qocclusionculling_p.h \
+    $$PWD/occlusionculling_p.h
 
 SOURCES += \
     $$PWD/cameraselectornode.cpp \
@@ -90,4 +93,6 @@ SOURCES += \
     $$PWD/buffercapture.cpp \
     $$PWD/qframegraphnodecreatedchange.cpp \
     $$PWD/qmemorybarrier.cpp \
-    $$PWD/memorybarrier.cpp
+    $$PWD/memorybarrier.cpp \
+    $$PWD/qocclusionculling.cpp \
+    $$PWD/occlusionculling.cpp
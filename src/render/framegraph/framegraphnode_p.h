@@ -99,7 +99,8 @@ public:
         Surface,
         RenderCapture,
         BufferCapture,
-        MemoryBarrier
+        MemoryBarrier,
+        OcclusionCulling
     };
     FrameGraphNodeType nodeType() const { return m_nodeType; }
 
@@ -143,6 +144,7 @@ public:
 
     Qt3DCore::QBackendNode *create(const Qt3DCore::QNodeCreatedChangeBasePtr &change) const Q_DECL_OVERRIDE
     {
+        m_renderer->markDirty(AbstractRenderer::FrameGraphDirty, nullptr);
         return createBackendFrameGraphNode(change);
     }
 
@@ -153,6 +155,7 @@ public:
 
     void destroy(Qt3DCore::QNodeId id) const Q_DECL_OVERRIDE
     {
+        m_renderer->markDirty(AbstractRenderer::FrameGraphDirty, nullptr);
         m_manager->releaseNode(id);
     }
 
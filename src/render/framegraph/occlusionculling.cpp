@@ -0,0 +1,99 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "occlusionculling_p.h"
+#include <Qt3DCore/qpropertyupdatedchange.h>
+#include <Qt3DRender/private/qocclusionculling_p.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+OcclusionCulling::OcclusionCulling()
+    : FrameGraphNode(FrameGraphNode::OcclusionCulling)
+    , m_depthBufferSize(256, 128)
+{
+}
+
+OcclusionCulling::~OcclusionCulling()
+{
+}
+
+Qt3DCore::QNodeId OcclusionCulling::occluderLayerId() const
+{
+    return m_occluderLayerId;
+}
+
+QSize OcclusionCulling::depthBufferSize() const
+{
+    return m_depthBufferSize;
+}
+
+void OcclusionCulling::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
+{
+    if (e->type() == Qt3DCore::PropertyUpdated) {
+        Qt3DCore::QPropertyUpdatedChangePtr propertyChange = qSharedPointerCast<Qt3DCore::QPropertyUpdatedChange>(e);
+        if (propertyChange->propertyName() == QByteArrayLiteral("occluderLayer")) {
+            m_occluderLayerId = propertyChange->value().value<Qt3DCore::QNodeId>();
+            markDirty(AbstractRenderer::AllDirty);
+        } else if (propertyChange->propertyName() == QByteArrayLiteral("depthBufferSize")) {
+            m_depthBufferSize = propertyChange->value().toSize();
+            markDirty(AbstractRenderer::AllDirty);
+        }
+    }
+    FrameGraphNode::sceneChangeEvent(e);
+}
+
+void OcclusionCulling::initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change)
+{
+    FrameGraphNode::initializeFromPeer(change);
+    const auto typedChange = qSharedPointerCast<Qt3DCore::QNodeCreatedChange<QOcclusionCullingData>>(change);
+    const QOcclusionCullingData &data = typedChange->data;
+    m_occluderLayerId = data.occluderLayerId;
+    m_depthBufferSize = data.depthBufferSize;
+}
+
+} // Render
+
+} // Qt3DRender
+
+QT_END_NAMESPACE
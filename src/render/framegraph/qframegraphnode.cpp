@@ -109,6 +109,9 @@ QFrameGraphNodePrivate::QFrameGraphNodePrivate()
     \row
         \li Qt3DRender::QMemoryBarrier
         \li Places a memory barrier
+    \row
+        \li Qt3DRender::QOcclusionCulling
+        \li Enable occlusion culling
     \endtable
 
  */
@@ -173,6 +176,9 @@ QFrameGraphNodePrivate::QFrameGraphNodePrivate()
     \row
         \li MemoryBarrier
         \li Places a memory barrier
+    \row
+        \li OcclusionCulling
+        \li Enable occlusion culling
     \endtable
 */
 
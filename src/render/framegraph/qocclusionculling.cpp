@@ -0,0 +1,210 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qocclusionculling.h"
+#include "qocclusionculling_p.h"
+#include <Qt3DRender/qlayer.h>
+#include <Qt3DRender/qframegraphnodecreatedchange.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+/*!
+    \class Qt3DRender::QOcclusionCulling
+    \inmodule Qt3DRender
+    \since 5.10
+    \ingroup framegraph
+    \brief Enable occlusion culling for the FrameGraph
+
+    A QOcclusionCulling class enables occlusion culling of the drawable entities
+    based on the camera view. The entities having the occluderLayer are used as
+    occluders: their triangles are rasterized on the CPU into a software depth
+    buffer of size depthBufferSize, from which a hierarchical depth pyramid is
+    built. Drawable entities whose bounding volumes are entirely hidden behind
+    the occluders are then not drawn.
+
+    Occluders should be few and large, such as the walls and floors of a
+    building. Occlusion culling is conservative down to the resolution of the
+    depth buffer: an entity is only discarded if its bounds, extended by one
+    pixel of the depth buffer, are hidden. Gaps between occluders narrower than
+    a pixel may not be seen through. The camera is selected by a
+    QCameraSelector frame graph node in the current hierarchy. QOcclusionCulling is
+    typically combined with QFrustumCulling.
+
+    \sa QCameraSelector, QFrustumCulling, QLayer
+ */
+
+/*!
+    \qmltype OcclusionCulling
+    \inqmlmodule Qt3D.Render
+    \instantiates Qt3DRender::QOcclusionCulling
+    \inherits FrameGraphNode
+    \since 5.10
+    \brief Enable occlusion culling for the FrameGraph
+
+    An OcclusionCulling type enables occlusion culling of the drawable entities
+    based on the camera view. The entities having the occluderLayer are used as
+    occluders: their triangles are rasterized on the CPU into a software depth
+    buffer of size depthBufferSize, from which a hierarchical depth pyramid is
+    built. Drawable entities whose bounding volumes are entirely hidden behind
+    the occluders are then not drawn.
+
+    Occluders should be few and large, such as the walls and floors of a
+    building. Occlusion culling is conservative down to the resolution of the
+    depth buffer: an entity is only discarded if its bounds, extended by one
+    pixel of the depth buffer, are hidden. Gaps between occluders narrower than
+    a pixel may not be seen through. The camera is selected by a
+    CameraSelector frame graph node in the current hierarchy. OcclusionCulling is
+    typically combined with FrustumCulling.
+
+    \sa CameraSelector, FrustumCulling, Layer
+*/
+
+/*!
+    \qmlproperty Layer Qt3D.Render::OcclusionCulling::occluderLayer
+
+    Holds the layer identifying the entities to be used as occluders.
+*/
+
+/*!
+    \property Qt3DRender::QOcclusionCulling::occluderLayer
+
+    Holds the layer identifying the entities to be used as occluders.
+*/
+
+/*!
+    \qmlproperty size Qt3D.Render::OcclusionCulling::depthBufferSize
+
+    Holds the size of the software depth buffer the occluders are rasterized
+    into. Defaults to 256x128.
+*/
+
+/*!
+    \property Qt3DRender::QOcclusionCulling::depthBufferSize
+
+    Holds the size of the software depth buffer the occluders are rasterized
+    into. Defaults to 256x128.
+*/
+
+QOcclusionCullingPrivate::QOcclusionCullingPrivate()
+    : QFrameGraphNodePrivate()
+    , m_occluderLayer(nullptr)
+    , m_depthBufferSize(256, 128)
+{
+}
+
+/*!
+    The constructor creates an instance with the specified \a parent.
+ */
+QOcclusionCulling::QOcclusionCulling(Qt3DCore::QNode *parent)
+    : QFrameGraphNode(*new QOcclusionCullingPrivate, parent)
+{
+}
+
+/*! \internal */
+QOcclusionCulling::QOcclusionCulling(QOcclusionCullingPrivate &dd, Qt3DCore::QNode *parent)
+    : QFrameGraphNode(dd, parent)
+{
+}
+
+/*! \internal */
+QOcclusionCulling::~QOcclusionCulling()
+{
+}
+
+void QOcclusionCulling::setOccluderLayer(QLayer *occluderLayer)
+{
+    Q_D(QOcclusionCulling);
+    if (d->m_occluderLayer != occluderLayer) {
+
+        if (d->m_occluderLayer)
+            d->unregisterDestructionHelper(d->m_occluderLayer);
+
+        // We need to add it as a child of the current node if it has been declared inline
+        // Or not previously added as a child of the current node so that
+        // 1) The backend gets notified about it's creation
+        // 2) When the current node is destroyed, it gets destroyed as well
+        if (occluderLayer && !occluderLayer->parent())
+            occluderLayer->setParent(this);
+        d->m_occluderLayer = occluderLayer;
+
+        // Ensures proper bookkeeping
+        if (d->m_occluderLayer)
+            d->registerDestructionHelper(d->m_occluderLayer, &QOcclusionCulling::setOccluderLayer, d->m_occluderLayer);
+
+        emit occluderLayerChanged(occluderLayer);
+    }
+}
+
+QLayer *QOcclusionCulling::occluderLayer() const
+{
+    Q_D(const QOcclusionCulling);
+    return d->m_occluderLayer;
+}
+
+void QOcclusionCulling::setDepthBufferSize(const QSize &depthBufferSize)
+{
+    Q_D(QOcclusionCulling);
+    if (d->m_depthBufferSize != depthBufferSize) {
+        d->m_depthBufferSize = depthBufferSize;
+        emit depthBufferSizeChanged(depthBufferSize);
+    }
+}
+
+QSize QOcclusionCulling::depthBufferSize() const
+{
+    Q_D(const QOcclusionCulling);
+    return d->m_depthBufferSize;
+}
+
+Qt3DCore::QNodeCreatedChangeBasePtr QOcclusionCulling::createNodeCreationChange() const
+{
+    auto creationChange = QFrameGraphNodeCreatedChangePtr<QOcclusionCullingData>::create(this);
+    QOcclusionCullingData &data = creationChange->data;
+    Q_D(const QOcclusionCulling);
+    data.occluderLayerId = Qt3DCore::qIdForNode(d->m_occluderLayer);
+    data.depthBufferSize = d->m_depthBufferSize;
+    return creationChange;
+}
+
+} // Qt3DRender
+
+QT_END_NAMESPACE
@@ -0,0 +1,87 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QT3DRENDER_QOCCLUSIONCULLING_H
+#define QT3DRENDER_QOCCLUSIONCULLING_H
+
+#include <Qt3DRender/qframegraphnode.h>
+#include <QtCore/QSize>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+class QLayer;
+class QOcclusionCullingPrivate;
+
+class QT3DRENDERSHARED_EXPORT QOcclusionCulling : public QFrameGraphNode
+{
+    Q_OBJECT
+    Q_PROPERTY(Qt3DRender::QLayer *occluderLayer READ occluderLayer WRITE setOccluderLayer NOTIFY occluderLayerChanged)
+    Q_PROPERTY(QSize depthBufferSize READ depthBufferSize WRITE setDepthBufferSize NOTIFY depthBufferSizeChanged)
+
+public:
+    explicit QOcclusionCulling(Qt3DCore::QNode *parent = nullptr);
+    ~QOcclusionCulling();
+
+    QLayer *occluderLayer() const;
+    QSize depthBufferSize() const;
+
+public Q_SLOTS:
+    void setOccluderLayer(QLayer *occluderLayer);
+    void setDepthBufferSize(const QSize &depthBufferSize);
+
+Q_SIGNALS:
+    void occluderLayerChanged(QLayer *occluderLayer);
+    void depthBufferSizeChanged(const QSize &depthBufferSize);
+
+protected:
+    explicit QOcclusionCulling(QOcclusionCullingPrivate &dd, Qt3DCore::QNode *parent = nullptr);
+
+private:
+    Q_DECLARE_PRIVATE(QOcclusionCulling)
+    Qt3DCore::QNodeCreatedChangeBasePtr createNodeCreationChange() const Q_DECL_OVERRIDE;
+};
+
+} // Qt3DRender
+
+QT_END_NAMESPACE
+
+#endif // QT3DRENDER_QOCCLUSIONCULLING_H
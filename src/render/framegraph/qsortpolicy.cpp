@@ -50,6 +50,7 @@ namespace Qt3DRender {
 
 QSortPolicyPrivate::QSortPolicyPrivate()
     : QFrameGraphNodePrivate()
+    , m_instancingEnabled(false)
 {
 }
 
@@ -104,6 +105,52 @@ QSortPolicyPrivate::QSortPolicyPrivate()
     Specifies the sorting types to be used.
 */
 
+/*!
+    \property QSortPolicy::instancingEnabled
+    \since 5.10
+
+    Holds whether draw calls that only differ by their world transform are
+    merged into a single instanced draw call once sorted.
+
+    Only consecutive draw calls sharing the same geometry renderer, shader,
+    render states and parameter values are merged. The shader program has to
+    declare a \c mat4 vertex attribute named \c instanceModelMatrix; it is
+    fed with the world transform of each merged entity, and the model
+    dependent uniforms such as \c modelMatrix or \c mvp are not updated per
+    entity anymore. Merging requires OpenGL 3.3 or OpenGL ES 3.0.
+
+    On desktop OpenGL, consecutive indexed draw calls of different geometries
+    are also batched together when their geometries share the same vertex
+    attributes and index buffer, differing only by their index offset. Such
+    batches are submitted with a single \c glMultiDrawElementsIndirect call
+    on OpenGL 4.3 and with one draw call per geometry otherwise.
+
+    The default value is \c false.
+*/
+
+/*!
+    \qmlproperty bool SortPolicy::instancingEnabled
+    \since 5.10
+
+    Holds whether draw calls that only differ by their world transform are
+    merged into a single instanced draw call once sorted.
+
+    Only consecutive draw calls sharing the same geometry renderer, shader,
+    render states and parameter values are merged. The shader program has to
+    declare a \c mat4 vertex attribute named \c instanceModelMatrix; it is
+    fed with the world transform of each merged entity, and the model
+    dependent uniforms such as \c modelMatrix or \c mvp are not updated per
+    entity anymore. Merging requires OpenGL 3.3 or OpenGL ES 3.0.
+
+    On desktop OpenGL, consecutive indexed draw calls of different geometries
+    are also batched together when their geometries share the same vertex
+    attributes and index buffer, differing only by their index offset. Such
+    batches are submitted with a single \c glMultiDrawElementsIndirect call
+    on OpenGL 4.3 and with one draw call per geometry otherwise.
+
+    The default value is \c false.
+*/
+
 /*!
     Constructs QSortPolicy with given \a parent.
  */
@@ -129,6 +176,7 @@ QNodeCreatedChangeBasePtr QSortPolicy::createNodeCreationChange() const
     QSortPolicyData &data = creationChange->data;
     Q_D(const QSortPolicy);
     data.sortTypes = d->m_sortTypes;
+    data.instancingEnabled = d->m_instancingEnabled;
     return creationChange;
 }
 
@@ -141,6 +189,12 @@ QVector<QSortPolicy::SortType> QSortPolicy::sortTypes() const
     return d->m_sortTypes;
 }
 
+bool QSortPolicy::isInstancingEnabled() const
+{
+    Q_D(const QSortPolicy);
+    return d->m_instancingEnabled;
+}
+
 QVector<int> QSortPolicy::sortTypesInt() const
 {
     Q_D(const QSortPolicy);
@@ -166,6 +220,16 @@ void QSortPolicy::setSortTypes(const QVector<int> &sortTypesInt)
     setSortTypes(sortTypes);
 }
 
+void QSortPolicy::setInstancingEnabled(bool instancingEnabled)
+{
+    Q_D(QSortPolicy);
+    if (d->m_instancingEnabled == instancingEnabled)
+        return;
+
+    d->m_instancingEnabled = instancingEnabled;
+    emit instancingEnabledChanged(instancingEnabled);
+}
+
 } // namespace Qt3DRender
 
 QT_END_NAMESPACE
@@ -52,6 +52,7 @@ class QT3DRENDERSHARED_EXPORT QSortPolicy : public QFrameGraphNode
 {
     Q_OBJECT
     Q_PROPERTY(QVector<int> sortTypes READ sortTypesInt WRITE setSortTypes NOTIFY sortTypesChanged)
+    Q_PROPERTY(bool instancingEnabled READ isInstancingEnabled WRITE setInstancingEnabled NOTIFY instancingEnabledChanged REVISION 10)
 public:
     explicit QSortPolicy(Qt3DCore::QNode *parent = nullptr);
     ~QSortPolicy();
@@ -65,14 +66,17 @@ public:
 
     QVector<SortType> sortTypes() const;
     QVector<int> sortTypesInt() const;
+    bool isInstancingEnabled() const;
 
 public Q_SLOTS:
     void setSortTypes(const QVector<SortType> &sortTypes);
     void setSortTypes(const QVector<int> &sortTypesInt);
+    Q_REVISION(10) void setInstancingEnabled(bool instancingEnabled);
 
 Q_SIGNALS:
     void sortTypesChanged(const QVector<SortType> &sortTypes);
     void sortTypesChanged(const QVector<int> &sortTypes);
+    Q_REVISION(10) void instancingEnabledChanged(bool instancingEnabled);
 
 protected:
     explicit QSortPolicy(QSortPolicyPrivate &dd, Qt3DCore::QNode *parent = nullptr);
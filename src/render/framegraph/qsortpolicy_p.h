@@ -65,12 +65,14 @@ public:
     QSortPolicyPrivate();
     Q_DECLARE_PUBLIC(QSortPolicy)
     QVector<QSortPolicy::SortType> m_sortTypes;
+    bool m_instancingEnabled;
 };
 
 
 struct QSortPolicyData
 {
     QVector<QSortPolicy::SortType> sortTypes;
+    bool instancingEnabled;
 };
 
 } // namespace Qt3DRender
@@ -97,10 +97,10 @@ void RenderPassFilter::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         const auto change = qSharedPointerCast<QPropertyNodeAddedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("match")) {
             appendFilter(change->addedNodeId());
-            markDirty(AbstractRenderer::AllDirty);
+            markDirty(AbstractRenderer::MaterialDirty);
         } else if (change->propertyName() == QByteArrayLiteral("parameter")) {
             m_parameterPack.appendParameter(change->addedNodeId());
-            markDirty(AbstractRenderer::AllDirty);
+            markDirty(AbstractRenderer::MaterialDirty);
         }
         break;
     }
@@ -109,10 +109,10 @@ void RenderPassFilter::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         const auto change = qSharedPointerCast<QPropertyNodeRemovedChange>(e);
         if (change->propertyName() == QByteArrayLiteral("match")) {
             removeFilter(change->removedNodeId());
-            markDirty(AbstractRenderer::AllDirty);
+            markDirty(AbstractRenderer::MaterialDirty);
         } else if (change->propertyName() == QByteArrayLiteral("parameter")) {
             m_parameterPack.removeParameter(change->removedNodeId());
-            markDirty(AbstractRenderer::AllDirty);
+            markDirty(AbstractRenderer::MaterialDirty);
         }
         break;
     }
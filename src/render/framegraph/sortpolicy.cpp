@@ -50,6 +50,7 @@ namespace Render {
 
 SortPolicy::SortPolicy()
     : FrameGraphNode(FrameGraphNode::SortMethod)
+    , m_instancingEnabled(false)
 {
 }
 
@@ -61,6 +62,8 @@ void SortPolicy::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
             auto sortTypesInt = propertyChange->value().value<QVector<int>>();
             m_sortTypes.clear();
             transformVector(sortTypesInt, m_sortTypes);
+        } else if (propertyChange->propertyName() == QByteArrayLiteral("instancingEnabled")) {
+            m_instancingEnabled = propertyChange->value().toBool();
         }
     }
     markDirty(AbstractRenderer::AllDirty);
@@ -72,12 +75,18 @@ QVector<QSortPolicy::SortType> SortPolicy::sortTypes() const
     return m_sortTypes;
 }
 
+bool SortPolicy::isInstancingEnabled() const
+{
+    return m_instancingEnabled;
+}
+
 void SortPolicy::initializeFromPeer(const QNodeCreatedChangeBasePtr &change)
 {
     FrameGraphNode::initializeFromPeer(change);
     const auto typedChange = qSharedPointerCast<Qt3DCore::QNodeCreatedChange<QSortPolicyData>>(change);
     const QSortPolicyData &data = typedChange->data;
     m_sortTypes = data.sortTypes;
+    m_instancingEnabled = data.instancingEnabled;
 }
 
 } // namepace Render
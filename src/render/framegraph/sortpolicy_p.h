@@ -68,11 +68,13 @@ public:
     void sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e) Q_DECL_OVERRIDE;
 
     QVector<Qt3DRender::QSortPolicy::SortType> sortTypes() const;
+    bool isInstancingEnabled() const;
 
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
 
     QVector<Qt3DRender::QSortPolicy::SortType> m_sortTypes;
+    bool m_instancingEnabled;
 };
 
 } // namespace Render
@@ -83,6 +83,7 @@
 #include <Qt3DRender/qrendercapture.h>
 #include <Qt3DRender/qbuffercapture.h>
 #include <Qt3DRender/qmemorybarrier.h>
+#include <Qt3DRender/qocclusionculling.h>
 
 #include <Qt3DRender/private/cameraselectornode_p.h>
 #include <Qt3DRender/private/layerfilternode_p.h>
@@ -133,6 +134,7 @@
 #include <Qt3DRender/private/technique_p.h>
 #include <Qt3DRender/private/offscreensurfacehelper_p.h>
 #include <Qt3DRender/private/memorybarrier_p.h>
+#include <Qt3DRender/private/occlusionculling_p.h>
 
 #include <private/qrenderpluginfactory_p.h>
 #include <private/qrenderplugin_p.h>
@@ -252,6 +254,7 @@ void QRenderAspectPrivate::registerBackendTypes()
     q->registerBackendType<QRenderCapture>(QSharedPointer<Render::FrameGraphNodeFunctor<Render::RenderCapture, QRenderCapture> >::create(m_renderer));
     q->registerBackendType<QBufferCapture>(QSharedPointer<Render::FrameGraphNodeFunctor<Render::BufferCapture, QBufferCapture> >::create(m_renderer));
     q->registerBackendType<QMemoryBarrier>(QSharedPointer<Render::FrameGraphNodeFunctor<Render::MemoryBarrier, QMemoryBarrier> >::create(m_renderer));
+    q->registerBackendType<QOcclusionCulling>(QSharedPointer<Render::FrameGraphNodeFunctor<Render::OcclusionCulling, QOcclusionCulling> >::create(m_renderer));
 
     // Picking
     q->registerBackendType<QObjectPicker>(QSharedPointer<Render::NodeFunctor<Render::ObjectPicker, Render::ObjectPickerManager> >::create(m_renderer));
@@ -316,6 +319,7 @@ void QRenderAspectPrivate::unregisterBackendTypes()
     unregisterBackendType<QRenderCapture>();
     unregisterBackendType<QBufferCapture>();
     unregisterBackendType<QMemoryBarrier>();
+    unregisterBackendType<QOcclusionCulling>();
 
     // Picking
     unregisterBackendType<QObjectPicker>();
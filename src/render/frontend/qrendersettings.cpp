@@ -79,6 +79,7 @@ QRenderSettingsPrivate::QRenderSettingsPrivate()
     : Qt3DCore::QComponentPrivate()
     , m_activeFrameGraph(nullptr)
     , m_renderPolicy(QRenderSettings::Always)
+    , m_textureMemoryBudget(0)
 {
 }
 
@@ -199,6 +200,44 @@ QRenderSettings::RenderPolicy QRenderSettings::renderPolicy() const
     return d->m_renderPolicy;
 }
 
+/*!
+    \qmlproperty int RenderSettings::textureMemoryBudget
+    \since 5.10
+
+    Holds the amount of texture memory, in megabytes, the renderer tries to
+    stay within. When the textures uploaded to the GPU exceed it, the least
+    recently used textures are released and uploaded again once needed,
+    smallest mip levels first. Textures used by the frame being rendered and
+    render target textures are never released.
+
+    The budget is compared against the size of the texture data provided to
+    the renderer, not the memory actually allocated by the OpenGL driver,
+    which also depends on the internal formats and generated mip levels.
+
+    The default value is 0, which means there is no budget.
+*/
+/*!
+    \property QRenderSettings::textureMemoryBudget
+    \since 5.10
+
+    Holds the amount of texture memory, in megabytes, the renderer tries to
+    stay within. When the textures uploaded to the GPU exceed it, the least
+    recently used textures are released and uploaded again once needed,
+    smallest mip levels first. Textures used by the frame being rendered and
+    render target textures are never released.
+
+    The budget is compared against the size of the texture data provided to
+    the renderer, not the memory actually allocated by the OpenGL driver,
+    which also depends on the internal formats and generated mip levels.
+
+    The default value is 0, which means there is no budget.
+*/
+int QRenderSettings::textureMemoryBudget() const
+{
+    Q_D(const QRenderSettings);
+    return d->m_textureMemoryBudget;
+}
+
 void QRenderSettings::setActiveFrameGraph(QFrameGraphNode *activeFrameGraph)
 {
     Q_D(QRenderSettings);
@@ -238,6 +277,17 @@ void QRenderSettings::setRenderPolicy(QRenderSettings::RenderPolicy renderPolicy
     emit renderPolicyChanged(renderPolicy);
 }
 
+void QRenderSettings::setTextureMemoryBudget(int textureMemoryBudget)
+{
+    Q_D(QRenderSettings);
+    textureMemoryBudget = qMax(0, textureMemoryBudget);
+    if (d->m_textureMemoryBudget == textureMemoryBudget)
+        return;
+
+    d->m_textureMemoryBudget = textureMemoryBudget;
+    emit textureMemoryBudgetChanged(textureMemoryBudget);
+}
+
 Qt3DCore::QNodeCreatedChangeBasePtr QRenderSettings::createNodeCreationChange() const
 {
     auto creationChange = Qt3DCore::QNodeCreatedChangePtr<QRenderSettingsData>::create(this);
@@ -245,6 +295,7 @@ Qt3DCore::QNodeCreatedChangeBasePtr QRenderSettings::createNodeCreationChange()
     Q_D(const QRenderSettings);
     data.activeFrameGraphId = qIdForNode(d->m_activeFrameGraph);
     data.renderPolicy = d->m_renderPolicy;
+    data.textureMemoryBudget = d->m_textureMemoryBudget;
     data.pickMethod = d->m_pickingSettings.pickMethod();
     data.pickResultMode = d->m_pickingSettings.pickResultMode();
     data.faceOrientationPickingMode = d->m_pickingSettings.faceOrientationPickingMode();
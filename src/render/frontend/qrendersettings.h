@@ -58,6 +58,7 @@ class QT3DRENDERSHARED_EXPORT QRenderSettings : public Qt3DCore::QComponent
     Q_PROPERTY(Qt3DRender::QPickingSettings* pickingSettings READ pickingSettings CONSTANT)
     Q_PROPERTY(RenderPolicy renderPolicy READ renderPolicy WRITE setRenderPolicy NOTIFY renderPolicyChanged)
     Q_PROPERTY(Qt3DRender::QFrameGraphNode *activeFrameGraph READ activeFrameGraph WRITE setActiveFrameGraph NOTIFY activeFrameGraphChanged)
+    Q_PROPERTY(int textureMemoryBudget READ textureMemoryBudget WRITE setTextureMemoryBudget NOTIFY textureMemoryBudgetChanged REVISION 10)
     Q_CLASSINFO("DefaultProperty", "activeFrameGraph")
 
 public:
@@ -73,14 +74,17 @@ public:
     QPickingSettings* pickingSettings();
     QFrameGraphNode *activeFrameGraph() const;
     RenderPolicy renderPolicy() const;
+    int textureMemoryBudget() const;
 
 public Q_SLOTS:
     void setActiveFrameGraph(QFrameGraphNode *activeFrameGraph);
     void setRenderPolicy(RenderPolicy renderPolicy);
+    Q_REVISION(10) void setTextureMemoryBudget(int textureMemoryBudget);
 
 Q_SIGNALS:
     void activeFrameGraphChanged(QFrameGraphNode *activeFrameGraph);
     void renderPolicyChanged(RenderPolicy renderPolicy);
+    Q_REVISION(10) void textureMemoryBudgetChanged(int textureMemoryBudget);
 
 protected:
     Q_DECLARE_PRIVATE(QRenderSettings)
@@ -70,6 +70,7 @@ public:
     QPickingSettings m_pickingSettings;
     QFrameGraphNode *m_activeFrameGraph;
     QRenderSettings::RenderPolicy m_renderPolicy;
+    int m_textureMemoryBudget;
 
     void _q_onPickingMethodChanged(QPickingSettings::PickMethod pickMethod);
     void _q_onPickResultModeChanged(QPickingSettings::PickResultMode pickResultMode);
@@ -85,6 +86,7 @@ struct QRenderSettingsData
     QPickingSettings::PickMethod pickMethod;
     QPickingSettings::PickResultMode pickResultMode;
     QPickingSettings::FaceOrientationPickingMode faceOrientationPickingMode;
+    int textureMemoryBudget;
 };
 
 } // namespace Qt3Drender
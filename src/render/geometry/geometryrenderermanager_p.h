@@ -63,7 +63,7 @@ namespace Render {
 class Q_AUTOTEST_EXPORT GeometryRendererManager : public Qt3DCore::QResourceManager<
         GeometryRenderer,
         Qt3DCore::QNodeId,
-        16,
+        32,
         Qt3DCore::ArrayAllocatingPolicy,
         Qt3DCore::ObjectLevelLockingPolicy>
 {
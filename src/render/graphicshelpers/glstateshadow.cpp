@@ -0,0 +1,140 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "glstateshadow_p.h"
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+GLStateShadow::GLStateShadow()
+{
+    resetCounters();
+    std::fill(m_previousFrameRedundantCalls, m_previousFrameRedundantCalls + CallTypeCount, 0);
+}
+
+bool GLStateShadow::updateUniform(GLuint programId, int location, const UniformValue &value)
+{
+    Qt3DCore::QFlatHash<int, UniformValue> &uniforms = m_programs[programId].uniforms;
+    if (uniforms.contains(location)) {
+        UniformValue &shadowed = uniforms[location];
+        if (shadowed == value) {
+            ++m_redundantCalls[UniformUpload];
+            return false;
+        }
+        shadowed = value;
+        return true;
+    }
+    uniforms.insert(location, value);
+    return true;
+}
+
+bool GLStateShadow::updateUniformBlockBinding(GLuint programId, GLuint blockIndex, GLuint bindingPoint)
+{
+    Qt3DCore::QFlatHash<GLuint, GLuint> &blockBindings = m_programs[programId].blockBindings;
+    // Binding points are offset by one so that 0 means unknown
+    GLuint &shadowed = blockBindings[blockIndex];
+    if (shadowed == bindingPoint + 1) {
+        ++m_redundantCalls[UniformBlockBinding];
+        return false;
+    }
+    shadowed = bindingPoint + 1;
+    return true;
+}
+
+bool GLStateShadow::updateBufferBinding(int target, GLuint bindingPoint, GLuint bufferId)
+{
+    // Buffer names are never 0 for the buffers we bind
+    GLuint &shadowed = m_bufferBindings[bindingKey(target, bindingPoint)];
+    if (shadowed == bufferId) {
+        ++m_redundantCalls[BufferBinding];
+        return false;
+    }
+    shadowed = bufferId;
+    return true;
+}
+
+void GLStateShadow::resetCounters()
+{
+    std::fill(m_redundantCalls, m_redundantCalls + CallTypeCount, 0);
+}
+
+void GLStateShadow::startFrame()
+{
+    std::copy(m_redundantCalls, m_redundantCalls + CallTypeCount, m_previousFrameRedundantCalls);
+    resetCounters();
+}
+
+void GLStateShadow::removeProgram(GLuint programId)
+{
+    m_programs.remove(programId);
+}
+
+void GLStateShadow::removeBuffer(GLuint bufferId)
+{
+    QVector<quint64> keys;
+    for (auto it = m_bufferBindings.cbegin(), end = m_bufferBindings.cend(); it != end; ++it) {
+        if (it.value() == bufferId)
+            keys.push_back(it.key());
+    }
+    for (quint64 key : qAsConst(keys))
+        m_bufferBindings.remove(key);
+}
+
+void GLStateShadow::resetBufferBindings()
+{
+    m_bufferBindings.clear();
+}
+
+void GLStateShadow::reset()
+{
+    m_programs.clear();
+    m_bufferBindings.clear();
+}
+
+} // namespace Render
+
+} // namespace Qt3DRender
+
+QT_END_NAMESPACE
@@ -0,0 +1,132 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QT3DRENDER_RENDER_GLSTATESHADOW_P_H
+#define QT3DRENDER_RENDER_GLSTATESHADOW_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QOpenGLContext>
+#include <QHash>
+#include <Qt3DCore/private/qflathash_p.h>
+#include <Qt3DRender/private/uniform_p.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+// Shadow copy of the OpenGL state set by the GraphicsContext when submitting
+// commands. Uniform values and uniform block bindings are program state and
+// are tracked per program, buffers bound to indexed binding points are
+// context state.
+//
+// The update methods return whether the value differs from the shadowed one,
+// in which case the caller has to issue the GL call. Otherwise the call is
+// counted as redundant.
+class Q_AUTOTEST_EXPORT GLStateShadow
+{
+public:
+    enum CallType {
+        UniformUpload = 0,
+        UniformBlockBinding,
+        BufferBinding,
+        VertexArrayBinding,
+        CallTypeCount
+    };
+
+    GLStateShadow();
+
+    bool updateUniform(GLuint programId, int location, const UniformValue &value);
+    bool updateUniformBlockBinding(GLuint programId, GLuint blockIndex, GLuint bindingPoint);
+    bool updateBufferBinding(int target, GLuint bindingPoint, GLuint bufferId);
+
+    // For redundant calls detected outside of the shadow
+    void countRedundantCall(CallType type) { ++m_redundantCalls[type]; }
+    int redundantCallCount(CallType type) const { return m_redundantCalls[type]; }
+    void resetCounters();
+
+    // Keeps the counters of the frame that just ended available until the
+    // next one ends and restarts counting
+    void startFrame();
+    int previousFrameRedundantCallCount(CallType type) const { return m_previousFrameRedundantCalls[type]; }
+
+    // The state of a new program can't be known, neither can be the one of
+    // binding points after a buffer is deleted or reallocated
+    void removeProgram(GLuint programId);
+    void removeBuffer(GLuint bufferId);
+    void resetBufferBindings();
+    void reset();
+
+private:
+    struct ProgramState
+    {
+        Qt3DCore::QFlatHash<int, UniformValue> uniforms;
+        Qt3DCore::QFlatHash<GLuint, GLuint> blockBindings;
+    };
+
+    static quint64 bindingKey(int target, GLuint bindingPoint)
+    {
+        return (quint64(uint(target)) << 32) | bindingPoint;
+    }
+
+    QHash<GLuint, ProgramState> m_programs;
+    Qt3DCore::QFlatHash<quint64, GLuint> m_bufferBindings;
+    int m_redundantCalls[CallTypeCount];
+    int m_previousFrameRedundantCalls[CallTypeCount];
+};
+
+} // namespace Render
+
+} // namespace Qt3DRender
+
+QT_END_NAMESPACE
+
+#endif // QT3DRENDER_RENDER_GLSTATESHADOW_P_H
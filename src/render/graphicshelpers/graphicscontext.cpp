@@ -60,6 +60,7 @@
 #include <Qt3DRender/private/attachmentpack_p.h>
 #include <Qt3DRender/private/qbuffer_p.h>
 #include <QOpenGLShaderProgram>
+#include <QOpenGLExtraFunctions>
 
 #if !defined(QT_OPENGL_ES_2)
 #include <QOpenGLFunctions_2_0>
@@ -89,6 +90,18 @@ QT_BEGIN_NAMESPACE
 #define GL_DRAW_FRAMEBUFFER 0x8CA9
 #endif
 
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
 namespace {
 
 QOpenGLShader::ShaderType shaderType(Qt3DRender::QShaderProgram::ShaderType type)
@@ -140,6 +153,24 @@ GLBuffer::Type bufferTypeToGLBufferType(QBuffer::BufferType type)
     }
 }
 
+bool programBinariesSupported(QOpenGLContext *ctx)
+{
+    // glGetProgramBinary and glProgramBinary are core in OpenGL ES 3.0 and
+    // OpenGL 4.1. The OES variant of OpenGL ES 2.0 uses other entry points.
+    const QSurfaceFormat format = ctx->format();
+    const bool hasEntryPoints = ctx->isOpenGLES()
+            ? format.majorVersion() >= 3
+            : (format.version() >= qMakePair(4, 1)
+               || ctx->hasExtension(QByteArrayLiteral("GL_ARB_get_program_binary")));
+    if (!hasEntryPoints)
+        return false;
+
+    // Drivers may support the API without supporting any binary format
+    GLint formats = 0;
+    ctx->functions()->glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
 } // anonymous
 
 unsigned int nextFreeContextId()
@@ -160,9 +191,11 @@ GraphicsContext::GraphicsContext()
     , m_surface(nullptr)
     , m_glHelper(nullptr)
     , m_ownCurrent(true)
+    , m_supportsProgramBinaries(false)
     , m_activeShader(nullptr)
     , m_activeShaderDNA(0)
     , m_renderTargetFormat(QAbstractTexture::NoFormat)
+    , m_currentFrame(0)
     , m_currClearStencilValue(0)
     , m_currClearDepthValue(1.f)
     , m_currClearColorValue(0,0,0,0)
@@ -170,6 +203,7 @@ GraphicsContext::GraphicsContext()
     , m_activeFBO(0)
     , m_defaultFBO(0)
     , m_boundArrayBuffer(nullptr)
+    , m_instanceTransformLocation(-1)
     , m_stateSet(nullptr)
     , m_renderer(nullptr)
     , m_uboTempArray(QByteArray(1024, 0))
@@ -211,6 +245,22 @@ void GraphicsContext::initialize()
 
     m_defaultFBO = m_gl->defaultFramebufferObject();
     qCDebug(Backend) << "VAO support = " << m_supportsVAO;
+
+    // Program binaries are only valid for the driver that produced them
+    m_supportsProgramBinaries = programBinariesSupported(m_gl);
+    if (m_supportsProgramBinaries) {
+        QOpenGLFunctions *f = m_gl->functions();
+        const QByteArray driverKey = QByteArray(reinterpret_cast<const char *>(f->glGetString(GL_VENDOR)))
+                + '\n' + reinterpret_cast<const char *>(f->glGetString(GL_RENDERER))
+                + '\n' + reinterpret_cast<const char *>(f->glGetString(GL_VERSION));
+        m_shaderBinaryCache.setDriverKey(driverKey);
+        m_shaderBinaryCache.setCacheDirectory(ShaderBinaryCache::defaultCacheDirectory());
+        // Programs no session ran in a while are dropped from the cache
+        const int maxUnusedShaderCacheSessions = 10;
+        m_shaderBinaryCache.beginSession(maxUnusedShaderCacheSessions);
+        m_programsToPrewarm = m_shaderBinaryCache.recentlyUsedPrograms();
+    }
+    qCDebug(Backend) << "Program binary cache = " << m_shaderBinaryCache.isEnabled();
 }
 
 void GraphicsContext::resolveRenderTargetFormat()
@@ -294,11 +344,23 @@ bool GraphicsContext::beginDrawing(QSurface *surface)
 
     m_boundArrayBuffer = nullptr;
 
+    // Indexed buffer bindings may have been changed by whoever shares the
+    // context, the redundant call counters are kept per frame
+    m_glStateShadow.resetBufferBindings();
+    m_glStateShadow.startFrame();
+
+    // Spread the creation of the programs cached on disk over several frames
+    const int maxPrewarmedProgramsPerFrame = 4;
+    prewarmShaderPrograms(maxPrewarmedProgramsPerFrame);
+
     static int callCount = 0;
     ++callCount;
     const int shaderPurgePeriod = 600;
-    if (callCount % shaderPurgePeriod == 0)
+    if (callCount % shaderPurgePeriod == 0) {
         m_shaderCache.purge();
+        releasePrewarmedShaderPrograms();
+        m_shaderBinaryCache.saveUsage();
+    }
 
     return true;
 }
@@ -396,7 +458,11 @@ void GraphicsContext::setViewport(const QRectF &viewport, const QSize &surfaceSi
 void GraphicsContext::releaseOpenGL()
 {
     m_shaderCache.clear();
+    releasePrewarmedShaderPrograms();
+    m_programsToPrewarm.clear();
+    m_shaderBinaryCache.saveUsage();
     m_renderBufferHash.clear();
+    m_glStateShadow.reset();
 
     // Stop and destroy the OpenGL logger
     if (m_debugLogger) {
@@ -429,6 +495,16 @@ void GraphicsContext::activateGLHelper()
     }
 }
 
+void GraphicsContext::setGraphicsHelper(QSurface *surface, GraphicsHelperInterface *helper)
+{
+    GraphicsHelperInterface *previousHelper = m_glHelpers.take(surface);
+    if (previousHelper != helper)
+        delete previousHelper;
+    m_glHelpers.insert(surface, helper);
+    if (m_surface == surface)
+        m_glHelper = helper;
+}
+
 bool GraphicsContext::hasValidGLHelper() const
 {
     return m_glHelper != nullptr;
@@ -466,10 +542,24 @@ void GraphicsContext::doneCurrent()
 
 QOpenGLShaderProgram *GraphicsContext::createShaderProgram(Shader *shaderNode)
 {
+    const auto shaderCode = shaderNode->shaderCode();
+    const QByteArray sourceHash = m_shaderBinaryCache.isEnabled()
+            ? ShaderBinaryCache::sourceHash(shaderCode, shaderNode->fragOutputs())
+            : QByteArray();
+
+    // Use the binary of a previous run if there is one
+    if (!sourceHash.isEmpty()) {
+        QOpenGLShaderProgram *cachedProgram = takeCachedShaderProgram(shaderNode->dna(), sourceHash);
+        if (cachedProgram) {
+            shaderNode->setLog(QString());
+            shaderNode->setStatus(QShaderProgram::Ready);
+            return cachedProgram;
+        }
+    }
+
     QScopedPointer<QOpenGLShaderProgram> shaderProgram(new QOpenGLShaderProgram);
 
     // Compile shaders
-    const auto shaderCode = shaderNode->shaderCode();
     QString logs;
     for (int i = QShaderProgram::Vertex; i <= QShaderProgram::Compute; ++i) {
         QShaderProgram::ShaderType type = static_cast<const QShaderProgram::ShaderType>(i);
@@ -486,6 +576,9 @@ QOpenGLShaderProgram *GraphicsContext::createShaderProgram(Shader *shaderNode)
     // fragOutputs, they should all be the same for a given shader
     bindFragOutputs(shaderProgram->programId(), shaderNode->fragOutputs());
 
+    if (!sourceHash.isEmpty())
+        m_gl->extraFunctions()->glProgramParameteri(shaderProgram->programId(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
     const bool linkSucceeded = shaderProgram->link();
     logs += shaderProgram->log();
     shaderNode->setLog(logs);
@@ -494,14 +587,128 @@ QOpenGLShaderProgram *GraphicsContext::createShaderProgram(Shader *shaderNode)
     if (!linkSucceeded)
         return nullptr;
 
+    if (!sourceHash.isEmpty())
+        storeShaderProgramBinary(shaderNode->dna(), sourceHash, shaderProgram.data());
+
     // take from scoped-pointer so it doesn't get deleted
     return shaderProgram.take();
 }
 
+// Returns the program built from sourceHash for dna, if it was prewarmed or
+// if its binary is cached on disk
+QOpenGLShaderProgram *GraphicsContext::takeCachedShaderProgram(ProgramDNA dna, const QByteArray &sourceHash)
+{
+    m_programsToPrewarm.removeOne(dna);
+
+    const auto it = m_prewarmedPrograms.find(dna);
+    if (it != m_prewarmedPrograms.end()) {
+        const PrewarmedProgram prewarmed = it.value();
+        m_prewarmedPrograms.erase(it);
+        if (prewarmed.sourceHash == sourceHash) {
+            m_shaderBinaryCache.markUsed(dna);
+            return prewarmed.program;
+        }
+        // Same DNA but different sources
+        delete prewarmed.program;
+        return nullptr;
+    }
+
+    ShaderBinaryCache::Binary binary;
+    if (!m_shaderBinaryCache.load(dna, &binary) || binary.sourceHash != sourceHash)
+        return nullptr;
+    QOpenGLShaderProgram *shaderProgram = createShaderProgramFromBinary(dna, binary);
+    if (shaderProgram)
+        m_shaderBinaryCache.markUsed(dna);
+    return shaderProgram;
+}
+
+QOpenGLShaderProgram *GraphicsContext::createShaderProgramFromBinary(ProgramDNA dna, const ShaderBinaryCache::Binary &binary)
+{
+    QScopedPointer<QOpenGLShaderProgram> shaderProgram(new QOpenGLShaderProgram);
+    if (!shaderProgram->create())
+        return nullptr;
+
+    m_gl->extraFunctions()->glProgramBinary(shaderProgram->programId(), binary.format,
+                                            binary.data.constData(), binary.data.size());
+
+    // Without any shader attached, link only checks whether the driver
+    // accepted the binary. It may not, after a driver update for instance.
+    if (!shaderProgram->link()) {
+        qCDebug(Shaders) << "Cached program binary rejected by the driver" << dna;
+        m_shaderBinaryCache.remove(dna);
+        return nullptr;
+    }
+
+    return shaderProgram.take();
+}
+
+void GraphicsContext::storeShaderProgramBinary(ProgramDNA dna, const QByteArray &sourceHash, QOpenGLShaderProgram *shaderProgram)
+{
+    QOpenGLExtraFunctions *f = m_gl->extraFunctions();
+    GLint length = 0;
+    f->glGetProgramiv(shaderProgram->programId(), GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    ShaderBinaryCache::Binary binary;
+    binary.sourceHash = sourceHash;
+    binary.data.resize(length);
+    GLenum format = 0;
+    f->glGetProgramBinary(shaderProgram->programId(), length, nullptr, &format, binary.data.data());
+    binary.format = format;
+
+    if (!m_shaderBinaryCache.store(dna, binary))
+        qCDebug(Shaders) << "Failed to write program binary to" << m_shaderBinaryCache.cacheDirectory();
+}
+
+void GraphicsContext::prewarmShaderPrograms(int maxPrograms)
+{
+    if (m_programsToPrewarm.isEmpty())
+        return;
+    if (!m_supportsProgramBinaries || !m_shaderBinaryCache.isEnabled()) {
+        m_programsToPrewarm.clear();
+        return;
+    }
+
+    int createdPrograms = 0;
+    while (!m_programsToPrewarm.isEmpty() && createdPrograms < maxPrograms) {
+        const ProgramDNA dna = m_programsToPrewarm.takeLast();
+        if (m_prewarmedPrograms.contains(dna) || m_shaderCache.getShaderProgramForDNA(dna))
+            continue;
+
+        ShaderBinaryCache::Binary binary;
+        if (!m_shaderBinaryCache.load(dna, &binary))
+            continue;
+
+        // Binaries the driver rejects are removed from the cache
+        QOpenGLShaderProgram *shaderProgram = createShaderProgramFromBinary(dna, binary);
+        ++createdPrograms;
+        if (shaderProgram)
+            m_prewarmedPrograms.insert(dna, { binary.sourceHash, shaderProgram });
+    }
+
+    if (m_programsToPrewarm.isEmpty())
+        qCDebug(Shaders) << "Prewarmed" << m_prewarmedPrograms.size() << "shader programs";
+}
+
+// Drops the prewarmed programs no Shader claimed
+void GraphicsContext::releasePrewarmedShaderPrograms()
+{
+    for (const PrewarmedProgram &prewarmed : qAsConst(m_prewarmedPrograms))
+        delete prewarmed.program;
+    m_prewarmedPrograms.clear();
+}
+
 // That assumes that the shaderProgram in Shader stays the same
 void GraphicsContext::introspectShaderInterface(Shader *shader, QOpenGLShaderProgram *shaderProgram)
 {
-    shader->initializeUniforms(m_glHelper->programUniformsAndLocations(shaderProgram->programId()));
+    QVector<ShaderUniform> uniforms = m_glHelper->programUniformsAndLocations(shaderProgram->programId());
+    // Resolved here so that uniform blocks can be serialized without a GL helper
+    for (ShaderUniform &uniform : uniforms) {
+        if (uniform.m_blockIndex != -1)
+            uniform.m_uniformType = m_glHelper->uniformTypeFromGLType(uniform.m_type);
+    }
+    shader->initializeUniforms(uniforms);
     shader->initializeAttributes(m_glHelper->programAttributesAndLocations(shaderProgram->programId()));
     if (m_glHelper->supportsFeature(GraphicsHelperInterface::UniformBufferObject))
         shader->initializeUniformBlocks(m_glHelper->programUniformBlocks(shaderProgram->programId()));
@@ -516,6 +723,10 @@ void GraphicsContext::loadShader(Shader *shader, ShaderManager *manager)
         // No matching QOpenGLShader in the cache so create one
         shaderProgram = createShaderProgram(shader);
 
+        // The program name may be one of a deleted program
+        if (shaderProgram != nullptr)
+            m_glStateShadow.removeProgram(shaderProgram->programId());
+
         // Store in cache
         m_shaderCache.insert(shader->dna(), shader->peerId(), shaderProgram);
     }
@@ -704,6 +915,9 @@ int GraphicsContext::activateTexture(TextureScope scope, GLTexture *tex, int onU
     m_activeTextures[onUnit].pinned = true;
     m_activeTextures[onUnit].scope = scope;
 
+    // remember when the texture was last needed for the texture memory budget
+    tex->setLastUsedFrame(m_currentFrame);
+
     return onUnit;
 }
 
@@ -908,6 +1122,57 @@ void GraphicsContext::drawElementsIndirect(GLenum mode,
     m_glHelper->drawElementsIndirect(mode, type, indirect);
 }
 
+/*!
+ * Issues one indexed draw per range, in a single glMultiDrawElementsIndirect
+ * call when the helper supports it. The ranges are laid out like the
+ * DrawElementsIndirectCommand structure expected by OpenGL.
+ */
+void GraphicsContext::multiDrawElements(GLenum mode,
+                                        GLint indexType,
+                                        const QVector<MultiDrawRange> &ranges)
+{
+    if (m_glHelper->supportsFeature(GraphicsHelperInterface::MultiDrawIndirect)) {
+        if (!m_multiDrawIndirectBuffer.isCreated() && !m_multiDrawIndirectBuffer.create(this)) {
+            qCWarning(Backend) << Q_FUNC_INFO << "indirect draw buffer creation failed";
+            return;
+        }
+        if (!m_multiDrawIndirectBuffer.bind(this, GLBuffer::DrawIndirectBuffer)) {
+            qCWarning(Backend) << Q_FUNC_INFO << "binding indirect draw buffer failed";
+            return;
+        }
+        const uint byteSize = uint(ranges.size()) * sizeof(MultiDrawRange);
+        m_multiDrawIndirectBuffer.allocate(this, byteSize); // orphan the buffer
+        m_multiDrawIndirectBuffer.allocate(this, ranges.constData(), byteSize);
+        m_glHelper->multiDrawElementsIndirect(mode, indexType, nullptr, ranges.size(), 0);
+        return;
+    }
+
+    // Older helpers can't offset the instanced attributes with a base
+    // instance, the instance transforms are re-pointed for each range instead
+    const GLuint indexSize = byteSizeFromType(indexType);
+    QOpenGLShaderProgram *prog = activeShader();
+    if (m_instanceTransformLocation >= 0)
+        bindGLBuffer(&m_instanceTransformBuffer, GLBuffer::ArrayBuffer);
+    for (const MultiDrawRange &range : ranges) {
+        if (m_instanceTransformLocation >= 0) {
+            const int matrixByteSize = int(16 * sizeof(float));
+            for (int column = 0; column < 4; ++column)
+                prog->setAttributeBuffer(m_instanceTransformLocation + column,
+                                         GL_FLOAT,
+                                         int(range.baseInstance) * matrixByteSize + int(column * 4 * sizeof(float)),
+                                         4,
+                                         matrixByteSize);
+        }
+        m_glHelper->drawElementsInstancedBaseVertexBaseInstance(mode,
+                                                                GLsizei(range.count),
+                                                                indexType,
+                                                                reinterpret_cast<void *>(quintptr(range.firstIndex * indexSize)),
+                                                                GLsizei(range.instanceCount),
+                                                                range.baseVertex,
+                                                                0);
+    }
+}
+
 /*!
  * Wraps an OpenGL call to glDrawArrays.
  */
@@ -1189,9 +1454,10 @@ void GraphicsContext::setParameters(ShaderParameterPack &parameterPack)
     }
 
     QOpenGLShaderProgram *shader = activeShader();
+    const GLuint programId = shader->programId();
 
-    // TO DO: We could cache the binding points somehow and only do the binding when necessary
-    // for SSBO and UBO
+    // Block and buffer bindings, as well as uniform values, are only issued
+    // when they differ from the shadowed GL state
 
     // Bind Shader Storage block to SSBO and update SSBO
     const QVector<BlockToSSBO> blockToSSBOs = parameterPack.shaderStorageBuffers();
@@ -1199,11 +1465,14 @@ void GraphicsContext::setParameters(ShaderParameterPack &parameterPack)
     for (const BlockToSSBO b : blockToSSBOs) {
         Buffer *cpuBuffer = m_renderer->nodeManagers()->bufferManager()->lookupResource(b.m_bufferID);
         GLBuffer *ssbo = glBufferForRenderBuffer(cpuBuffer);
-        bindShaderStorageBlock(shader->programId(), b.m_blockIndex, ssboIndex);
-        // Needed to avoid conflict where the buffer would already
-        // be bound as a VertexArray
-        bindGLBuffer(ssbo, GLBuffer::ShaderStorageBuffer);
-        ssbo->bindBufferBase(this, ssboIndex++, GLBuffer::ShaderStorageBuffer);
+        bindShaderStorageBlock(programId, b.m_blockIndex, ssboIndex);
+        if (m_glStateShadow.updateBufferBinding(GLBuffer::ShaderStorageBuffer, ssboIndex, ssbo->bufferId())) {
+            // Needed to avoid conflict where the buffer would already
+            // be bound as a VertexArray
+            bindGLBuffer(ssbo, GLBuffer::ShaderStorageBuffer);
+            ssbo->bindBufferBase(this, ssboIndex, GLBuffer::ShaderStorageBuffer);
+        }
+        ++ssboIndex;
         // Perform update if required
         if (cpuBuffer->isDirty()) {
             uploadDataToGLBuffer(cpuBuffer, ssbo);
@@ -1212,19 +1481,33 @@ void GraphicsContext::setParameters(ShaderParameterPack &parameterPack)
         // TO DO: Make sure that there's enough binding points
     }
 
-    // Bind UniformBlocks to UBO and update UBO from Buffer
-    // TO DO: Convert ShaderData to Buffer so that we can use that generic process
+    // Bind UniformBlocks to UBO and update UBO from Buffer or from the
+    // content serialized by the RenderView (ShaderData and per view block)
     const QVector<BlockToUBO> blockToUBOs = parameterPack.uniformBuffers();
     int uboIndex = 0;
     for (const BlockToUBO &b : blockToUBOs) {
-        Buffer *cpuBuffer = m_renderer->nodeManagers()->bufferManager()->lookupResource(b.m_bufferID);
-        GLBuffer *ubo = glBufferForRenderBuffer(cpuBuffer);
-        bindUniformBlock(shader->programId(), b.m_blockIndex, uboIndex);
-        // Needed to avoid conflict where the buffer would already
-        // be bound as a VertexArray
-        bindGLBuffer(ubo, GLBuffer::UniformBuffer);
-        ubo->bindBufferBase(this, uboIndex++, GLBuffer::UniformBuffer);
-        if (cpuBuffer->isDirty()) {
+        Buffer *cpuBuffer = nullptr;
+        GLBuffer *ubo = nullptr;
+        if (!b.m_data.isEmpty()) {
+            ubo = glBufferForUniformBlockData(b);
+            if (ubo == nullptr)
+                continue;
+        } else {
+            cpuBuffer = m_renderer->nodeManagers()->bufferManager()->lookupResource(b.m_bufferID);
+            if (cpuBuffer == nullptr)
+                continue;
+            ubo = glBufferForRenderBuffer(cpuBuffer);
+        }
+        if (m_glStateShadow.updateUniformBlockBinding(programId, b.m_blockIndex, uboIndex))
+            bindUniformBlock(programId, b.m_blockIndex, uboIndex);
+        if (m_glStateShadow.updateBufferBinding(GLBuffer::UniformBuffer, uboIndex, ubo->bufferId())) {
+            // Needed to avoid conflict where the buffer would already
+            // be bound as a VertexArray
+            bindGLBuffer(ubo, GLBuffer::UniformBuffer);
+            ubo->bindBufferBase(this, uboIndex, GLBuffer::UniformBuffer);
+        }
+        ++uboIndex;
+        if (cpuBuffer != nullptr && cpuBuffer->isDirty()) {
             // Perform update if required
             uploadDataToGLBuffer(cpuBuffer, ubo);
             cpuBuffer->unsetDirty();
@@ -1239,7 +1522,9 @@ void GraphicsContext::setParameters(ShaderParameterPack &parameterPack)
     for (const ShaderUniform &uniform : activeUniforms) {
         // We can use [] as we are sure the the uniform wouldn't
         // be un activeUniforms if there wasn't a matching value
-        applyUniform(uniform, values[uniform.m_nameId]);
+        const UniformValue &value = values[uniform.m_nameId];
+        if (m_glStateShadow.updateUniform(programId, uniform.m_location, value))
+            applyUniform(uniform, value);
     }
 }
 
@@ -1426,6 +1711,104 @@ void GraphicsContext::specifyAttribute(const Attribute *attribute, Buffer *buffe
     }
 }
 
+// Note: needs to be called while VAO is bound
+void GraphicsContext::specifyInstanceTransforms(const QVector<QMatrix4x4> &transforms, int location, int divisor)
+{
+    if (location < 0) {
+        qCWarning(Backend) << "failed to resolve location for the instance transforms";
+        return;
+    }
+
+    // QMatrix4x4 stores flags next to its values, pack the column major values
+    const int matrixSize = 16;
+    m_instanceTransformData.resize(transforms.size() * matrixSize);
+    float *data = m_instanceTransformData.data();
+    for (const QMatrix4x4 &transform : transforms) {
+        std::copy(transform.constData(), transform.constData() + matrixSize, data);
+        data += matrixSize;
+    }
+
+    if (!m_instanceTransformBuffer.isCreated() && !m_instanceTransformBuffer.create(this)) {
+        qCWarning(Backend) << Q_FUNC_INFO << "instance transform buffer creation failed";
+        return;
+    }
+    if (!bindGLBuffer(&m_instanceTransformBuffer, GLBuffer::ArrayBuffer))
+        qCWarning(Backend) << Q_FUNC_INFO << "binding instance transform buffer failed";
+
+    const uint byteSize = uint(m_instanceTransformData.size()) * sizeof(float);
+    m_instanceTransformBuffer.allocate(this, byteSize); // orphan the buffer
+    m_instanceTransformBuffer.allocate(this, m_instanceTransformData.constData(), byteSize);
+
+    // A mat4 attribute spans 4 consecutive vec4 locations. These are not saved
+    // in the emulated VAO as they only stay valid for the current draw call
+    QOpenGLShaderProgram *prog = activeShader();
+    for (int column = 0; column < 4; ++column) {
+        prog->enableAttributeArray(location + column);
+        prog->setAttributeBuffer(location + column,
+                                 GL_FLOAT,
+                                 int(column * 4 * sizeof(float)),
+                                 4,
+                                 int(matrixSize * sizeof(float)));
+        m_glHelper->vertexAttribDivisor(location + column, divisor);
+    }
+    m_instanceTransformLocation = location;
+}
+
+void GraphicsContext::releaseInstanceTransforms(int location)
+{
+    if (location < 0)
+        return;
+
+    QOpenGLShaderProgram *prog = activeShader();
+    for (int column = 0; column < 4; ++column) {
+        m_glHelper->vertexAttribDivisor(location + column, 0);
+        prog->disableAttributeArray(location + column);
+    }
+    m_instanceTransformLocation = -1;
+}
+
+// Releases the buffers the context creates on its own for instancing and
+// multi draw submissions
+void GraphicsContext::destroyGeneratedBuffers()
+{
+    if (m_instanceTransformBuffer.isCreated()) {
+        if (m_boundArrayBuffer == &m_instanceTransformBuffer)
+            m_boundArrayBuffer = nullptr;
+        m_instanceTransformBuffer.destroy(this);
+    }
+    m_instanceTransformData.clear();
+
+    if (m_multiDrawIndirectBuffer.isCreated())
+        m_multiDrawIndirectBuffer.destroy(this);
+
+    for (auto it = m_generatedUniformBuffers.begin(), end = m_generatedUniformBuffers.end(); it != end; ++it) {
+        if (it->buffer.isCreated()) {
+            m_glStateShadow.removeBuffer(it->buffer.bufferId());
+            it->buffer.destroy(this);
+        }
+    }
+    m_generatedUniformBuffers.clear();
+}
+
+// The ShaderData or shader of a generated uniform buffer may have been
+// destroyed or its DNA may have changed, such buffers are never looked up
+// again and are released once unused for more than maxUnusedFrames frames
+void GraphicsContext::releaseUnusedUniformBlockBuffers(qint64 maxUnusedFrames)
+{
+    auto it = m_generatedUniformBuffers.begin();
+    while (it != m_generatedUniformBuffers.end()) {
+        if (m_currentFrame - it->lastUsedFrame > maxUnusedFrames) {
+            if (it->buffer.isCreated()) {
+                m_glStateShadow.removeBuffer(it->buffer.bufferId());
+                it->buffer.destroy(this);
+            }
+            it = m_generatedUniformBuffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 void GraphicsContext::specifyIndices(Buffer *buffer)
 {
     Q_ASSERT(buffer->type() == QBuffer::IndexBuffer);
@@ -1466,6 +1849,7 @@ void GraphicsContext::releaseBuffer(Qt3DCore::QNodeId bufferId)
 
         Q_ASSERT(glBuff);
         // Destroy the GPU resource
+        m_glStateShadow.removeBuffer(glBuff->bufferId());
         glBuff->destroy(this);
         // Destroy the GLBuffer instance
         m_renderer->nodeManagers()->glBufferManager()->releaseResource(bufferId);
@@ -1492,6 +1876,33 @@ GLBuffer *GraphicsContext::glBufferForRenderBuffer(Buffer *buf)
     return m_renderer->nodeManagers()->glBufferManager()->data(m_renderBufferHash.value(buf->peerId()));
 }
 
+// Called only from RenderThread with the program of the block bound
+GLBuffer *GraphicsContext::glBufferForUniformBlockData(const BlockToUBO &block)
+{
+    const UniformBlockDataKey key = { block.m_bufferID, m_activeShaderDNA, block.m_blockIndex };
+    GeneratedUniformBuffer &ubo = m_generatedUniformBuffers[key];
+    ubo.lastUsedFrame = m_currentFrame;
+    if (!ubo.buffer.isCreated() && !ubo.buffer.create(this)) {
+        qCWarning(Backend) << Q_FUNC_INFO << "uniform buffer creation failed";
+        return nullptr;
+    }
+
+    // RenderViews serialize the blocks every frame, the GL buffer is only
+    // updated when the content actually changed
+    if (ubo.data != block.m_data) {
+        bindGLBuffer(&ubo.buffer, GLBuffer::UniformBuffer);
+        if (ubo.data.size() == block.m_data.size()) {
+            ubo.buffer.update(this, block.m_data.constData(), block.m_data.size());
+        } else {
+            ubo.buffer.allocate(this, block.m_data.constData(), block.m_data.size());
+            // Binding points refer to the previous storage
+            m_glStateShadow.removeBuffer(ubo.buffer.bufferId());
+        }
+        ubo.data = block.m_data;
+    }
+    return &ubo.buffer;
+}
+
 HGLBuffer GraphicsContext::createGLBufferFor(Buffer *buffer)
 {
     GLBuffer *b = m_renderer->nodeManagers()->glBufferManager()->getOrCreateResource(buffer->peerId());
@@ -1558,6 +1969,8 @@ void GraphicsContext::uploadDataToGLBuffer(Buffer *buffer, GLBuffer *b, bool rel
             const int bufferSize = buffer->data().size();
             b->allocate(this, bufferSize, false); // orphan the buffer
             b->allocate(this, buffer->data().constData(), bufferSize, false);
+            // Binding points refer to the previous storage
+            m_glStateShadow.removeBuffer(b->bufferId());
         }
     }
 
@@ -1647,6 +2060,7 @@ GLuint GraphicsContext::byteSizeFromType(GLint type)
     case GL_DOUBLE:         return sizeof(double);
 #endif
     case GL_UNSIGNED_BYTE:  return sizeof(unsigned char);
+    case GL_UNSIGNED_SHORT: return sizeof(GLushort);
     case GL_UNSIGNED_INT:   return sizeof(GLuint);
 
     case GL_FLOAT_VEC2:     return sizeof(float) * 2;
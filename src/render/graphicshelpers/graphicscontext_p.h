@@ -69,8 +69,10 @@
 #include <Qt3DRender/private/handle_types_p.h>
 #include <Qt3DRender/private/qgraphicsapifilter_p.h>
 #include <Qt3DRender/private/shadercache_p.h>
+#include <Qt3DRender/private/shaderbinarycache_p.h>
 #include <Qt3DRender/private/uniform_p.h>
 #include <Qt3DRender/private/graphicshelperinterface_p.h>
+#include <Qt3DRender/private/glstateshadow_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -88,6 +90,7 @@ class RenderStateSet;
 class Material;
 class GLTexture;
 class RenderCommand;
+struct MultiDrawRange;
 class RenderTarget;
 class AttachmentPack;
 class Attribute;
@@ -129,6 +132,9 @@ public:
     void doneCurrent();
     void activateGLHelper();
     bool hasValidGLHelper() const;
+    // Provides the helper of a surface instead of resolving it from the
+    // OpenGL version, used by tests to record the issued calls. Takes ownership
+    void setGraphicsHelper(QSurface *surface, GraphicsHelperInterface *helper);
     bool isInitialized() const;
 
     QOpenGLShaderProgram *createShaderProgram(Shader *shaderNode);
@@ -137,6 +143,14 @@ public:
     void removeShaderProgramReference(Shader *shaderNode);
     void introspectShaderInterface(Shader *shader, QOpenGLShaderProgram *shaderProgram);
 
+    /**
+     * @brief prewarmShaderPrograms - creates up to maxPrograms of the programs
+     * the previous session used from their binaries cached on disk, ahead of
+     * the shaders using them. Requires the context to be current.
+     */
+    void prewarmShaderPrograms(int maxPrograms);
+    bool supportsProgramBinaries() const { return m_supportsProgramBinaries; }
+
     GLuint activeFBO() const { return m_activeFBO; }
     GLuint defaultFBO() const { return m_defaultFBO; }
     void activateRenderTarget(const Qt3DCore::QNodeId id, const AttachmentPack &attachments, GLuint defaultFboId);
@@ -158,6 +172,10 @@ public:
     void setRenderer(Renderer *renderer);
 
     void specifyAttribute(const Attribute *attribute, Buffer *buffer, int attributeLocation);
+    void specifyInstanceTransforms(const QVector<QMatrix4x4> &transforms, int attributeLocation, int divisor);
+    void releaseInstanceTransforms(int attributeLocation);
+    void destroyGeneratedBuffers();
+    void releaseUnusedUniformBlockBuffers(qint64 maxUnusedFrames);
     void specifyIndices(Buffer *buffer);
     void updateBuffer(Buffer *buffer);
     QByteArray downloadBufferContent(Buffer *buffer);
@@ -166,6 +184,8 @@ public:
 
     void memoryBarrier(QMemoryBarrier::Operations barriers);
 
+    GLStateShadow *glStateShadow() { return &m_glStateShadow; }
+
     void setParameters(ShaderParameterPack &parameterPack);
 
     /**
@@ -175,6 +195,7 @@ public:
      * @return
      */
     GLBuffer *glBufferForRenderBuffer(Buffer *buf);
+    GLBuffer *glBufferForUniformBlockData(const BlockToUBO &block);
 
     /**
      * @brief activateTexture - make a texture active on a hardware unit
@@ -186,6 +207,10 @@ public:
 
     void deactivateTexture(GLTexture *tex);
 
+    // Frame number recorded on the textures activated for rendering
+    void setCurrentFrame(qint64 frame) { m_currentFrame = frame; }
+    qint64 currentFrame() const { return m_currentFrame; }
+
     void setCurrentStateSet(RenderStateSet* ss);
     RenderStateSet *currentStateSet() const;
     const GraphicsApiFilterData *contextInfo() const;
@@ -220,6 +245,7 @@ public:
     void    drawArraysInstancedBaseInstance(GLenum primitiveType, GLint first, GLsizei count, GLsizei instances, GLsizei baseinstance);
     void    drawElements(GLenum primitiveType, GLsizei primitiveCount, GLint indexType, void * indices, GLint baseVertex);
     void    drawElementsIndirect(GLenum mode, GLenum type, void *indirect);
+    void    multiDrawElements(GLenum mode, GLint indexType, const QVector<MultiDrawRange> &ranges);
     void    drawElementsInstancedBaseVertexBaseInstance(GLenum primitiveType, GLsizei primitiveCount, GLint indexType, void * indices, GLsizei instances, GLint baseVertex, GLint baseInstance);
     void    enableClipPlane(int clipPlane);
     void    enablei(GLenum cap, GLuint index);
@@ -262,6 +288,11 @@ private:
     bool bindGLBuffer(GLBuffer *buffer, GLBuffer::Type type);
     void resolveRenderTargetFormat();
 
+    QOpenGLShaderProgram *takeCachedShaderProgram(ProgramDNA dna, const QByteArray &sourceHash);
+    QOpenGLShaderProgram *createShaderProgramFromBinary(ProgramDNA dna, const ShaderBinaryCache::Binary &binary);
+    void storeShaderProgramBinary(ProgramDNA dna, const QByteArray &sourceHash, QOpenGLShaderProgram *shaderProgram);
+    void releasePrewarmedShaderPrograms();
+
     bool m_initialized;
     const unsigned int m_id;
     QOpenGLContext *m_gl;
@@ -270,6 +301,17 @@ private:
     bool m_ownCurrent;
 
     ShaderCache m_shaderCache;
+    ShaderBinaryCache m_shaderBinaryCache;
+    bool m_supportsProgramBinaries;
+
+    // programs created from the disk cache not yet claimed by a Shader
+    struct PrewarmedProgram {
+        QByteArray sourceHash;
+        QOpenGLShaderProgram *program;
+    };
+    QHash<ProgramDNA, PrewarmedProgram> m_prewarmedPrograms;
+    // cached programs still to be prewarmed, a few at a time
+    QVector<ProgramDNA> m_programsToPrewarm;
     QOpenGLShaderProgram *m_activeShader;
     ProgramDNA m_activeShaderDNA;
 
@@ -288,6 +330,7 @@ private:
         bool pinned = false;
     };
     QVector<ActiveTexture> m_activeTextures;
+    qint64 m_currentFrame;
 
     // cache some current state, to make sure we don't issue unnecessary GL calls
     int m_currClearStencilValue;
@@ -300,6 +343,21 @@ private:
     GLuint m_defaultFBO;
 
     GLBuffer *m_boundArrayBuffer;
+    GLBuffer m_instanceTransformBuffer;
+    QVector<float> m_instanceTransformData;
+    int m_instanceTransformLocation;
+    GLBuffer m_multiDrawIndirectBuffer;
+
+    // UBOs holding the blocks serialized by the RenderViews, keyed by
+    // data source, program and block index
+    struct GeneratedUniformBuffer
+    {
+        GLBuffer buffer;
+        QByteArray data;
+        qint64 lastUsedFrame = 0;
+    };
+    QHash<UniformBlockDataKey, GeneratedUniformBuffer> m_generatedUniformBuffers;
+    GLStateShadow m_glStateShadow;
 
     RenderStateSet* m_stateSet;
 
@@ -174,6 +174,11 @@ void GraphicsHelperES2::drawElementsIndirect(GLenum, GLenum, void *)
     qWarning() << "Indirect Drawing is not supported with OpenGL ES 2";
 }
 
+void GraphicsHelperES2::multiDrawElementsIndirect(GLenum, GLenum, void *, GLsizei, GLsizei)
+{
+    qWarning() << "Indirect Drawing is not supported with OpenGL ES 2";
+}
+
 void GraphicsHelperES2::drawArraysIndirect(GLenum , void *)
 {
     qWarning() << "Indirect Drawing is not supported with OpenGL ES 2";
@@ -144,6 +144,11 @@ void GraphicsHelperGL2::drawElementsIndirect(GLenum, GLenum, void *)
     qWarning() << "Indirect Drawing is not supported with OpenGL 2";
 }
 
+void GraphicsHelperGL2::multiDrawElementsIndirect(GLenum, GLenum, void *, GLsizei, GLsizei)
+{
+    qWarning() << "Indirect Drawing is not supported with OpenGL 2";
+}
+
 void GraphicsHelperGL2::drawArraysIndirect(GLenum , void *)
 {
     qWarning() << "Indirect Drawing is not supported with OpenGL 2";
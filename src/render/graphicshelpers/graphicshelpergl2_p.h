@@ -111,6 +111,7 @@ public:
     void pointSize(bool programmable, GLfloat value) Q_DECL_OVERRIDE;
     GLint maxClipPlaneCount() Q_DECL_OVERRIDE;
     void memoryBarrier(QMemoryBarrier::Operations barriers) Q_DECL_OVERRIDE;
+    void multiDrawElementsIndirect(GLenum mode, GLenum type, void *indirect, GLsizei drawCount, GLsizei stride) Q_DECL_OVERRIDE;
     QVector<ShaderUniformBlock> programUniformBlocks(GLuint programId) Q_DECL_OVERRIDE;
     QVector<ShaderAttribute> programAttributesAndLocations(GLuint programId) Q_DECL_OVERRIDE;
     QVector<ShaderUniform> programUniformsAndLocations(GLuint programId) Q_DECL_OVERRIDE;
@@ -164,6 +164,11 @@ void GraphicsHelperGL3_2::drawElementsIndirect(GLenum, GLenum, void *)
     qWarning() << "Indirect Drawing is not supported with OpenGL 3.2";
 }
 
+void GraphicsHelperGL3_2::multiDrawElementsIndirect(GLenum, GLenum, void *, GLsizei, GLsizei)
+{
+    qWarning() << "Indirect Drawing is not supported with OpenGL 3.2";
+}
+
 void GraphicsHelperGL3_2::drawArraysIndirect(GLenum , void *)
 {
     qWarning() << "Indirect Drawing is not supported with OpenGL 3.2";
@@ -154,6 +154,11 @@ void GraphicsHelperGL3_3::drawElementsIndirect(GLenum, GLenum, void *)
     qWarning() << "Indirect Drawing is not supported with OpenGL 3";
 }
 
+void GraphicsHelperGL3_3::multiDrawElementsIndirect(GLenum, GLenum, void *, GLsizei, GLsizei)
+{
+    qWarning() << "Indirect Drawing is not supported with OpenGL 3";
+}
+
 void GraphicsHelperGL3_3::drawArrays(GLenum primitiveType,
                                       GLint first,
                                       GLsizei count)
@@ -207,6 +207,15 @@ void GraphicsHelperGL4::drawElementsIndirect(GLenum mode,
     m_funcs->glDrawElementsIndirect(mode, type, indirect);
 }
 
+void GraphicsHelperGL4::multiDrawElementsIndirect(GLenum mode,
+                                                  GLenum type,
+                                                  void *indirect,
+                                                  GLsizei drawCount,
+                                                  GLsizei stride)
+{
+    m_funcs->glMultiDrawElementsIndirect(mode, type, indirect, drawCount, stride);
+}
+
 void GraphicsHelperGL4::drawArrays(GLenum primitiveType,
                                    GLint first,
                                    GLsizei count)
@@ -671,6 +680,7 @@ bool GraphicsHelperGL4::supportsFeature(GraphicsHelperInterface::Feature feature
     case DrawBuffersBlend:
     case BlitFramebuffer:
     case IndirectDrawing:
+    case MultiDrawIndirect:
         return true;
     default:
         return false;
@@ -81,7 +81,8 @@ public:
         DrawBuffersBlend,
         BlitFramebuffer,
         IndirectDrawing,
-        MapBuffer
+        MapBuffer,
+        MultiDrawIndirect
     };
 
     enum FBOBindMode {
@@ -132,6 +133,7 @@ public:
     virtual void    initializeHelper(QOpenGLContext *context, QAbstractOpenGLFunctions *functions) = 0;
     virtual GLint   maxClipPlaneCount() = 0;
     virtual void    memoryBarrier(QMemoryBarrier::Operations barriers) = 0;
+    virtual void    multiDrawElementsIndirect(GLenum mode, GLenum type, void *indirect, GLsizei drawCount, GLsizei stride) = 0;
     virtual void    pointSize(bool programmable, GLfloat value) = 0;
     virtual QVector<ShaderAttribute> programAttributesAndLocations(GLuint programId) = 0;
     virtual QVector<ShaderUniform> programUniformsAndLocations(GLuint programId) = 0;
@@ -4,6 +4,7 @@ INCLUDEPATH += $$PWD
 
 HEADERS += \
     $$PWD/graphicscontext_p.h \
+    $$PWD/glstateshadow_p.h \
     $$PWD/graphicshelperinterface_p.h \
     $$PWD/graphicshelperes2_p.h \
     $$PWD/graphicshelperes3_p.h \
@@ -14,6 +15,7 @@ HEADERS += \
 
 SOURCES += \
     $$PWD/graphicscontext.cpp \
+    $$PWD/glstateshadow.cpp \
     $$PWD/graphicshelperes2.cpp \
     $$PWD/graphicshelperes3.cpp \
     $$PWD/graphicshelpergl2.cpp \
@@ -87,6 +87,9 @@ void FilterCompatibleTechniqueJob::run()
             if (Q_LIKELY(technique != nullptr))
                 technique->setCompatibleWithRenderer((*m_renderer->contextInfo() == *technique->graphicsApiFilter()));
         }
+        // The technique selected for a material may have changed
+        if (!dirtyTechniqueIds.isEmpty())
+            m_renderer->materialParameterGathererCache()->clear();
     }
 }
 
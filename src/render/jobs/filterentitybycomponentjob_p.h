@@ -65,6 +65,9 @@ namespace Render {
 
 class Entity;
 class EntityManager;
+class ComputeCommand;
+class GeometryRenderer;
+class Material;
 
 template<typename T, typename ... Ts>
 class FilterEntityByComponentJob : public Qt3DCore::QAspectJob
@@ -83,13 +86,11 @@ public:
     void run() Q_DECL_FINAL
     {
         m_filteredEntities.clear();
-        const QVector<HEntity> handles = m_manager->activeHandles();
+        // Direct lookup in the archetype table instead of testing every entity
+        const QVector<HEntity> handles = m_manager->entitiesWithComponentTypes(Entity::componentTypesOf<T, Ts...>());
         m_filteredEntities.reserve(handles.size());
-        for (const HEntity handle : handles) {
-            Entity *e = m_manager->data(handle);
-            if (e->containsComponentsOfType<T, Ts...>())
-                m_filteredEntities.push_back(e);
-        }
+        for (const HEntity handle : handles)
+            m_filteredEntities.push_back(m_manager->data(handle));
     }
 
 private:
@@ -100,6 +101,9 @@ private:
 template<typename T, typename ... Ts>
 using FilterEntityByComponentJobPtr = QSharedPointer<FilterEntityByComponentJob<T, Ts...>>;
 
+using ComputableEntityFilterPtr = FilterEntityByComponentJobPtr<Render::ComputeCommand, Render::Material>;
+using RenderableEntityFilterPtr = FilterEntityByComponentJobPtr<Render::GeometryRenderer, Render::Material>;
+
 
 } // Render
 
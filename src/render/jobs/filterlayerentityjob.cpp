@@ -42,6 +42,7 @@
 #include <Qt3DRender/private/nodemanagers_p.h>
 #include <Qt3DRender/private/entity_p.h>
 #include <Qt3DRender/private/job_common_p.h>
+#include <QBitArray>
 
 QT_BEGIN_NAMESPACE
 
@@ -85,26 +86,28 @@ void FilterLayerEntityJob::run()
 // -> meaning that if an Entity references such a layer, it's enabled
 void FilterLayerEntityJob::filterLayerAndEntity()
 {
+    // An Entity is positively filtered if it contains at least one Layer component with the same id as the
+    // layers selected by the LayerFilter. Each Layer tracks the handle indices of the Entities referencing it.
+    LayerManager *layerManager = m_manager->layerManager();
+    QBitArray selectedEntities;
+    for (const Qt3DCore::QNodeId layerId : qAsConst(m_layerIds))
+        selectedEntities |= layerManager->lookupResource(layerId)->entities();
+
+    if (selectedEntities.count(true) == 0)
+        return;
+
     EntityManager *entityManager = m_manager->renderNodesManager();
     const QVector<HEntity> handles = entityManager->activeHandles();
+    const int selectedEntitiesCount = selectedEntities.size();
 
     for (const HEntity handle : handles) {
-        Entity *entity = entityManager->data(handle);
-
-        if (!entity->isTreeEnabled())
+        const int index = int(handle.index());
+        if (index >= selectedEntitiesCount || !selectedEntities.testBit(index))
             continue;
 
-        const Qt3DCore::QNodeIdVector entityLayers = entity->componentsUuid<Layer>();
-
-        // An Entity is positively filtered if it contains at least one Layer component with the same id as the
-        // layers selected by the LayerFilter
-
-        for (const Qt3DCore::QNodeId id : entityLayers) {
-            if (m_layerIds.contains(id)) {
-                m_filteredEntities.push_back(entity);
-                break;
-            }
-        }
+        Entity *entity = entityManager->data(handle);
+        if (entity->isTreeEnabled())
+            m_filteredEntities.push_back(entity);
     }
 }
 
@@ -44,56 +44,77 @@
 #include <Qt3DRender/private/renderview_p.h>
 #include <Qt3DRender/private/sphere_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 namespace Qt3DRender {
 
 namespace Render {
 
-FrustumCullingJob::FrustumCullingJob()
-    : Qt3DCore::QAspectJob()
-    , m_root(nullptr)
-    , m_active(false)
+namespace {
+
+// Minimum number of subtrees per chunk the top level traversal tries to
+// reach before handing the remaining subtrees to the chunk jobs
+const int SubtreesPerChunk = 4;
+
+struct FrustumPlanes
 {
-    SET_JOB_RUN_STAT_TYPE(this, JobTypes::FrustumCulling, 0);
+    explicit FrustumPlanes(const QMatrix4x4 &viewProjection)
+        : planes{
+              Plane(viewProjection.row(3) + viewProjection.row(0)), // Left
+              Plane(viewProjection.row(3) - viewProjection.row(0)), // Right
+              Plane(viewProjection.row(3) + viewProjection.row(1)), // Top
+              Plane(viewProjection.row(3) - viewProjection.row(1)), // Bottom
+              Plane(viewProjection.row(3) + viewProjection.row(2)), // Front
+              Plane(viewProjection.row(3) - viewProjection.row(2)), // Back
+              }
+    {}
+
+    const Plane planes[6];
+};
+
+inline bool isInFrustum(const Sphere *s, const Plane *planes) Q_DECL_NOTHROW
+{
+    // Unrolled loop
+    if (QVector3D::dotProduct(s->center(), planes[0].normal) + planes[0].d < -s->radius())
+        return false;
+    if (QVector3D::dotProduct(s->center(), planes[1].normal) + planes[1].d < -s->radius())
+        return false;
+    if (QVector3D::dotProduct(s->center(), planes[2].normal) + planes[2].d < -s->radius())
+        return false;
+    if (QVector3D::dotProduct(s->center(), planes[3].normal) + planes[3].d < -s->radius())
+        return false;
+    if (QVector3D::dotProduct(s->center(), planes[4].normal) + planes[4].d < -s->radius())
+        return false;
+    if (QVector3D::dotProduct(s->center(), planes[5].normal) + planes[5].d < -s->radius())
+        return false;
+    return true;
 }
 
-void FrustumCullingJob::run()
+} // anonymous
+
+FrustumCullingChunkJob::FrustumCullingChunkJob(int index)
+    : Qt3DCore::QAspectJob()
 {
-    // Early return if not activated
-    if (!m_active)
-        return;
+    SET_JOB_RUN_STAT_TYPE(this, JobTypes::FrustumCullingChunk, index);
+}
 
+void FrustumCullingChunkJob::run()
+{
     m_visibleEntities.clear();
+    if (m_roots.isEmpty())
+        return;
 
-    const Plane planes[6] = {
-        Plane(m_viewProjection.row(3) + m_viewProjection.row(0)), // Left
-        Plane(m_viewProjection.row(3) - m_viewProjection.row(0)), // Right
-        Plane(m_viewProjection.row(3) + m_viewProjection.row(1)), // Top
-        Plane(m_viewProjection.row(3) - m_viewProjection.row(1)), // Bottom
-        Plane(m_viewProjection.row(3) + m_viewProjection.row(2)), // Front
-        Plane(m_viewProjection.row(3) - m_viewProjection.row(2)), // Back
-    };
+    const FrustumPlanes frustum(m_viewProjection);
 
-    cullScene(m_root, planes);
+    for (Entity *root : qAsConst(m_roots))
+        cullScene(root, frustum.planes);
 }
 
-void FrustumCullingJob::cullScene(Entity *e, const Plane *planes)
+void FrustumCullingChunkJob::cullScene(Entity *e, const Plane *planes)
 {
-    const Sphere *s = e->worldBoundingVolumeWithChildren();
-
-    // Unrolled loop
-    if (QVector3D::dotProduct(s->center(), planes[0].normal) + planes[0].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[1].normal) + planes[1].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[2].normal) + planes[2].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[3].normal) + planes[3].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[4].normal) + planes[4].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[5].normal) + planes[5].d < -s->radius())
+    if (!isInFrustum(e->worldBoundingVolumeWithChildren(), planes))
         return;
 
     m_visibleEntities.push_back(e);
@@ -103,6 +124,82 @@ void FrustumCullingJob::cullScene(Entity *e, const Plane *planes)
         cullScene(c, planes);
 }
 
+FrustumCullingJob::FrustumCullingJob(int chunkCount)
+    : Qt3DCore::QAspectJob()
+    , m_root(nullptr)
+    , m_active(false)
+{
+    SET_JOB_RUN_STAT_TYPE(this, JobTypes::FrustumCulling, 0);
+
+    chunkCount = std::max(chunkCount, 1);
+    m_chunkJobs.reserve(chunkCount);
+    for (int i = 0; i < chunkCount; ++i) {
+        auto chunkJob = FrustumCullingChunkJobPtr::create(i);
+        m_chunkJobs.push_back(chunkJob);
+    }
+}
+
+// Returns the entities that passed the top level traversal followed by those
+// found by each chunk, in chunk order. Only valid once the chunk jobs have run.
+QVector<Entity *> FrustumCullingJob::visibleEntities() const
+{
+    int count = m_visibleEntities.size();
+    for (const FrustumCullingChunkJobPtr &chunkJob : m_chunkJobs)
+        count += chunkJob->visibleEntities().size();
+
+    QVector<Entity *> visibleEntities;
+    visibleEntities.reserve(count);
+    visibleEntities += m_visibleEntities;
+    for (const FrustumCullingChunkJobPtr &chunkJob : m_chunkJobs)
+        visibleEntities += chunkJob->visibleEntities();
+    return visibleEntities;
+}
+
+void FrustumCullingJob::run()
+{
+    m_visibleEntities.clear();
+
+    // Reset the chunks so that they don't cull subtrees from a previous frame
+    for (const FrustumCullingChunkJobPtr &chunkJob : qAsConst(m_chunkJobs))
+        chunkJob->setRoots(QVector<Entity *>());
+
+    // Early return if not activated
+    if (!m_active || m_root == nullptr)
+        return;
+
+    const FrustumPlanes frustum(m_viewProjection);
+
+    // Test the scene breadth first until there are enough subtrees to keep
+    // all the chunk jobs busy. Visible entities along the way are kept here.
+    const int minSubtreeCount = m_chunkJobs.size() * SubtreesPerChunk;
+    QVector<Entity *> subtrees;
+    subtrees.push_back(m_root);
+    while (!subtrees.isEmpty() && subtrees.size() < minSubtreeCount) {
+        QVector<Entity *> nextSubtrees;
+        for (Entity *e : qAsConst(subtrees)) {
+            if (!isInFrustum(e->worldBoundingVolumeWithChildren(), frustum.planes))
+                continue;
+            m_visibleEntities.push_back(e);
+            nextSubtrees += e->children();
+        }
+        subtrees = std::move(nextSubtrees);
+    }
+
+    // Split the remaining subtrees in contiguous ranges so that the
+    // concatenated result is stable from one frame to the next
+    const int chunkCount = m_chunkJobs.size();
+    const int subtreesPerJob = subtrees.size() / chunkCount;
+    const int lastRemainingSubtrees = subtrees.size() % chunkCount;
+    for (int i = 0; i < chunkCount; ++i) {
+        const FrustumCullingChunkJobPtr &chunkJob = m_chunkJobs.at(i);
+        chunkJob->setViewProjection(m_viewProjection);
+        if (i == chunkCount - 1)
+            chunkJob->setRoots(subtrees.mid(i * subtreesPerJob, subtreesPerJob + lastRemainingSubtrees));
+        else
+            chunkJob->setRoots(subtrees.mid(i * subtreesPerJob, subtreesPerJob));
+    }
+}
+
 } // Render
 
 } // Qt3DRender
@@ -64,10 +64,33 @@ class Entity;
 class EntityManager;
 struct Plane;
 
+class FrustumCullingChunkJob : public Qt3DCore::QAspectJob
+{
+public:
+    explicit FrustumCullingChunkJob(int index = 0);
+
+    inline void setRoots(const QVector<Entity *> &roots) Q_DECL_NOTHROW { m_roots = roots; }
+    inline QVector<Entity *> roots() const Q_DECL_NOTHROW { return m_roots; }
+    inline void setViewProjection(const QMatrix4x4 &viewProjection) Q_DECL_NOTHROW { m_viewProjection = viewProjection; }
+    inline QMatrix4x4 viewProjection() const Q_DECL_NOTHROW { return m_viewProjection; }
+
+    QVector<Entity *> visibleEntities() const Q_DECL_NOTHROW { return m_visibleEntities; }
+
+    void run() Q_DECL_FINAL;
+
+private:
+    void cullScene(Entity *e, const Plane *planes);
+    QMatrix4x4 m_viewProjection;
+    QVector<Entity *> m_roots;
+    QVector<Entity *> m_visibleEntities;
+};
+
+typedef QSharedPointer<FrustumCullingChunkJob> FrustumCullingChunkJobPtr;
+
 class FrustumCullingJob : public Qt3DCore::QAspectJob
 {
 public:
-    FrustumCullingJob();
+    explicit FrustumCullingJob(int chunkCount = 1);
 
     inline void setRoot(Entity *root) Q_DECL_NOTHROW { m_root = root; }
     inline void setActive(bool active) Q_DECL_NOTHROW { m_active = active; }
@@ -75,15 +98,17 @@ public:
     inline void setViewProjection(const QMatrix4x4 &viewProjection) Q_DECL_NOTHROW { m_viewProjection = viewProjection; }
     inline QMatrix4x4 viewProjection() const Q_DECL_NOTHROW { return m_viewProjection; }
 
-    QVector<Entity *> visibleEntities() const Q_DECL_NOTHROW { return m_visibleEntities; }
+    inline QVector<FrustumCullingChunkJobPtr> chunkJobs() const Q_DECL_NOTHROW { return m_chunkJobs; }
+
+    QVector<Entity *> visibleEntities() const;
 
     void run() Q_DECL_FINAL;
 
 private:
-    void cullScene(Entity *e, const Plane *planes);
     QMatrix4x4 m_viewProjection;
     Entity *m_root;
     QVector<Entity *> m_visibleEntities;
+    QVector<FrustumCullingChunkJobPtr> m_chunkJobs;
     bool m_active;
 };
 
@@ -99,7 +99,10 @@ namespace JobTypes {
         UpdateMeshTriangleList,
         FilterCompatibleTechniques,
         UpdateLevelOfDetail,
-        SyncTextureLoading
+        SyncTextureLoading,
+        FrustumCullingChunk,
+        OcclusionCulling,
+        OcclusionRasterization
     };
 
 } // JobTypes
@@ -15,10 +15,12 @@ HEADERS += \
     $$PWD/filterlayerentityjob_p.h \
     $$PWD/filterentitybycomponentjob_p.h \
     $$PWD/materialparametergathererjob_p.h \
+    $$PWD/materialparametergatherercache_p.h \
     $$PWD/genericlambdajob_p.h \
     $$PWD/renderviewbuilderjob_p.h \
     $$PWD/renderviewinitializerjob_p.h \
     $$PWD/frustumcullingjob_p.h \
+    $$PWD/occlusioncullingjob_p.h \
     $$PWD/lightgatherer_p.h \
     $$PWD/expandboundingvolumejob_p.h \
     $$PWD/updateworldboundingvolumejob_p.h \
@@ -44,9 +46,11 @@ SOURCES += \
     $$PWD/calcgeometrytrianglevolumes.cpp \
     $$PWD/filterlayerentityjob.cpp \
     $$PWD/materialparametergathererjob.cpp \
+    $$PWD/materialparametergatherercache.cpp \
     $$PWD/renderviewbuilderjob.cpp \
     $$PWD/renderviewinitializerjob.cpp \
     $$PWD/frustumcullingjob.cpp \
+    $$PWD/occlusioncullingjob.cpp \
     $$PWD/lightgatherer.cpp \
     $$PWD/expandboundingvolumejob.cpp \
     $$PWD/updateworldboundingvolumejob.cpp \
@@ -58,14 +58,24 @@ LightGatherer::LightGatherer()
 
 void LightGatherer::run()
 {
-    const QVector<HEntity> handles = m_manager->activeHandles();
-    int envLightCount = 0;
+    // The job may be reused across frames
+    m_lights.clear();
+    m_environmentLight = nullptr;
 
-    for (const HEntity handle : handles) {
+    // Only visit the archetypes holding lights
+    const QVector<HEntity> lightHandles = m_manager->entitiesWithComponentTypes(Entity::LightComponent);
+    m_lights.reserve(lightHandles.size());
+    for (const HEntity handle : lightHandles) {
         Entity *node = m_manager->data(handle);
         const QVector<Light *> lights = node->renderComponents<Light>();
         if (!lights.isEmpty())
             m_lights.push_back(LightSource(node, lights));
+    }
+
+    const QVector<HEntity> envLightHandles = m_manager->entitiesWithComponentTypes(Entity::EnvironmentLightComponent);
+    int envLightCount = 0;
+    for (const HEntity handle : envLightHandles) {
+        Entity *node = m_manager->data(handle);
         const QVector<EnvironmentLight *> envLights = node->renderComponents<EnvironmentLight>();
         envLightCount += envLights.size();
         if (!envLights.isEmpty() && !m_environmentLight)
@@ -70,12 +70,7 @@ public:
 
     inline void setManager(EntityManager *manager) Q_DECL_NOTHROW { m_manager = manager; }
     inline QVector<LightSource> &lights() { return m_lights; }
-    inline EnvironmentLight *takeEnvironmentLight()
-    {
-        auto envLight = m_environmentLight;
-        m_environmentLight = nullptr;
-        return envLight;
-    }
+    inline EnvironmentLight *environmentLight() const Q_DECL_NOTHROW { return m_environmentLight; }
 
     void run() Q_DECL_FINAL;
 
@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QT3DRENDER_RENDER_MATERIALPARAMETERGATHERERCACHE_P_H
+#define QT3DRENDER_RENDER_MATERIALPARAMETERGATHERERCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <Qt3DCore/qnodeid.h>
+#include <Qt3DRender/private/renderviewjobutils_p.h>
+#include <Qt3DRender/private/qt3drender_global_p.h>
+#include <QHash>
+#include <QReadWriteLock>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+struct MaterialParameterGathererCacheKey
+{
+    Qt3DCore::QNodeId materialId;
+    Qt3DCore::QNodeId techniqueFilterId;
+    Qt3DCore::QNodeId renderPassFilterId;
+};
+
+inline bool operator==(const MaterialParameterGathererCacheKey &a,
+                       const MaterialParameterGathererCacheKey &b) Q_DECL_NOTHROW
+{
+    return a.materialId == b.materialId
+            && a.techniqueFilterId == b.techniqueFilterId
+            && a.renderPassFilterId == b.renderPassFilterId;
+}
+
+inline uint qHash(const MaterialParameterGathererCacheKey &key, uint seed = 0) Q_DECL_NOTHROW
+{
+    return qHash(key.materialId, seed)
+            ^ (qHash(key.techniqueFilterId, seed) * 31U)
+            ^ (qHash(key.renderPassFilterId, seed) * 131U);
+}
+
+// Keeps the RenderPassParameterData gathered for a material in a given
+// TechniqueFilter/RenderPassFilter configuration across frames. The Renderer
+// clears it whenever a node of the material system (Material, Effect,
+// Technique, RenderPass, Parameter, FilterKey or one of the filters) marks the
+// MaterialDirty flag. Lookups from the parallel gatherer jobs only take a
+// read lock.
+class QT3DRENDERSHARED_PRIVATE_EXPORT MaterialParameterGathererCache
+{
+public:
+    MaterialParameterGathererCache();
+
+    bool lookup(const MaterialParameterGathererCacheKey &key,
+                QVector<RenderPassParameterData> *passesData) const;
+    void insert(const MaterialParameterGathererCacheKey &key,
+                const QVector<RenderPassParameterData> &passesData);
+    void clear();
+
+    int size() const;
+
+private:
+    mutable QReadWriteLock m_lock;
+    QHash<MaterialParameterGathererCacheKey, QVector<RenderPassParameterData>> m_entries;
+};
+
+} // Render
+
+} // Qt3DRender
+
+QT_END_NAMESPACE
+
+#endif // QT3DRENDER_RENDER_MATERIALPARAMETERGATHERERCACHE_P_H
@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "materialparametergathererjob_p.h"
+#include "materialparametergatherercache_p.h"
 #include <Qt3DRender/private/nodemanagers_p.h>
 #include <Qt3DRender/private/managers_p.h>
 #include <Qt3DRender/private/renderpassfilternode_p.h>
@@ -63,6 +64,7 @@ MaterialParameterGathererJob::MaterialParameterGathererJob()
     , m_techniqueFilter(nullptr)
     , m_renderPassFilter(nullptr)
     , m_renderer(nullptr)
+    , m_cache(nullptr)
 {
     SET_JOB_RUN_STAT_TYPE(this, JobTypes::MaterialParameterGathering, materialParameterGathererCounter++);
 }
@@ -71,58 +73,82 @@ MaterialParameterGathererJob::MaterialParameterGathererJob()
 
 // Parameters from Material/Effect/Technique
 
-// Note: we could maybe improve that by having a smart update when we detect
-// that a parameter value has changed. That might require way more book keeping
-// which might make this solution a bit too complex
-
-// The fact that this can now be performed in parallel should already provide a big
-// improvement
+// The gathered RenderPassParameterData only reference the Parameter handles,
+// not their values. When a cache is set, the results are therefore reused
+// across frames until a node of the material system changes and the Renderer
+// invalidates the cache.
 void MaterialParameterGathererJob::run()
 {
+    const Qt3DCore::QNodeId techniqueFilterId = m_techniqueFilter ? m_techniqueFilter->peerId() : Qt3DCore::QNodeId();
+    const Qt3DCore::QNodeId renderPassFilterId = m_renderPassFilter ? m_renderPassFilter->peerId() : Qt3DCore::QNodeId();
+
+    // The job may be reused across frames
+    m_parameters.clear();
+
     for (const HMaterial materialHandle : qAsConst(m_handles)) {
         Material *material = m_manager->materialManager()->data(materialHandle);
 
         if (Q_UNLIKELY(!material->isEnabled()))
             continue;
 
-        Effect *effect = m_manager->effectManager()->lookupResource(material->effect());
-        Technique *technique = findTechniqueForEffect(m_renderer, m_techniqueFilter, effect);
-
-        if (Q_LIKELY(technique != nullptr)) {
-            RenderPassList passes = findRenderPassesForTechnique(m_manager, m_renderPassFilter, technique);
-            if (Q_LIKELY(passes.size() > 0)) {
-                // Order set:
-                // 1 Pass Filter
-                // 2 Technique Filter
-                // 3 Material
-                // 4 Effect
-                // 5 Technique
-                // 6 RenderPass
-
-                // Add Parameters define in techniqueFilter and passFilter
-                // passFilter have priority over techniqueFilter
-
-                ParameterInfoList parameters;
-                // Doing the reserve allows a gain of 0.5ms on some of the demo examples
-                parameters.reserve(likelyNumberOfParameters);
-
-                if (m_renderPassFilter)
-                    parametersFromParametersProvider(&parameters, m_manager->parameterManager(),
-                                                     m_renderPassFilter);
-                if (m_techniqueFilter)
-                    parametersFromParametersProvider(&parameters, m_manager->parameterManager(),
-                                                     m_techniqueFilter);
-                // Get the parameters for our selected rendering setup (override what was defined in the technique/pass filter)
-                parametersFromMaterialEffectTechnique(&parameters, m_manager->parameterManager(), material, effect, technique);
-
-                for (RenderPass *renderPass : passes) {
-                    ParameterInfoList globalParameters = parameters;
-                    parametersFromParametersProvider(&globalParameters, m_manager->parameterManager(), renderPass);
-                    m_parameters[material->peerId()].push_back({renderPass, globalParameters});
-                }
+        QVector<RenderPassParameterData> passesData;
+        if (m_cache != nullptr) {
+            const MaterialParameterGathererCacheKey key = { material->peerId(), techniqueFilterId, renderPassFilterId };
+            if (!m_cache->lookup(key, &passesData)) {
+                passesData = gatherParameters(material);
+                m_cache->insert(key, passesData);
+            }
+        } else {
+            passesData = gatherParameters(material);
+        }
+
+        if (!passesData.isEmpty())
+            m_parameters.insert(material->peerId(), passesData);
+    }
+}
+
+QVector<RenderPassParameterData> MaterialParameterGathererJob::gatherParameters(Material *material) const
+{
+    QVector<RenderPassParameterData> passesData;
+    Effect *effect = m_manager->effectManager()->lookupResource(material->effect());
+    Technique *technique = findTechniqueForEffect(m_renderer, m_techniqueFilter, effect);
+
+    if (Q_LIKELY(technique != nullptr)) {
+        RenderPassList passes = findRenderPassesForTechnique(m_manager, m_renderPassFilter, technique);
+        if (Q_LIKELY(passes.size() > 0)) {
+            // Order set:
+            // 1 Pass Filter
+            // 2 Technique Filter
+            // 3 Material
+            // 4 Effect
+            // 5 Technique
+            // 6 RenderPass
+
+            // Add Parameters define in techniqueFilter and passFilter
+            // passFilter have priority over techniqueFilter
+
+            ParameterInfoList parameters;
+            // Doing the reserve allows a gain of 0.5ms on some of the demo examples
+            parameters.reserve(likelyNumberOfParameters);
+
+            if (m_renderPassFilter)
+                parametersFromParametersProvider(&parameters, m_manager->parameterManager(),
+                                                 m_renderPassFilter);
+            if (m_techniqueFilter)
+                parametersFromParametersProvider(&parameters, m_manager->parameterManager(),
+                                                 m_techniqueFilter);
+            // Get the parameters for our selected rendering setup (override what was defined in the technique/pass filter)
+            parametersFromMaterialEffectTechnique(&parameters, m_manager->parameterManager(), material, effect, technique);
+
+            passesData.reserve(passes.size());
+            for (RenderPass *renderPass : passes) {
+                ParameterInfoList globalParameters = parameters;
+                parametersFromParametersProvider(&globalParameters, m_manager->parameterManager(), renderPass);
+                passesData.push_back({renderPass, globalParameters});
             }
         }
     }
+    return passesData;
 }
 
 } // Render
@@ -67,6 +67,7 @@ class NodeManagers;
 class TechniqueFilter;
 class RenderPassFilter;
 class Renderer;
+class MaterialParameterGathererCache;
 
 // TO be executed for each FrameGraph branch with a given RenderPassFilter/TechniqueFilter
 
@@ -79,19 +80,25 @@ public:
     inline void setTechniqueFilter(TechniqueFilter *techniqueFilter) Q_DECL_NOTHROW { m_techniqueFilter = techniqueFilter; }
     inline void setRenderPassFilter(RenderPassFilter *renderPassFilter) Q_DECL_NOTHROW { m_renderPassFilter = renderPassFilter; }
     inline void setRenderer(Renderer *renderer) Q_DECL_NOTHROW { m_renderer = renderer; }
+    inline void setCache(MaterialParameterGathererCache *cache) Q_DECL_NOTHROW { m_cache = cache; }
     inline QHash<Qt3DCore::QNodeId, QVector<RenderPassParameterData>> &materialToPassAndParameter() Q_DECL_NOTHROW { return m_parameters; }
     inline void setHandles(const QVector<HMaterial> &handles) Q_DECL_NOTHROW { m_handles = handles; }
+    inline QVector<HMaterial> handles() const Q_DECL_NOTHROW { return m_handles; }
 
     inline TechniqueFilter *techniqueFilter() const Q_DECL_NOTHROW { return m_techniqueFilter; }
     inline RenderPassFilter *renderPassFilter() const Q_DECL_NOTHROW { return m_renderPassFilter; }
+    inline MaterialParameterGathererCache *cache() const Q_DECL_NOTHROW { return m_cache; }
 
     void run() Q_DECL_FINAL;
 
 private:
+    QVector<RenderPassParameterData> gatherParameters(Material *material) const;
+
     NodeManagers *m_manager;
     TechniqueFilter *m_techniqueFilter;
     RenderPassFilter *m_renderPassFilter;
     Renderer *m_renderer;
+    MaterialParameterGathererCache *m_cache;
 
     // Material id to array of RenderPasse with parameters
     QHash<Qt3DCore::QNodeId, QVector<RenderPassParameterData>> m_parameters;
@@ -0,0 +1,256 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "occlusioncullingjob_p.h"
+#include <Qt3DRender/private/job_common_p.h>
+#include <Qt3DRender/private/managers_p.h>
+#include <Qt3DRender/private/nodemanagers_p.h>
+#include <Qt3DRender/private/entity_p.h>
+#include <Qt3DRender/private/sphere_p.h>
+#include <Qt3DRender/private/trianglesvisitor_p.h>
+
+#include <QBitArray>
+
+#include <algorithm>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+namespace {
+
+// Maps a point to depth buffer coordinates. Returns false if the point lies
+// behind the camera or in front of the near plane as clipping isn't supported.
+bool projectToScreen(const QMatrix4x4 &mvp, const QSize &size, const QVector3D &p, QVector3D *screen)
+{
+    const QVector4D clip = mvp * QVector4D(p, 1.0f);
+    if (clip.w() <= 1e-5f)
+        return false;
+    const QVector3D ndc = clip.toVector3D() / clip.w();
+    if (ndc.z() < -1.0f)
+        return false;
+    *screen = QVector3D((ndc.x() * 0.5f + 0.5f) * size.width(),
+                        (0.5f - ndc.y() * 0.5f) * size.height(),
+                        ndc.z() * 0.5f + 0.5f);
+    return true;
+}
+
+class OccluderTrianglesGatherer : public TrianglesVisitor
+{
+public:
+    OccluderTrianglesGatherer(NodeManagers *manager, const QMatrix4x4 &mvp,
+                              const QSize &size, QVector<QVector3D> *triangles)
+        : TrianglesVisitor(manager)
+        , m_mvp(mvp)
+        , m_size(size)
+        , m_triangles(triangles)
+    {}
+
+    void visit(uint andx, const QVector3D &a,
+               uint bndx, const QVector3D &b,
+               uint cndx, const QVector3D &c) Q_DECL_OVERRIDE
+    {
+        Q_UNUSED(andx);
+        Q_UNUSED(bndx);
+        Q_UNUSED(cndx);
+        QVector3D screenA, screenB, screenC;
+        // Dropping a triangle only makes the culling less aggressive
+        if (!projectToScreen(m_mvp, m_size, a, &screenA)
+                || !projectToScreen(m_mvp, m_size, b, &screenB)
+                || !projectToScreen(m_mvp, m_size, c, &screenC))
+            return;
+        m_triangles->push_back(screenA);
+        m_triangles->push_back(screenB);
+        m_triangles->push_back(screenC);
+    }
+
+private:
+    const QMatrix4x4 m_mvp;
+    const QSize m_size;
+    QVector<QVector3D> *m_triangles;
+};
+
+} // anonymous
+
+OcclusionRasterizerJob::OcclusionRasterizerJob(int index)
+    : Qt3DCore::QAspectJob()
+    , m_depthBuffer(nullptr)
+    , m_firstRow(0)
+    , m_lastRow(0)
+{
+    SET_JOB_RUN_STAT_TYPE(this, JobTypes::OcclusionRasterization, index);
+}
+
+void OcclusionRasterizerJob::run()
+{
+    if (m_depthBuffer == nullptr)
+        return;
+
+    // Each rasterizer only writes its own rows of the shared depth buffer
+    for (int i = 0, m = m_triangles.size() - 2; i < m; i += 3)
+        m_depthBuffer->rasterizeTriangle(m_triangles.at(i), m_triangles.at(i + 1), m_triangles.at(i + 2),
+                                         m_firstRow, m_lastRow);
+}
+
+OcclusionCullingJob::OcclusionCullingJob(int rasterizerCount)
+    : Qt3DCore::QAspectJob()
+    , m_manager(nullptr)
+    , m_depthBufferSize(256, 128)
+    , m_active(false)
+    , m_hasOccluders(false)
+{
+    SET_JOB_RUN_STAT_TYPE(this, JobTypes::OcclusionCulling, 0);
+
+    rasterizerCount = std::max(rasterizerCount, 1);
+    m_rasterizerJobs.reserve(rasterizerCount);
+    for (int i = 0; i < rasterizerCount; ++i) {
+        auto rasterizerJob = OcclusionRasterizerJobPtr::create(i);
+        rasterizerJob->setDepthBuffer(&m_depthBuffer);
+        m_rasterizerJobs.push_back(rasterizerJob);
+    }
+}
+
+void OcclusionCullingJob::run()
+{
+    m_hasOccluders = false;
+
+    // Reset the rasterizers so that they don't use triangles from a previous frame
+    for (const OcclusionRasterizerJobPtr &rasterizerJob : qAsConst(m_rasterizerJobs))
+        rasterizerJob->setTriangles(QVector<QVector3D>());
+
+    // Early return if not activated
+    if (!m_active || m_manager == nullptr)
+        return;
+
+    m_depthBuffer.resize(m_depthBufferSize);
+    m_depthBuffer.clear();
+    const QSize size = m_depthBuffer.size();
+
+    // Gather the occluder triangles in depth buffer coordinates. The occluder
+    // Layer tracks the handle indices of the Entities referencing it
+    QVector<QVector3D> triangles;
+    const Layer *occluderLayer = m_manager->layerManager()->lookupResource(m_occluderLayerId);
+    const QBitArray occluders = (occluderLayer != nullptr && occluderLayer->isEnabled()) ? occluderLayer->entities() : QBitArray();
+    const int occludersCount = occluders.size();
+    EntityManager *entityManager = m_manager->renderNodesManager();
+    const QVector<HEntity> handles = occludersCount > 0
+            ? entityManager->entitiesWithComponentTypes(Entity::componentTypesOf<Layer, GeometryRenderer>())
+            : QVector<HEntity>();
+    for (const HEntity handle : handles) {
+        const int index = int(handle.index());
+        if (index >= occludersCount || !occluders.testBit(index))
+            continue;
+        const Entity *entity = entityManager->data(handle);
+        if (!entity->isTreeEnabled())
+            continue;
+        const GeometryRenderer *geometryRenderer = entity->renderComponent<GeometryRenderer>();
+        if (geometryRenderer == nullptr)
+            continue;
+        OccluderTrianglesGatherer gatherer(m_manager, m_viewProjection * *entity->worldTransform(), size, &triangles);
+        gatherer.apply(geometryRenderer, entity->peerId());
+    }
+    m_hasOccluders = !triangles.isEmpty();
+
+    // Split the depth buffer in bands of rows, one per rasterizer
+    const int rasterizerCount = m_rasterizerJobs.size();
+    const int rowsPerJob = size.height() / rasterizerCount;
+    for (int i = 0; i < rasterizerCount; ++i) {
+        const OcclusionRasterizerJobPtr &rasterizerJob = m_rasterizerJobs.at(i);
+        const int lastRow = (i == rasterizerCount - 1) ? size.height() : (i + 1) * rowsPerJob;
+        rasterizerJob->setRows(i * rowsPerJob, lastRow);
+        rasterizerJob->setTriangles(triangles);
+    }
+}
+
+// To be called once the rasterizer jobs have completed. Removes the entities
+// whose bounding volume is hidden behind the occluders, preserving the order
+// of the remaining ones.
+void OcclusionCullingJob::removeOccludedEntities(QVector<Entity *> &entities)
+{
+    if (!m_active || !m_hasOccluders)
+        return;
+
+    m_depthBuffer.buildPyramid();
+    entities.erase(std::remove_if(entities.begin(), entities.end(),
+                                  [this] (const Entity *entity) { return isOccluded(entity); }),
+                   entities.end());
+}
+
+bool OcclusionCullingJob::isOccluded(const Entity *entity) const
+{
+    const Sphere *s = entity->worldBoundingVolume();
+    if (s->radius() <= 0.0f)
+        return false;
+
+    // Project the corners of the box enclosing the bounding sphere, their
+    // screen space bounds and nearest depth conservatively cover the sphere
+    const QSize size = m_depthBuffer.size();
+    const QVector3D center = s->center();
+    const float r = s->radius();
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    float nearestDepth = std::numeric_limits<float>::max();
+    for (int i = 0; i < 8; ++i) {
+        const QVector3D corner(center.x() + ((i & 1) ? r : -r),
+                               center.y() + ((i & 2) ? r : -r),
+                               center.z() + ((i & 4) ? r : -r));
+        QVector3D screen;
+        if (!projectToScreen(m_viewProjection, size, corner, &screen))
+            return false;
+        minX = std::min(minX, screen.x());
+        maxX = std::max(maxX, screen.x());
+        minY = std::min(minY, screen.y());
+        maxY = std::max(maxY, screen.y());
+        nearestDepth = std::min(nearestDepth, screen.z());
+    }
+
+    return m_depthBuffer.isOccluded(QRectF(QPointF(minX, minY), QPointF(maxX, maxY)), nearestDepth);
+}
+
+} // Render
+
+} // Qt3DRender
+
+QT_END_NAMESPACE
@@ -0,0 +1,136 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QT3DRENDER_RENDER_OCCLUSIONCULLINGJOB_P_H
+#define QT3DRENDER_RENDER_OCCLUSIONCULLINGJOB_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <Qt3DCore/qaspectjob.h>
+#include <Qt3DCore/qnodeid.h>
+#include <Qt3DRender/private/softwaredepthbuffer_p.h>
+#include <QMatrix4x4>
+#include <QSharedPointer>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+class Entity;
+class NodeManagers;
+
+class Q_AUTOTEST_EXPORT OcclusionRasterizerJob : public Qt3DCore::QAspectJob
+{
+public:
+    explicit OcclusionRasterizerJob(int index = 0);
+
+    inline void setDepthBuffer(SoftwareDepthBuffer *depthBuffer) Q_DECL_NOTHROW { m_depthBuffer = depthBuffer; }
+    inline void setRows(int firstRow, int lastRow) Q_DECL_NOTHROW { m_firstRow = firstRow; m_lastRow = lastRow; }
+    inline int firstRow() const Q_DECL_NOTHROW { return m_firstRow; }
+    inline int lastRow() const Q_DECL_NOTHROW { return m_lastRow; }
+    inline void setTriangles(const QVector<QVector3D> &triangles) Q_DECL_NOTHROW { m_triangles = triangles; }
+    inline QVector<QVector3D> triangles() const Q_DECL_NOTHROW { return m_triangles; }
+
+    void run() Q_DECL_FINAL;
+
+private:
+    SoftwareDepthBuffer *m_depthBuffer;
+    QVector<QVector3D> m_triangles;
+    int m_firstRow;
+    int m_lastRow;
+};
+
+typedef QSharedPointer<OcclusionRasterizerJob> OcclusionRasterizerJobPtr;
+
+class Q_AUTOTEST_EXPORT OcclusionCullingJob : public Qt3DCore::QAspectJob
+{
+public:
+    explicit OcclusionCullingJob(int rasterizerCount = 1);
+
+    inline void setManagers(NodeManagers *manager) Q_DECL_NOTHROW { m_manager = manager; }
+    inline void setActive(bool active) Q_DECL_NOTHROW { m_active = active; }
+    inline bool isActive() const Q_DECL_NOTHROW { return m_active; }
+    inline void setViewProjection(const QMatrix4x4 &viewProjection) Q_DECL_NOTHROW { m_viewProjection = viewProjection; }
+    inline QMatrix4x4 viewProjection() const Q_DECL_NOTHROW { return m_viewProjection; }
+    inline void setOccluderLayerId(Qt3DCore::QNodeId occluderLayerId) Q_DECL_NOTHROW { m_occluderLayerId = occluderLayerId; }
+    inline Qt3DCore::QNodeId occluderLayerId() const Q_DECL_NOTHROW { return m_occluderLayerId; }
+    inline void setDepthBufferSize(const QSize &size) Q_DECL_NOTHROW { m_depthBufferSize = size; }
+    inline QSize depthBufferSize() const Q_DECL_NOTHROW { return m_depthBufferSize; }
+
+    inline QVector<OcclusionRasterizerJobPtr> rasterizerJobs() const Q_DECL_NOTHROW { return m_rasterizerJobs; }
+    inline const SoftwareDepthBuffer *depthBuffer() const Q_DECL_NOTHROW { return &m_depthBuffer; }
+
+    void removeOccludedEntities(QVector<Entity *> &entities);
+
+    void run() Q_DECL_FINAL;
+
+private:
+    bool isOccluded(const Entity *entity) const;
+
+    NodeManagers *m_manager;
+    QMatrix4x4 m_viewProjection;
+    Qt3DCore::QNodeId m_occluderLayerId;
+    QSize m_depthBufferSize;
+    SoftwareDepthBuffer m_depthBuffer;
+    QVector<OcclusionRasterizerJobPtr> m_rasterizerJobs;
+    bool m_active;
+    bool m_hasOccluders;
+};
+
+typedef QSharedPointer<OcclusionCullingJob> OcclusionCullingJobPtr;
+
+} // Render
+
+} // Qt3DRender
+
+QT_END_NAMESPACE
+
+#endif // QT3DRENDER_RENDER_OCCLUSIONCULLINGJOB_P_H
@@ -61,6 +61,9 @@ RenderViewBuilderJob::RenderViewBuilderJob()
 
 void RenderViewBuilderJob::run()
 {
+    // The job is reused across frames, don't keep the previous frame commands
+    m_commands.clear();
+
     // Build RenderCommand should perform the culling as we have no way to determine
     // if a child has a mesh in the view frustum while its parent isn't contained in it.
     if (!m_renderView->noDraw()) {
@@ -53,6 +53,7 @@
 #include <Qt3DRender/private/renderstateset_p.h>
 #include <Qt3DRender/private/rendertargetselectornode_p.h>
 #include <Qt3DRender/private/renderview_p.h>
+#include <Qt3DRender/private/renderer_p.h>
 #include <Qt3DRender/private/sortpolicy_p.h>
 #include <Qt3DRender/private/techniquefilternode_p.h>
 #include <Qt3DRender/private/viewportnode_p.h>
@@ -67,6 +68,7 @@
 #include <Qt3DRender/private/stringtoint_p.h>
 #include <Qt3DRender/private/techniquemanager_p.h>
 #include <Qt3DRender/private/memorybarrier_p.h>
+#include <Qt3DRender/private/occlusionculling_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -75,6 +77,32 @@ using namespace Qt3DCore;
 namespace Qt3DRender {
 namespace Render {
 
+namespace {
+
+// Per instance attributes need glVertexAttribDivisor
+bool supportsInstancedArrays(const Renderer *renderer)
+{
+    if (renderer == nullptr)
+        return false;
+    const GraphicsApiFilterData *contextInfo = renderer->contextInfo();
+    const int version = contextInfo->m_major * 10 + contextInfo->m_minor;
+    if (contextInfo->m_api == QGraphicsApiFilter::OpenGLES)
+        return version >= 30;
+    return version >= 33;
+}
+
+// Batching geometries sharing their buffers relies on glDrawElementsBaseVertex
+bool supportsMultiDraw(const Renderer *renderer)
+{
+    if (renderer == nullptr)
+        return false;
+    const GraphicsApiFilterData *contextInfo = renderer->contextInfo();
+    const int version = contextInfo->m_major * 10 + contextInfo->m_minor;
+    return contextInfo->m_api == QGraphicsApiFilter::OpenGL && version >= 33;
+}
+
+} // anonymous
+
 /*!
     \internal
     Walks up the framegraph tree from \a fgLeaf and builds up as much state
@@ -172,6 +200,10 @@ void setRenderViewConfigFromFrameGraphLeafNode(RenderView *rv, const FrameGraphN
             case FrameGraphNode::SortMethod: {
                 const Render::SortPolicy *sortPolicy = static_cast<const Render::SortPolicy *>(node);
                 rv->addSortType(sortPolicy->sortTypes());
+                if (sortPolicy->isInstancingEnabled() && supportsInstancedArrays(rv->renderer())) {
+                    rv->setInstancingEnabled(true);
+                    rv->setMultiDrawEnabled(supportsMultiDraw(rv->renderer()));
+                }
                 break;
             }
 
@@ -204,6 +236,17 @@ void setRenderViewConfigFromFrameGraphLeafNode(RenderView *rv, const FrameGraphN
                 break;
             }
 
+            case FrameGraphNode::OcclusionCulling: {
+                // The OcclusionCulling node closest to the leaf wins
+                if (!rv->occlusionCulling()) {
+                    const Render::OcclusionCulling *occlusionCulling = static_cast<const Render::OcclusionCulling *>(node);
+                    rv->setOcclusionCulling(true);
+                    rv->setOccluderLayerId(occlusionCulling->occluderLayerId());
+                    rv->setOcclusionDepthBufferSize(occlusionCulling->depthBufferSize());
+                }
+                break;
+            }
+
             case FrameGraphNode::ComputeDispatch: {
                 const Render::DispatchCompute *dispatchCompute = static_cast<const Render::DispatchCompute *>(node);
                 rv->setCompute(true);
@@ -498,6 +541,118 @@ void UniformBlockValueBuilder::buildActiveUniformNameValueMapStructHelper(Shader
     }
 }
 
+void UniformBlockValueBuilder::fillBlockData(QByteArray &blockData) const
+{
+    auto it = activeUniformNamesToValue.cbegin();
+    const auto end = activeUniformNamesToValue.cend();
+    while (it != end) {
+        const auto uniformIt = uniforms.constFind(StringToInt::lookupString(it.key()));
+        // Textures can't be stored in a uniform block
+        if (uniformIt != uniforms.cend() && it.value().userType() != qNodeIdTypeId)
+            fillUniformBlockMember(blockData, uniformIt.value(), UniformValue::fromVariant(it.value()));
+        ++it;
+    }
+}
+
+// Copies value at the offset and strides reported for a uniform block member.
+// UniformValue stores its elements as tightly packed 32 bit values, which
+// avoids going through the thread unsafe QGraphicsUtils helpers.
+void fillUniformBlockMember(QByteArray &blockData, const ShaderUniform &description, const UniformValue &value)
+{
+    int columns = 1;
+    int rows = 1;
+
+    switch (description.m_uniformType) {
+    case Float:
+    case Int:
+    case UInt:
+    case Bool:
+        break;
+    case Vec2:
+    case IVec2:
+    case UIVec2:
+    case BVec2:
+        rows = 2;
+        break;
+    case Vec3:
+    case IVec3:
+    case UIVec3:
+    case BVec3:
+        rows = 3;
+        break;
+    case Vec4:
+    case IVec4:
+    case UIVec4:
+    case BVec4:
+        rows = 4;
+        break;
+    case Mat2:
+        columns = 2;
+        rows = 2;
+        break;
+    case Mat3:
+        columns = 3;
+        rows = 3;
+        break;
+    case Mat4:
+        columns = 4;
+        rows = 4;
+        break;
+    case Mat2x3:
+        columns = 2;
+        rows = 3;
+        break;
+    case Mat3x2:
+        columns = 3;
+        rows = 2;
+        break;
+    case Mat2x4:
+        columns = 2;
+        rows = 4;
+        break;
+    case Mat4x2:
+        columns = 4;
+        rows = 2;
+        break;
+    case Mat3x4:
+        columns = 3;
+        rows = 4;
+        break;
+    case Mat4x3:
+        columns = 4;
+        rows = 3;
+        break;
+    default:
+        qCWarning(Shaders) << "Unsupported uniform block member type for" << description.m_name;
+        return;
+    }
+
+    const int columnByteSize = rows * int(sizeof(float));
+    const int elementByteSize = columns * columnByteSize;
+    const int matrixStride = description.m_matrixStride > 0 ? description.m_matrixStride : columnByteSize;
+    const int arrayStride = description.m_arrayStride > 0 ? description.m_arrayStride : columns * matrixStride;
+    const int elementCount = qMin(qMax(description.m_size, 1), value.byteSize() / elementByteSize);
+
+    // See QTBUG-57510 and uniform_p.h
+    UniformValue floatValue;
+    const UniformValue *v = &value;
+    if (description.m_uniformType == Float && value.storedType() == Int) {
+        floatValue = UniformValue(float(*value.constData<int>()));
+        v = &floatValue;
+    }
+
+    const char *src = reinterpret_cast<const char *>(v->constData<float>());
+    char *dst = blockData.data();
+    for (int i = 0; i < elementCount; ++i) {
+        for (int c = 0; c < columns; ++c) {
+            const int offset = description.m_offset + i * arrayStride + c * matrixStride;
+            if (offset < 0 || offset + columnByteSize > blockData.size())
+                return;
+            memcpy(dst + offset, src + i * elementByteSize + c * columnByteSize, columnByteSize);
+        }
+    }
+}
+
 ParameterInfo::ParameterInfo(const int nameId, const UniformValue &value)
     : nameId(nameId)
     , value(value)
@@ -151,6 +151,10 @@ Q_AUTOTEST_EXPORT void addToRenderStateSet(RenderStateSet *stateSet,
                                            const QVector<Qt3DCore::QNodeId> stateIds,
                                            RenderStateManager *manager);
 
+Q_AUTOTEST_EXPORT void fillUniformBlockMember(QByteArray &blockData,
+                                              const ShaderUniform &description,
+                                              const UniformValue &value);
+
 typedef QHash<int, QVariant> UniformBlockValueBuilderHash;
 
 struct Q_AUTOTEST_EXPORT UniformBlockValueBuilder
@@ -165,6 +169,7 @@ struct Q_AUTOTEST_EXPORT UniformBlockValueBuilder
     void buildActiveUniformNameValueMapStructHelper(ShaderData *rShaderData,
                                                     const QString &blockName,
                                                     const QString &qmlPropertyName = QString());
+    void fillBlockData(QByteArray &blockData) const;
 
     bool updatedPropertiesOnly;
     QHash<QString, ShaderUniform> uniforms;
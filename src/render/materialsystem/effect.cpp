@@ -106,7 +106,7 @@ void Effect::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         break;
     }
 
-    markDirty(AbstractRenderer::AllDirty);
+    markDirty(AbstractRenderer::MaterialDirty);
     BackendNode::sceneChangeEvent(e);
 }
 
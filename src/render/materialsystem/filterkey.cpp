@@ -93,7 +93,7 @@ void FilterKey::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         else if (propertyChange->propertyName() == QByteArrayLiteral("name"))
             m_name = propertyChange->value().toString();
 
-        markDirty(AbstractRenderer::AllDirty);
+        markDirty(AbstractRenderer::MaterialDirty);
     }
 
     default:
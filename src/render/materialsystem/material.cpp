@@ -110,7 +110,7 @@ void Material::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
     default:
         break;
     }
-    markDirty(AbstractRenderer::AllDirty);
+    markDirty(AbstractRenderer::MaterialDirty);
 
     BackendNode::sceneChangeEvent(e);
 }
@@ -28,6 +28,7 @@ HEADERS += \
     $$PWD/qgraphicsapifilter.h \
     $$PWD/qgraphicsapifilter_p.h \
     $$PWD/shadercache_p.h \
+    $$PWD/shaderbinarycache_p.h \
     $$PWD/techniquemanager_p.h
 
 SOURCES += \
@@ -49,4 +50,5 @@ SOURCES += \
     $$PWD/technique.cpp \
     $$PWD/qgraphicsapifilter.cpp \
     $$PWD/shadercache.cpp \
+    $$PWD/shaderbinarycache.cpp \
     $$PWD/techniquemanager.cpp
@@ -87,10 +87,12 @@ void Parameter::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
         if (propertyChange->propertyName() == QByteArrayLiteral("name")) {
             m_name = propertyChange->value().toString();
             m_nameId = StringToInt::lookupId(m_name);
+            markDirty(AbstractRenderer::MaterialDirty);
         } else if (propertyChange->propertyName() == QByteArrayLiteral("value")) {
             m_uniformValue = UniformValue::fromVariant(propertyChange->value());
+            // Gathered parameters reference the Parameter, not its value
+            markDirty(AbstractRenderer::AllDirty);
         }
-        markDirty(AbstractRenderer::AllDirty);
     }
 
     BackendNode::sceneChangeEvent(e);
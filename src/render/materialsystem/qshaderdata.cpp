@@ -73,6 +73,14 @@ QShaderDataPrivate::QShaderDataPrivate(PropertyReaderInterfacePtr reader)
  * property should be Qt3DRender::QShaderData* instead of the name of your
  * subclass.
  *
+ * When a QShaderData is the value of a parameter matching the name of a
+ * uniform block, its properties are laid out in a uniform buffer which is
+ * only updated when their values change. Shaders can additionally declare a
+ * uniform block named \c qt3d_render_view_uniforms: its members named after
+ * the view related standard uniforms (viewMatrix, projectionMatrix,
+ * eyePosition, ...) and lights are filled once per render view and shared by
+ * all the draw calls.
+ *
  * \since 5.5
  */
 
@@ -129,7 +129,7 @@ void RenderPass::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
     }
 
     BackendNode::sceneChangeEvent(e);
-    markDirty(AbstractRenderer::AllDirty);
+    markDirty(AbstractRenderer::MaterialDirty);
 }
 
 Qt3DCore::QNodeId RenderPass::shaderProgram() const
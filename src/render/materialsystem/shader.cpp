@@ -276,7 +276,9 @@ void Shader::prepareUniforms(ShaderParameterPack &pack)
         // Find if there's a uniform with the same name id
         for (const ShaderUniform &uniform : qAsConst(m_uniforms)) {
             if (uniform.m_nameId == it.key()) {
-                pack.setSubmissionUniform(uniform);
+                // Uniform block members are provided by buffers
+                if (uniform.m_blockIndex == -1)
+                    pack.setSubmissionUniform(uniform);
                 break;
             }
         }
@@ -0,0 +1,378 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "shaderbinarycache_p.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+namespace Render {
+
+namespace {
+
+const quint32 binaryCacheMagic = 0x51334442; // "Q3DB"
+const quint32 binaryCacheUsageMagic = 0x51334455; // "Q3DU"
+const quint32 binaryCacheVersion = 1;
+const QLatin1String binaryCacheSuffix(".bin");
+const QLatin1String binaryCacheUsageFile("usage");
+
+} // anonymous
+
+/*!
+ * \internal
+ *
+ * Creates a ShaderBinaryCache. It is disabled until a cache directory is set.
+ */
+ShaderBinaryCache::ShaderBinaryCache()
+    : m_session(0)
+    , m_usageDirty(false)
+{
+}
+
+/*!
+ * \internal
+ *
+ * Sets the directory the program binaries are stored in to \a path. An empty
+ * \a path disables the cache.
+ */
+void ShaderBinaryCache::setCacheDirectory(const QString &path)
+{
+    m_cacheDirectory = path;
+}
+
+/*!
+ * \internal
+ *
+ * Sets the \a driverKey identifying the driver the binaries are valid for.
+ */
+void ShaderBinaryCache::setDriverKey(const QByteArray &driverKey)
+{
+    m_driverDirectory = QString::fromLatin1(QCryptographicHash::hash(driverKey, QCryptographicHash::Sha1).toHex());
+    m_session = 0;
+    m_lastUsedSessions.clear();
+    m_usageDirty = false;
+}
+
+QString ShaderBinaryCache::entryPath(ProgramDNA dna) const
+{
+    return m_cacheDirectory + QLatin1Char('/') + m_driverDirectory + QLatin1Char('/')
+            + QString::number(dna, 16) + binaryCacheSuffix;
+}
+
+QString ShaderBinaryCache::usagePath() const
+{
+    return m_cacheDirectory + QLatin1Char('/') + m_driverDirectory + QLatin1Char('/')
+            + binaryCacheUsageFile;
+}
+
+/*!
+ * \internal
+ *
+ * Reads the program binary cached for \a dna into \a binary.
+ *
+ * \return true if a valid entry was found, false otherwise. Invalid entries
+ * are removed from the cache.
+ */
+bool ShaderBinaryCache::load(ProgramDNA dna, Binary *binary) const
+{
+    if (!isEnabled() || m_driverDirectory.isEmpty())
+        return false;
+
+    QFile file(entryPath(dna));
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_9);
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic == binaryCacheMagic && version == binaryCacheVersion) {
+        stream >> binary->sourceHash >> binary->format >> binary->data;
+        if (stream.status() == QDataStream::Ok && !binary->data.isEmpty())
+            return true;
+    }
+
+    file.remove();
+    return false;
+}
+
+/*!
+ * \internal
+ *
+ * Writes \a binary as the cached program binary for \a dna. The entry is
+ * written to a temporary file first so that concurrent readers never see a
+ * partially written entry.
+ *
+ * \return true on success, false otherwise.
+ */
+bool ShaderBinaryCache::store(ProgramDNA dna, const Binary &binary)
+{
+    if (!isEnabled() || m_driverDirectory.isEmpty())
+        return false;
+
+    if (!QDir().mkpath(m_cacheDirectory + QLatin1Char('/') + m_driverDirectory))
+        return false;
+
+    QSaveFile file(entryPath(dna));
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_9);
+    stream << binaryCacheMagic << binaryCacheVersion
+           << binary.sourceHash << binary.format << binary.data;
+    if (stream.status() != QDataStream::Ok || !file.commit())
+        return false;
+
+    markUsed(dna);
+    return true;
+}
+
+/*!
+ * \internal
+ *
+ * Removes the entry cached for \a dna, typically once the driver rejected it.
+ */
+void ShaderBinaryCache::remove(ProgramDNA dna)
+{
+    if (isEnabled() && !m_driverDirectory.isEmpty())
+        QFile::remove(entryPath(dna));
+    if (m_lastUsedSessions.remove(dna) > 0)
+        m_usageDirty = true;
+}
+
+/*!
+ * \internal
+ *
+ * \return the DNAs of the programs that have a binary cached for the current driver.
+ */
+QVector<ProgramDNA> ShaderBinaryCache::cachedPrograms() const
+{
+    QVector<ProgramDNA> programs;
+    if (!isEnabled() || m_driverDirectory.isEmpty())
+        return programs;
+
+    const QDir dir(m_cacheDirectory + QLatin1Char('/') + m_driverDirectory);
+    const QStringList entries = dir.entryList(QStringList() << QStringLiteral("*.bin"), QDir::Files);
+    programs.reserve(entries.size());
+    for (const QString &entry : entries) {
+        bool ok = false;
+        const ProgramDNA dna = entry.leftRef(entry.size() - binaryCacheSuffix.size()).toUInt(&ok, 16);
+        if (ok)
+            programs.push_back(dna);
+    }
+    return programs;
+}
+
+/*!
+ * \internal
+ *
+ * Starts a new session of the application for the current driver. The
+ * entries that none of the last \a maxUnusedSessions sessions used are
+ * removed from the cache, entries without any usage record start aging from
+ * this session on.
+ */
+void ShaderBinaryCache::beginSession(int maxUnusedSessions)
+{
+    m_session = 0;
+    m_lastUsedSessions.clear();
+    m_usageDirty = false;
+    if (!isEnabled() || m_driverDirectory.isEmpty())
+        return;
+
+    QFile file(usagePath());
+    if (file.open(QIODevice::ReadOnly)) {
+        QDataStream stream(&file);
+        stream.setVersion(QDataStream::Qt_5_9);
+        quint32 magic = 0;
+        quint32 version = 0;
+        stream >> magic >> version;
+        if (magic == binaryCacheUsageMagic && version == binaryCacheVersion) {
+            stream >> m_session >> m_lastUsedSessions;
+            if (stream.status() != QDataStream::Ok) {
+                m_session = 0;
+                m_lastUsedSessions.clear();
+            }
+        }
+    }
+    ++m_session;
+
+    const QVector<ProgramDNA> programs = cachedPrograms();
+    QHash<ProgramDNA, quint32> lastUsedSessions;
+    lastUsedSessions.reserve(programs.size());
+    for (const ProgramDNA dna : programs) {
+        const quint32 lastUsedSession = m_lastUsedSessions.value(dna, m_session);
+        if (m_session - lastUsedSession > quint32(maxUnusedSessions))
+            QFile::remove(entryPath(dna));
+        else
+            lastUsedSessions.insert(dna, lastUsedSession);
+    }
+    m_lastUsedSessions = lastUsedSessions;
+    m_usageDirty = true;
+    saveUsage();
+}
+
+/*!
+ * \internal
+ *
+ * Records that the current session uses the program cached for \a dna.
+ */
+void ShaderBinaryCache::markUsed(ProgramDNA dna)
+{
+    if (!isEnabled() || m_driverDirectory.isEmpty())
+        return;
+
+    auto it = m_lastUsedSessions.find(dna);
+    if (it == m_lastUsedSessions.end()) {
+        m_lastUsedSessions.insert(dna, m_session);
+        m_usageDirty = true;
+    } else if (it.value() != m_session) {
+        it.value() = m_session;
+        m_usageDirty = true;
+    }
+}
+
+/*!
+ * \internal
+ *
+ * Writes the usage records if they changed since they were last written.
+ *
+ * \return true if the records on disk are up to date, false otherwise.
+ */
+bool ShaderBinaryCache::saveUsage()
+{
+    if (!m_usageDirty)
+        return true;
+    if (!isEnabled() || m_driverDirectory.isEmpty())
+        return false;
+
+    if (!QDir().mkpath(m_cacheDirectory + QLatin1Char('/') + m_driverDirectory))
+        return false;
+
+    QSaveFile file(usagePath());
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_9);
+    stream << binaryCacheUsageMagic << binaryCacheVersion
+           << m_session << m_lastUsedSessions;
+    if (stream.status() != QDataStream::Ok || !file.commit())
+        return false;
+
+    m_usageDirty = false;
+    return true;
+}
+
+/*!
+ * \internal
+ *
+ * \return the DNAs of the cached programs the previous session used, sorted.
+ */
+QVector<ProgramDNA> ShaderBinaryCache::recentlyUsedPrograms() const
+{
+    QVector<ProgramDNA> programs;
+    for (auto it = m_lastUsedSessions.cbegin(), end = m_lastUsedSessions.cend(); it != end; ++it) {
+        if (it.value() + 1 == m_session)
+            programs.push_back(it.key());
+    }
+    std::sort(programs.begin(), programs.end());
+    return programs;
+}
+
+/*!
+ * \internal
+ *
+ * \return a hash identifying the sources and fragment outputs a program is built from.
+ */
+QByteArray ShaderBinaryCache::sourceHash(const QVector<QByteArray> &shaderCode, const QHash<QString, int> &fragOutputs)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    for (int i = 0; i < shaderCode.size(); ++i) {
+        const QByteArray &code = shaderCode.at(i);
+        const quint32 header[2] = { quint32(i), quint32(code.size()) };
+        hash.addData(reinterpret_cast<const char *>(header), sizeof(header));
+        hash.addData(code);
+    }
+
+    // QHash iteration order isn't stable, sort the outputs
+    QStringList outputNames = fragOutputs.keys();
+    outputNames.sort();
+    for (const QString &name : qAsConst(outputNames)) {
+        hash.addData(name.toUtf8());
+        const qint32 location = fragOutputs.value(name);
+        hash.addData(reinterpret_cast<const char *>(&location), sizeof(location));
+    }
+    return hash.result();
+}
+
+/*!
+ * \internal
+ *
+ * \return the directory used by the renderer to cache program binaries.
+ *
+ * It can be overridden with the QT3D_SHADER_CACHE_DIR environment variable,
+ * setting QT3D_DISABLE_SHADER_CACHE disables the cache.
+ */
+QString ShaderBinaryCache::defaultCacheDirectory()
+{
+    if (qEnvironmentVariableIsSet("QT3D_DISABLE_SHADER_CACHE"))
+        return QString();
+    if (qEnvironmentVariableIsSet("QT3D_SHADER_CACHE_DIR"))
+        return QFile::decodeName(qgetenv("QT3D_SHADER_CACHE_DIR"));
+    const QString cacheLocation = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (cacheLocation.isEmpty())
+        return QString();
+    return cacheLocation + QLatin1String("/qt3d/shaders");
+}
+
+} // namespace Render
+} // namespace Qt3DRender
+
+QT_END_NAMESPACE
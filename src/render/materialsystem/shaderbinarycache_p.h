@@ -0,0 +1,133 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QT3DRENDER_RENDER_SHADERBINARYCACHE_P_H
+#define QT3DRENDER_RENDER_SHADERBINARYCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <Qt3DRender/private/qt3drender_global_p.h>
+#include <Qt3DRender/private/shader_p.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+namespace Render {
+
+// Stores linked shader program binaries on disk so that subsequent runs can
+// skip compiling and linking the programs. Binaries are only valid for the
+// driver that produced them, each driver therefore gets its own directory
+// and entries are keyed by ProgramDNA within it. The hash of the sources is
+// stored along with each binary to detect DNA collisions. The session of the
+// application each entry was last used by is recorded as well, so that
+// entries no longer in use can be evicted.
+class QT3DRENDERSHARED_PRIVATE_EXPORT ShaderBinaryCache
+{
+public:
+    struct Binary
+    {
+        Binary() : format(0) {}
+
+        QByteArray sourceHash;
+        uint format;
+        QByteArray data;
+    };
+
+    ShaderBinaryCache();
+
+    // The cache is disabled when the directory is empty
+    void setCacheDirectory(const QString &path);
+    QString cacheDirectory() const { return m_cacheDirectory; }
+    bool isEnabled() const { return !m_cacheDirectory.isEmpty(); }
+
+    // Identifies the driver the binaries are produced with, typically
+    // made of the GL_VENDOR, GL_RENDERER and GL_VERSION strings
+    void setDriverKey(const QByteArray &driverKey);
+
+    bool load(ProgramDNA dna, Binary *binary) const;
+    bool store(ProgramDNA dna, const Binary &binary);
+    void remove(ProgramDNA dna);
+
+    // DNAs of all the programs cached for the current driver
+    QVector<ProgramDNA> cachedPrograms() const;
+
+    // Starts a new session, removing the entries not used by any of the
+    // last maxUnusedSessions sessions
+    void beginSession(int maxUnusedSessions);
+    void markUsed(ProgramDNA dna);
+    bool saveUsage();
+    quint32 session() const { return m_session; }
+
+    // DNAs of the cached programs used by the previous session, the ones
+    // most likely to be needed again
+    QVector<ProgramDNA> recentlyUsedPrograms() const;
+
+    static QByteArray sourceHash(const QVector<QByteArray> &shaderCode, const QHash<QString, int> &fragOutputs);
+    static QString defaultCacheDirectory();
+
+private:
+    QString entryPath(ProgramDNA dna) const;
+    QString usagePath() const;
+
+    QString m_cacheDirectory;
+    QString m_driverDirectory;
+    quint32 m_session;
+    QHash<ProgramDNA, quint32> m_lastUsedSessions;
+    bool m_usageDirty;
+};
+
+} // namespace Render
+} // namespace Qt3DRender
+
+QT_END_NAMESPACE
+
+#endif // QT3DRENDER_RENDER_SHADERBINARYCACHE_P_H
@@ -138,7 +138,7 @@ void Technique::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
     default:
         break;
     }
-    markDirty(AbstractRenderer::AllDirty);
+    markDirty(AbstractRenderer::MaterialDirty);
     BackendNode::sceneChangeEvent(e);
 }
 
@@ -85,6 +85,7 @@ public:
         qDeleteAll(activeResources());
         m_nodeIdToGLTexture.clear();
         m_sharedTextures.clear();
+        m_sharedTexturesIndex.clear();
         m_updatedTextures.clear();
     }
 
@@ -126,6 +127,8 @@ public:
     // Store that the shared texture references node
     void adoptShared(APITexture *sharedApiTexture, const Texture *node)
     {
+        if (!m_sharedTextures.contains(sharedApiTexture))
+            m_sharedTexturesIndex.insert(sharingKey(sharedApiTexture), sharedApiTexture);
         if (!m_sharedTextures[sharedApiTexture].contains(node->peerId())) {
             m_sharedTextures[sharedApiTexture].push_back(node->peerId());
             m_nodeIdToGLTexture.insert(node->peerId(), sharedApiTexture);
@@ -140,11 +143,13 @@ public:
     {
         Q_ASSERT(node);
 
-        // search for existing texture
-        const auto end = m_sharedTextures.end();
-        for (auto it = m_sharedTextures.begin(); it != end; ++it)
-            if (isSameTexture(it.key(), node))
-                return it.key();
+        // search for existing texture, only comparing against the
+        // textures built from the same generators
+        const uint key = sharingKey(node->dataGenerator(), texImgsFromNodes(node->textureImages()));
+        const auto end = m_sharedTexturesIndex.cend();
+        for (auto it = m_sharedTexturesIndex.constFind(key); it != end && it.key() == key; ++it)
+            if (isSameTexture(it.value(), node))
+                return it.value();
         return nullptr;
     }
 
@@ -182,6 +187,7 @@ public:
             if (referencedTextureNodes.empty()) {
                 m_abandonedTextures.push_back(apiTexture);
                 m_sharedTextures.remove(apiTexture);
+                m_sharedTexturesIndex.remove(sharingKey(apiTexture), apiTexture);
                 tex->destroyResources();
             }
         }
@@ -231,7 +237,10 @@ public:
         if (texImgs.size() != images.size())
             return false;
 
+        const bool indexed = m_sharedTexturesIndex.remove(sharingKey(tex), tex) > 0;
         tex->setImages(texImgs);
+        if (indexed)
+            m_sharedTexturesIndex.insert(sharingKey(tex), tex);
         m_updatedTextures.push_back(tex);
 
         return true;
@@ -246,7 +255,10 @@ public:
         if (isShared(tex))
             return false;
 
+        const bool indexed = m_sharedTexturesIndex.remove(sharingKey(tex), tex) > 0;
         tex->setGenerator(generator);
+        if (indexed)
+            m_sharedTexturesIndex.insert(sharingKey(tex), tex);
         m_updatedTextures.push_back(tex);
 
         return true;
@@ -282,6 +294,21 @@ public:
 
 private:
 
+    // Hash of the generators a texture is built from. Textures that could be
+    // shared always have the same key.
+    static uint sharingKey(const QTextureGeneratorPtr &generator, const QVector<APITextureImage> &images)
+    {
+        uint key = generator.isNull() ? 0 : generatorHash(*generator);
+        for (const APITextureImage &image : images)
+            key = 31 * key + (image.generator.isNull() ? 0 : generatorHash(*image.generator));
+        return key;
+    }
+
+    static uint sharingKey(const APITexture *tex)
+    {
+        return sharingKey(tex->textureGenerator(), tex->images());
+    }
+
     // Check if the given APITexture matches the TextureNode
     bool isSameTexture(const APITexture *tex, const Texture *texNode)
     {
@@ -372,6 +399,8 @@ private:
 
     /* each non-unique texture is associated with a number of Texture nodes referencing it */
     QHash<APITexture*, QVector<Qt3DCore::QNodeId>> m_sharedTextures;
+    // sharing key -> shared APITextures, to avoid comparing against every shared texture
+    QMultiHash<uint, APITexture*> m_sharedTexturesIndex;
 
     // Texture id -> APITexture (both shared and unique ones)
     QHash<Qt3DCore::QNodeId, APITexture *> m_nodeIdToGLTexture;
@@ -50,6 +50,7 @@
 #include <Qt3DRender/private/managers_p.h>
 #include <Qt3DRender/private/texturedatamanager_p.h>
 #include <Qt3DRender/private/qabstracttexture_p.h>
+#include <Qt3DRender/private/qtextureimagedata_p.h>
 #include <Qt3DCore/qpropertyupdatedchange.h>
 #include <Qt3DCore/qpropertynodeaddedchange.h>
 #include <Qt3DCore/qpropertynoderemovedchange.h>
@@ -70,6 +71,11 @@ GLTexture::GLTexture(TextureDataManager *texDataMgr,
     , m_textureDataManager(texDataMgr)
     , m_textureImageDataManager(texImgDataMgr)
     , m_dataFunctor(texGen)
+    , m_textureDataReleased(false)
+    , m_imageDataReleased(false)
+    , m_uploadedSourceDataSize(0)
+    , m_nextMipLevel(-1)
+    , m_lastUsedFrame(-1)
 {
     // make sure texture generator is executed
     // this is needed when Texture have the TargetAutomatic
@@ -91,6 +97,11 @@ void GLTexture::destroyResources()
 
     if (m_dataFunctor)
         m_textureDataManager->releaseData(m_dataFunctor, this);
+
+    m_textureData.reset();
+    m_imageData.clear();
+    m_textureDataReleased = false;
+    m_imageDataReleased = false;
 }
 
 void GLTexture::destroyGLTexture()
@@ -103,16 +114,35 @@ void GLTexture::destroyGLTexture()
     destroyResources();
 }
 
+void GLTexture::evictGLTexture()
+{
+    // render plugins hold the texture lock while using the GL texture
+    QMutexLocker locker(&m_dirtyFlagMutex);
+    delete m_gl;
+    m_gl = nullptr;
+    m_nextMipLevel = -1;
+
+    // the data is uploaded again, smallest mip levels first, when the
+    // texture is recreated. Released data gets reloaded at that point.
+    m_dirty |= TextureData|Parameters;
+}
+
 QOpenGLTexture* GLTexture::getOrCreateGLTexture()
 {
     QMutexLocker locker(&m_dirtyFlagMutex);
     bool needUpload = false;
     bool texturedDataInvalid = false;
 
+    // the GL texture is going to be (re)created but the CPU side data
+    // was released after the previous upload, get it back
+    if ((m_textureDataReleased || m_imageDataReleased)
+            && (m_gl == nullptr || m_dirty.testFlag(Properties)))
+        reloadReleasedData();
+
     // on the first invocation in the render thread, make sure to
     // evaluate the texture data generator output
     // (this might change some property values)
-    if (m_dataFunctor && !m_textureData) {
+    if (m_dataFunctor && !m_textureData && !m_textureDataReleased) {
         m_textureData = m_textureDataManager->getData(m_dataFunctor);
 
         // if there is a texture generator, most properties will be defined by it
@@ -146,6 +176,7 @@ QOpenGLTexture* GLTexture::getOrCreateGLTexture()
     // additional texture images may be defined through image data generators
     if (m_dirty.testFlag(TextureData)) {
         m_imageData.clear();
+        m_imageDataReleased = false;
         needUpload = true;
 
         for (const Image &img : qAsConst(m_images)) {
@@ -190,6 +221,7 @@ QOpenGLTexture* GLTexture::getOrCreateGLTexture()
         m_gl = buildGLTexture();
         if (!m_gl)
             return nullptr;
+        m_nextMipLevel = -1;
         m_gl->allocateStorage();
         if (!m_gl->isStorageAllocated()) {
             qWarning() << Q_FUNC_INFO << "texture storage allocation failed";
@@ -198,8 +230,11 @@ QOpenGLTexture* GLTexture::getOrCreateGLTexture()
     }
 
     // need to (re-)upload texture data?
+    bool uploadComplete = true;
     if (needUpload && !texturedDataInvalid) {
-        uploadGLTextureData();
+        uploadComplete = uploadGLTextureData();
+        if (uploadComplete)
+            releaseUploadedData();
     }
 
     // need to set texture parameters?
@@ -207,7 +242,8 @@ QOpenGLTexture* GLTexture::getOrCreateGLTexture()
         updateGLTextureParameters();
     }
 
-    m_dirty = 0;
+    // keep uploading the remaining mip levels next time
+    m_dirty = uploadComplete ? DirtyFlags() : DirtyFlags(TextureData);
 
     return m_gl;
 }
@@ -288,6 +324,7 @@ void GLTexture::setGenerator(const QTextureGeneratorPtr &generator)
             m_textureDataManager->releaseData(m_dataFunctor, this);
 
         m_textureData.reset();
+        m_textureDataReleased = false;
         m_dataFunctor = generator;
 
         if (m_dataFunctor) {
@@ -391,12 +428,48 @@ static void uploadGLData(QOpenGLTexture *glTex,
     }
 }
 
-void GLTexture::uploadGLTextureData()
+// Uploads the mip levels of data from the smallest to the largest one, until
+// the upload budget is exhausted. The texture only samples the uploaded levels
+// so that it shows up quickly and reaches its full resolution over a few frames.
+// Returns true once all the levels are uploaded.
+bool GLTexture::uploadMipLevelsProgressively(const QTextureImageDataPtr &data)
+{
+    // Upload at least one level per call, and keep going while below this many bytes
+    const int uploadBudget = 4 * 1024 * 1024;
+
+    if (m_nextMipLevel < 0)
+        m_nextMipLevel = data->mipLevels() - 1;
+
+    int uploadedBytes = 0;
+    while (m_nextMipLevel >= 0 && uploadedBytes < uploadBudget) {
+        const int level = m_nextMipLevel--;
+        for (int layer = 0; layer < data->layers(); layer++) {
+            for (int face = 0; face < data->faces(); face++) {
+                const QByteArray bytes(data->data(layer, face, level));
+                uploadGLData(m_gl, level, layer,
+                             static_cast<QOpenGLTexture::CubeMapFace>(QOpenGLTexture::CubeMapPositiveX + face),
+                             bytes, data);
+                uploadedBytes += bytes.size();
+            }
+        }
+        m_gl->setMipBaseLevel(level);
+    }
+
+    return m_nextMipLevel < 0;
+}
+
+bool GLTexture::uploadGLTextureData()
 {
     // Upload all QTexImageData set by the QTextureGenerator
     if (m_textureData) {
         const QVector<QTextureImageDataPtr> imgData = m_textureData->imageData();
 
+        // Large textures coming with their own mip levels are uploaded progressively
+        if (imgData.size() == 1 && m_images.empty()
+                && !m_properties.generateMipMaps && imgData.first()->mipLevels() > 1
+                && m_gl->hasFeature(QOpenGLTexture::TextureMipMapLevel))
+            return uploadMipLevelsProgressively(imgData.first());
+
         for (const QTextureImageDataPtr &data : imgData) {
             const int mipLevels = m_properties.generateMipMaps ? 1 : data->mipLevels();
 
@@ -415,7 +488,8 @@ void GLTexture::uploadGLTextureData()
     }
 
     // Upload all QTexImageData references by the TextureImages
-    for (int i = 0; i < m_images.size(); i++) {
+    // (unless they were already uploaded and released)
+    for (int i = 0; i < m_imageData.size(); i++) {
         const QTextureImageDataPtr &imgData = m_imageData.at(i);
 
         // ensure we don't accidentally cause a detach / copy of the raw bytes
@@ -424,6 +498,66 @@ void GLTexture::uploadGLTextureData()
                      static_cast<QOpenGLTexture::CubeMapFace>(m_images[i].face),
                      bytes, imgData);
     }
+
+    return true;
+}
+
+// Drop our references to the uploaded data so that the data managers can
+// evict the CPU copies once every texture sharing them has uploaded them
+void GLTexture::releaseUploadedData()
+{
+    m_uploadedSourceDataSize = residentDataSize();
+
+    if (m_textureData) {
+        m_textureDataManager->dataUploaded(m_dataFunctor, this);
+        if (m_textureDataManager->evictsUploadedData()) {
+            m_textureData.reset();
+            m_textureDataReleased = true;
+        }
+    }
+
+    if (!m_imageData.empty()) {
+        for (const Image &img : qAsConst(m_images))
+            m_textureImageDataManager->dataUploaded(img.generator, this);
+        if (m_textureImageDataManager->evictsUploadedData()) {
+            m_imageData.clear();
+            m_imageDataReleased = true;
+        }
+    }
+}
+
+// Executes the generators of the released data again. The texture stays
+// invalid until the data has been regenerated.
+void GLTexture::reloadReleasedData()
+{
+    if (m_textureDataReleased) {
+        m_textureDataManager->reloadData(m_dataFunctor, this);
+        m_textureDataReleased = false;
+    }
+
+    if (m_imageDataReleased) {
+        for (const Image &img : qAsConst(m_images))
+            m_textureImageDataManager->reloadData(img.generator, this);
+        m_dirty |= TextureData;
+    }
+}
+
+static qint64 imageDataSize(const QTextureImageDataPtr &data)
+{
+    return data ? QTextureImageDataPrivate::get(data.data())->m_data.size() : 0;
+}
+
+qint64 GLTexture::residentDataSize() const
+{
+    qint64 size = 0;
+    if (m_textureData) {
+        const QVector<QTextureImageDataPtr> imgData = m_textureData->imageData();
+        for (const QTextureImageDataPtr &data : imgData)
+            size += imageDataSize(data);
+    }
+    for (const QTextureImageDataPtr &data : m_imageData)
+        size += imageDataSize(data);
+    return size;
 }
 
 void GLTexture::updateGLTextureParameters()
@@ -60,6 +60,7 @@
 #include <QOpenGLContext>
 #include <QFlags>
 #include <QMutex>
+#include <QAtomicInteger>
 #include <QSize>
 
 QT_BEGIN_NAMESPACE
@@ -123,6 +124,19 @@ public:
     inline QSize size() const { return QSize(m_properties.width, m_properties.height); }
     inline QOpenGLTexture *getGLTexture() const { return m_gl; }
 
+    // Bytes of source texture data sent to the GPU by the last upload. This
+    // isn't the GPU memory used by the texture, which also depends on the
+    // internal format, the driver and the generated mip levels.
+    inline qint64 uploadedSourceDataSize() const { return m_uploadedSourceDataSize; }
+    // Bytes of texture data currently held on the CPU side by this texture
+    qint64 residentDataSize() const;
+
+    // Whether the GL texture currently exists on the GPU
+    inline bool isResident() const { return m_gl != nullptr; }
+    // Also updated from the threads of render plugins accessing the texture
+    inline qint64 lastUsedFrame() const { return m_lastUsedFrame.load(); }
+    inline void setLastUsedFrame(qint64 frame) { m_lastUsedFrame.store(frame); }
+
     /**
      * @brief
      *   Returns the QOpenGLTexture for this GLTexture. If necessary,
@@ -140,6 +154,13 @@ public:
      */
     void destroyGLTexture();
 
+    /**
+     * @brief
+     *   Releases the GL texture to free GPU memory. It is created and
+     *   uploaded again the next time the texture is used.
+     */
+    void evictGLTexture();
+
     // Called by TextureDataManager when it has new texture data from
     // a generator that needs to be uploaded.
     void requestUpload()
@@ -187,7 +208,10 @@ private:
     Q_DECLARE_FLAGS(DirtyFlags, DirtyFlag)
 
     QOpenGLTexture *buildGLTexture();
-    void uploadGLTextureData();
+    bool uploadGLTextureData();
+    bool uploadMipLevelsProgressively(const QTextureImageDataPtr &data);
+    void releaseUploadedData();
+    void reloadReleasedData();
     void updateGLTextureParameters();
     void destroyResources();
 
@@ -210,6 +234,14 @@ private:
     // cache actual image data generated by the functors
     QTextureDataPtr m_textureData;
     QVector<QTextureImageDataPtr> m_imageData;
+
+    // whether the data above was dropped after being uploaded
+    bool m_textureDataReleased;
+    bool m_imageDataReleased;
+    qint64 m_uploadedSourceDataSize;
+    // next mip level to upload progressively, -1 if none
+    int m_nextMipLevel;
+    QAtomicInteger<qint64> m_lastUsedFrame;
 };
 
 } // namespace Render
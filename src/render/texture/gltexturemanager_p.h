@@ -53,6 +53,7 @@
 
 #include <Qt3DRender/private/apitexturemanager_p.h>
 #include <Qt3DRender/private/gltexture_p.h>
+#include <Qt3DRender/private/textureresidencypolicy_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -68,7 +69,32 @@ public:
         : APITextureManager<GLTexture, GLTexture::Image>(textureImageManager,
                                                          textureDataManager,
                                                          textureImageDataManager)
+        , m_currentFrame(0)
     {}
+
+    // Frame being rendered, textures accessed by render plugins from other
+    // threads are marked as used by it
+    void setCurrentFrame(qint64 frame) { m_currentFrame.store(frame); }
+    qint64 currentFrame() const { return m_currentFrame.load(); }
+
+    // Texture memory budget in bytes, 0 when there is no budget
+    void setTextureMemoryBudget(qint64 budget) { m_residencyPolicy.setBudget(budget); }
+    qint64 textureMemoryBudget() const { return m_residencyPolicy.budget(); }
+
+    // Returns the textures that should be evicted from the GPU to get back
+    // within the texture memory budget, none when there is no budget. The
+    // residency statistics are updated either way.
+    QVector<GLTexture *> takeTexturesToEvict(qint64 currentFrame)
+    {
+        return m_residencyPolicy.selectTexturesToEvict(activeResources(), currentFrame);
+    }
+
+    // Also reported by the "texturememory" debugging command
+    TextureResidencyStatistics residencyStatistics() const { return m_residencyPolicy.statistics(); }
+
+private:
+    TextureResidencyPolicy<GLTexture> m_residencyPolicy;
+    QAtomicInteger<qint64> m_currentFrame;
 };
 
 } // namespace Render
@@ -43,6 +43,7 @@
 #include "qtexturedata.h"
 #include "qtexture.h"
 #include "qtexture_p.h"
+#include "qtextureimagedata_p.h"
 #include <QFileInfo>
 #include <qendian.h>
 
@@ -421,7 +422,9 @@ const struct DX10Format
 enum CompressedFormatExtension {
     None = 0,
     DDS,
-    PKM
+    PKM,
+    KTX,
+    KTX2
 };
 
 CompressedFormatExtension texturedCompressedFormat(const QString &source)
@@ -431,6 +434,10 @@ CompressedFormatExtension texturedCompressedFormat(const QString &source)
         return PKM;
     if (suffix == QStringLiteral("dds"))
         return DDS;
+    if (suffix == QStringLiteral("ktx"))
+        return KTX;
+    if (suffix == QStringLiteral("ktx2"))
+        return KTX2;
     return None;
 }
 
@@ -615,6 +622,447 @@ QTextureImageDataPtr setDdsFile(const QString &source)
     return imageData;
 }
 
+struct KtxHeader
+{
+    char identifier[12];
+    quint32 endianness;
+    quint32 glType;
+    quint32 glTypeSize;
+    quint32 glFormat;
+    quint32 glInternalFormat;
+    quint32 glBaseInternalFormat;
+    quint32 pixelWidth;
+    quint32 pixelHeight;
+    quint32 pixelDepth;
+    quint32 numberOfArrayElements;
+    quint32 numberOfFaces;
+    quint32 numberOfMipmapLevels;
+    quint32 bytesOfKeyValueData;
+};
+
+struct Ktx2Header
+{
+    char identifier[12];
+    quint32 vkFormat;
+    quint32 typeSize;
+    quint32 pixelWidth;
+    quint32 pixelHeight;
+    quint32 pixelDepth;
+    quint32 layerCount;
+    quint32 faceCount;
+    quint32 levelCount;
+    quint32 supercompressionScheme;
+    quint32 dfdByteOffset;
+    quint32 dfdByteLength;
+    quint32 kvdByteOffset;
+    quint32 kvdByteLength;
+    quint64 sgdByteOffset;
+    quint64 sgdByteLength;
+};
+
+struct Ktx2LevelIndex
+{
+    quint64 byteOffset;
+    quint64 byteLength;
+    quint64 uncompressedByteLength;
+};
+
+static const char ktxIdentifier[] = { '\xAB', 'K', 'T', 'X', ' ', '1', '1', '\xBB', '\r', '\n', '\x1A', '\n' };
+static const char ktx2Identifier[] = { '\xAB', 'K', 'T', 'X', ' ', '2', '0', '\xBB', '\r', '\n', '\x1A', '\n' };
+
+// Bytes per block of the compressed GL internal formats we know of
+int compressedBlockSize(QOpenGLTexture::TextureFormat format)
+{
+    switch (format) {
+    case QOpenGLTexture::RGB_DXT1:
+    case QOpenGLTexture::RGBA_DXT1:
+    case QOpenGLTexture::SRGB_DXT1:
+    case QOpenGLTexture::SRGB_Alpha_DXT1:
+    case QOpenGLTexture::R_ATI1N_UNorm:
+    case QOpenGLTexture::R_ATI1N_SNorm:
+    case QOpenGLTexture::R11_EAC_UNorm:
+    case QOpenGLTexture::R11_EAC_SNorm:
+    case QOpenGLTexture::RGB8_ETC1:
+    case QOpenGLTexture::RGB8_ETC2:
+    case QOpenGLTexture::SRGB8_ETC2:
+    case QOpenGLTexture::RGB8_PunchThrough_Alpha1_ETC2:
+    case QOpenGLTexture::SRGB8_PunchThrough_Alpha1_ETC2:
+        return 8;
+    default:
+        return 16;
+    }
+}
+
+// Bytes per pixel of uncompressed KTX data
+int uncompressedPixelSize(quint32 glFormat, quint32 glType, quint32 glTypeSize)
+{
+    switch (glType) {
+    case 0x8033: // GL_UNSIGNED_SHORT_4_4_4_4
+    case 0x8034: // GL_UNSIGNED_SHORT_5_5_5_1
+    case 0x8363: // GL_UNSIGNED_SHORT_5_6_5
+    case 0x8368: // GL_UNSIGNED_INT_2_10_10_10_REV
+    case 0x8C3B: // GL_UNSIGNED_INT_10F_11F_11F_REV
+    case 0x8C3E: // GL_UNSIGNED_INT_5_9_9_9_REV
+    case 0x84FA: // GL_UNSIGNED_INT_24_8
+        return int(glTypeSize);
+    default:
+        break;
+    }
+
+    int components = 1;
+    switch (glFormat) {
+    case QOpenGLTexture::RG:
+    case QOpenGLTexture::RG_Integer:
+    case QOpenGLTexture::LuminanceAlpha:
+        components = 2;
+        break;
+    case QOpenGLTexture::RGB:
+    case QOpenGLTexture::BGR:
+    case QOpenGLTexture::RGB_Integer:
+    case QOpenGLTexture::BGR_Integer:
+        components = 3;
+        break;
+    case QOpenGLTexture::RGBA:
+    case QOpenGLTexture::BGRA:
+    case QOpenGLTexture::RGBA_Integer:
+    case QOpenGLTexture::BGRA_Integer:
+        components = 4;
+        break;
+    default:
+        break;
+    }
+    return components * int(glTypeSize);
+}
+
+// Header values above these limits are treated as malformed instead of
+// being trusted for allocations and offsets
+const int maxKtxDimension = 1 << 16;
+const int maxKtxLayers = 2048;
+
+bool isValidKtxExtent(quint32 width, quint32 height, quint32 depth)
+{
+    return width > 0 && width <= quint32(maxKtxDimension)
+            && height <= quint32(maxKtxDimension)
+            && depth <= quint32(maxKtxDimension);
+}
+
+// Number of mip levels of a full chain for the given size
+int fullMipLevelCount(int width, int height, int depth)
+{
+    int levelCount = 1;
+    for (int size = qMax(width, qMax(height, depth)); size > 1; size >>= 1)
+        ++levelCount;
+    return levelCount;
+}
+
+// Bytes of tightly packed data for one layer and face of a w x h x d mip level
+qint64 minimumSliceSize(int w, int h, int d, int blockSize, bool isCompressed)
+{
+    if (isCompressed)
+        return qint64((w + 3) / 4) * ((h + 3) / 4) * d * blockSize;
+    return qint64(w) * blockSize * h * d;
+}
+
+// Maps the file and returns the mapped bytes without copying them. Falls back
+// to reading the file if it can't be mapped (e.g. compressed resources).
+QByteArray mapTextureFile(const QSharedPointer<QFile> &file, bool *mapped)
+{
+    uchar *fileData = file->map(0, file->size());
+    *mapped = (fileData != nullptr);
+    if (fileData != nullptr)
+        return QByteArray::fromRawData(reinterpret_cast<const char *>(fileData), int(file->size()));
+    return file->readAll();
+}
+
+QTextureImageDataPtr setKtxFile(const QString &source)
+{
+    QTextureImageDataPtr imageData;
+    QSharedPointer<QFile> file = QSharedPointer<QFile>::create(source);
+    if (!file->open(QIODevice::ReadOnly)) {
+        qWarning() << "Failed to open" << source;
+        return imageData;
+    }
+
+    bool mapped = false;
+    const QByteArray fileData = mapTextureFile(file, &mapped);
+    KtxHeader header;
+    if (fileData.size() < int(sizeof header)
+            || memcmp(fileData.constData(), ktxIdentifier, sizeof ktxIdentifier) != 0)
+        return imageData;
+    memcpy(&header, fileData.constData(), sizeof header);
+
+    // The writer stores 0x04030201 in its own endianness
+    const bool swap = (header.endianness == 0x01020304);
+    auto value = [swap] (quint32 v) { return swap ? qbswap(v) : v; };
+
+    if (!isValidKtxExtent(value(header.pixelWidth), value(header.pixelHeight), value(header.pixelDepth))
+            || value(header.glTypeSize) > 8
+            || value(header.numberOfArrayElements) > quint32(maxKtxLayers)
+            || (value(header.numberOfFaces) != 1 && value(header.numberOfFaces) != 6)) {
+        qWarning() << "Invalid KTX header in" << source;
+        return imageData;
+    }
+
+    const quint32 glType = value(header.glType);
+    const quint32 glTypeSize = value(header.glTypeSize);
+    const quint32 glFormat = value(header.glFormat);
+    const int width = int(value(header.pixelWidth));
+    const int height = qMax(int(value(header.pixelHeight)), 1);
+    const int depth = qMax(int(value(header.pixelDepth)), 1);
+    const int arrayElements = int(value(header.numberOfArrayElements));
+    const int layers = qMax(arrayElements, 1);
+    const int faces = int(value(header.numberOfFaces));
+    const int mipLevelCount = qBound(1, int(qMin(value(header.numberOfMipmapLevels), quint32(maxKtxDimension))),
+                                     fullMipLevelCount(width, height, depth));
+    const bool isCompressed = (glType == 0);
+    const QOpenGLTexture::TextureFormat format = static_cast<QOpenGLTexture::TextureFormat>(value(header.glInternalFormat));
+    const int blockSize = isCompressed ? compressedBlockSize(format) : uncompressedPixelSize(glFormat, glType, glTypeSize);
+
+    if (swap && glTypeSize > 1) {
+        qWarning() << "Byte swapping KTX data isn't supported" << source;
+        return imageData;
+    }
+    if (blockSize <= 0 || blockSize > 16) {
+        qWarning() << "Unrecognized pixel format in" << source;
+        return imageData;
+    }
+
+    QOpenGLTexture::Target target;
+    if (depth > 1)
+        target = QOpenGLTexture::Target3D;
+    else if (faces == 6)
+        target = arrayElements > 0 ? QOpenGLTexture::TargetCubeMapArray : QOpenGLTexture::TargetCubeMap;
+    else if (value(header.pixelHeight) == 0)
+        target = arrayElements > 0 ? QOpenGLTexture::Target1DArray : QOpenGLTexture::Target1D;
+    else
+        target = arrayElements > 0 ? QOpenGLTexture::Target2DArray : QOpenGLTexture::Target2D;
+
+    // Uncompressed rows are padded to 4 bytes in KTX files while we upload with an
+    // alignment of 1, such data has to be repacked instead of being referenced
+    const bool rowsPadded = !isCompressed && ((width * blockSize) % 4) != 0;
+    QByteArray repacked;
+
+    // KTX stores all layers and faces of a mip level together, while
+    // QTextureImageData addresses them by layer, face and then level
+    QVector<QTextureImageDataPrivate::Slice> slices(layers * faces * mipLevelCount);
+    const qint64 fileSize = fileData.size();
+    qint64 offset = qint64(sizeof header) + value(header.bytesOfKeyValueData);
+    for (int level = 0; level < mipLevelCount; ++level) {
+        if (offset + 4 > fileSize) {
+            qWarning() << "Unexpected end of data in" << source;
+            return imageData;
+        }
+        const quint32 imageSize = value(qFromUnaligned<quint32>(fileData.constData() + offset));
+        offset += 4;
+
+        // non-array cubemaps store the size of one face, with each face 4 bytes aligned
+        const bool perFaceSize = (faces == 6 && arrayElements == 0);
+        const qint64 sliceSize = perFaceSize ? qint64(imageSize) : qint64(imageSize) / (layers * faces);
+        const qint64 sliceStride = perFaceSize ? (sliceSize + 3) & ~3 : sliceSize;
+
+        const int w = qMax(width >> level, 1);
+        const int h = qMax(height >> level, 1);
+        const int d = qMax(depth >> level, 1);
+        const qint64 rowSize = qint64(w) * blockSize;
+        const qint64 paddedRowSize = (rowSize + 3) & ~3;
+        const qint64 requiredSliceSize = rowsPadded ? paddedRowSize * h * d
+                                                    : minimumSliceSize(w, h, d, blockSize, isCompressed);
+        if (sliceSize < requiredSliceSize) {
+            qWarning() << "Invalid image size in" << source;
+            return imageData;
+        }
+        if (offset + layers * faces * sliceStride > fileSize) {
+            qWarning() << "Unexpected end of data in" << source;
+            return imageData;
+        }
+
+        for (int layer = 0; layer < layers; ++layer) {
+            for (int face = 0; face < faces; ++face) {
+                const qint64 sliceOffset = offset + (layer * faces + face) * sliceStride;
+                QTextureImageDataPrivate::Slice &slice = slices[(layer * faces + face) * mipLevelCount + level];
+                if (rowsPadded) {
+                    slice.offset = repacked.size();
+                    slice.size = int(rowSize * h * d);
+                    for (int row = 0; row < h * d; ++row)
+                        repacked.append(fileData.constData() + sliceOffset + row * paddedRowSize, int(rowSize));
+                } else {
+                    slice.offset = int(sliceOffset);
+                    slice.size = int(sliceSize);
+                }
+            }
+        }
+        offset += (layers * faces * sliceStride + 3) & ~3;
+    }
+
+    imageData = QTextureImageDataPtr::create();
+    QTextureImageDataPrivate *d = QTextureImageDataPrivate::get(imageData.data());
+    if (rowsPadded)
+        d->setSlicedData(repacked, slices, blockSize, isCompressed);
+    else
+        d->setSlicedData(fileData, slices, blockSize, isCompressed, mapped ? file : QSharedPointer<QFile>());
+
+    imageData->setTarget(target);
+    imageData->setMipLevels(mipLevelCount);
+    imageData->setFormat(format);
+    imageData->setPixelFormat(static_cast<QOpenGLTexture::PixelFormat>(glFormat));
+    imageData->setPixelType(static_cast<QOpenGLTexture::PixelType>(glType));
+    imageData->setLayers(layers);
+    imageData->setDepth(depth);
+    imageData->setWidth(width);
+    imageData->setHeight(height);
+    imageData->setFaces(faces);
+
+    return imageData;
+}
+
+const struct Ktx2FormatInfo
+{
+    quint32 vkFormat;
+    FormatInfo formatInfo;
+} ktx2Formats[] = {
+// uncompressed formats
+{ 9,   { QOpenGLTexture::Red,            QOpenGLTexture::R8_UNorm,       QOpenGLTexture::UInt8,   1, false } }, // VK_FORMAT_R8_UNORM
+{ 16,  { QOpenGLTexture::RG,             QOpenGLTexture::RG8_UNorm,      QOpenGLTexture::UInt8,   2, false } }, // VK_FORMAT_R8G8_UNORM
+{ 23,  { QOpenGLTexture::RGB,            QOpenGLTexture::RGB8_UNorm,     QOpenGLTexture::UInt8,   3, false } }, // VK_FORMAT_R8G8B8_UNORM
+{ 29,  { QOpenGLTexture::RGB,            QOpenGLTexture::SRGB8,          QOpenGLTexture::UInt8,   3, false } }, // VK_FORMAT_R8G8B8_SRGB
+{ 37,  { QOpenGLTexture::RGBA,           QOpenGLTexture::RGBA8_UNorm,    QOpenGLTexture::UInt8,   4, false } }, // VK_FORMAT_R8G8B8A8_UNORM
+{ 43,  { QOpenGLTexture::RGBA,           QOpenGLTexture::SRGB8_Alpha8,   QOpenGLTexture::UInt8,   4, false } }, // VK_FORMAT_R8G8B8A8_SRGB
+{ 97,  { QOpenGLTexture::RGBA,           QOpenGLTexture::RGBA16F,        QOpenGLTexture::Float16, 8, false } }, // VK_FORMAT_R16G16B16A16_SFLOAT
+{ 109, { QOpenGLTexture::RGBA,           QOpenGLTexture::RGBA32F,        QOpenGLTexture::Float32, 16, false } }, // VK_FORMAT_R32G32B32A32_SFLOAT
+
+// compressed formats
+{ 131, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::RGB_DXT1,       QOpenGLTexture::NoPixelType, 8, true } }, // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+{ 133, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::RGBA_DXT1,      QOpenGLTexture::NoPixelType, 8, true } }, // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+{ 134, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::SRGB_Alpha_DXT1, QOpenGLTexture::NoPixelType, 8, true } }, // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+{ 135, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::RGBA_DXT3,      QOpenGLTexture::NoPixelType, 16, true } }, // VK_FORMAT_BC2_UNORM_BLOCK
+{ 137, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::RGBA_DXT5,      QOpenGLTexture::NoPixelType, 16, true } }, // VK_FORMAT_BC3_UNORM_BLOCK
+{ 138, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::SRGB_Alpha_DXT5, QOpenGLTexture::NoPixelType, 16, true } }, // VK_FORMAT_BC3_SRGB_BLOCK
+{ 139, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::R_ATI1N_UNorm,  QOpenGLTexture::NoPixelType, 8, true } }, // VK_FORMAT_BC4_UNORM_BLOCK
+{ 141, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::RG_ATI2N_UNorm, QOpenGLTexture::NoPixelType, 16, true } }, // VK_FORMAT_BC5_UNORM_BLOCK
+{ 145, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::RGB_BP_UNorm,   QOpenGLTexture::NoPixelType, 16, true } }, // VK_FORMAT_BC7_UNORM_BLOCK
+{ 146, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::SRGB_BP_UNorm,  QOpenGLTexture::NoPixelType, 16, true } }, // VK_FORMAT_BC7_SRGB_BLOCK
+{ 147, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::RGB8_ETC2,      QOpenGLTexture::NoPixelType, 8, true } }, // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+{ 151, { QOpenGLTexture::NoSourceFormat, QOpenGLTexture::RGBA8_ETC2_EAC, QOpenGLTexture::NoPixelType, 16, true } }, // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+};
+
+QTextureImageDataPtr setKtx2File(const QString &source)
+{
+    QTextureImageDataPtr imageData;
+    QSharedPointer<QFile> file = QSharedPointer<QFile>::create(source);
+    if (!file->open(QIODevice::ReadOnly)) {
+        qWarning() << "Failed to open" << source;
+        return imageData;
+    }
+
+    bool mapped = false;
+    const QByteArray fileData = mapTextureFile(file, &mapped);
+    Ktx2Header header;
+    if (fileData.size() < int(sizeof header)
+            || memcmp(fileData.constData(), ktx2Identifier, sizeof ktx2Identifier) != 0)
+        return imageData;
+    memcpy(&header, fileData.constData(), sizeof header);
+
+    if (qFromLittleEndian(header.supercompressionScheme) != 0) {
+        qWarning() << "Supercompressed KTX2 files are not supported" << source;
+        return imageData;
+    }
+
+    const quint32 vkFormat = qFromLittleEndian(header.vkFormat);
+    const FormatInfo *formatInfo = nullptr;
+    for (const auto &info : ktx2Formats) {
+        if (info.vkFormat == vkFormat) {
+            formatInfo = &info.formatInfo;
+            break;
+        }
+    }
+    if (formatInfo == nullptr) {
+        qWarning() << "Unrecognized pixel format in" << source;
+        return imageData;
+    }
+
+    const quint32 faceCount = qFromLittleEndian(header.faceCount);
+    if (!isValidKtxExtent(qFromLittleEndian(header.pixelWidth), qFromLittleEndian(header.pixelHeight),
+                          qFromLittleEndian(header.pixelDepth))
+            || qFromLittleEndian(header.layerCount) > quint32(maxKtxLayers)
+            || (faceCount != 1 && faceCount != 6)) {
+        qWarning() << "Invalid KTX2 header in" << source;
+        return imageData;
+    }
+
+    const int width = int(qFromLittleEndian(header.pixelWidth));
+    const int height = qMax(int(qFromLittleEndian(header.pixelHeight)), 1);
+    const int depth = qMax(int(qFromLittleEndian(header.pixelDepth)), 1);
+    const int layerCount = int(qFromLittleEndian(header.layerCount));
+    const int layers = qMax(layerCount, 1);
+    const int faces = int(faceCount);
+    const int mipLevelCount = qBound(1, int(qMin(qFromLittleEndian(header.levelCount), quint32(maxKtxDimension))),
+                                     fullMipLevelCount(width, height, depth));
+
+    QOpenGLTexture::Target target;
+    if (depth > 1)
+        target = QOpenGLTexture::Target3D;
+    else if (faces == 6)
+        target = layerCount > 0 ? QOpenGLTexture::TargetCubeMapArray : QOpenGLTexture::TargetCubeMap;
+    else if (qFromLittleEndian(header.pixelHeight) == 0)
+        target = layerCount > 0 ? QOpenGLTexture::Target1DArray : QOpenGLTexture::Target1D;
+    else
+        target = layerCount > 0 ? QOpenGLTexture::Target2DArray : QOpenGLTexture::Target2D;
+
+    const qint64 fileSize = fileData.size();
+    const qint64 levelIndexOffset = qint64(sizeof header);
+    if (levelIndexOffset + mipLevelCount * qint64(sizeof(Ktx2LevelIndex)) > fileSize) {
+        qWarning() << "Unexpected end of data in" << source;
+        return imageData;
+    }
+
+    // Each level is stored tightly packed, layers and faces one after the other
+    QVector<QTextureImageDataPrivate::Slice> slices(layers * faces * mipLevelCount);
+    for (int level = 0; level < mipLevelCount; ++level) {
+        Ktx2LevelIndex index;
+        memcpy(&index, fileData.constData() + levelIndexOffset + level * sizeof index, sizeof index);
+        const quint64 byteOffset = qFromLittleEndian(index.byteOffset);
+        const quint64 byteLength = qFromLittleEndian(index.byteLength);
+        if (byteOffset > quint64(fileSize) || byteLength > quint64(fileSize) - byteOffset) {
+            qWarning() << "Unexpected end of data in" << source;
+            return imageData;
+        }
+        const int w = qMax(width >> level, 1);
+        const int h = qMax(height >> level, 1);
+        const int d = qMax(depth >> level, 1);
+        const qint64 sliceSize = qint64(byteLength) / (layers * faces);
+        if (qint64(byteLength) % (layers * faces) != 0
+                || sliceSize < minimumSliceSize(w, h, d, formatInfo->components, formatInfo->compressed)) {
+            qWarning() << "Invalid level size in" << source;
+            return imageData;
+        }
+        for (int layer = 0; layer < layers; ++layer) {
+            for (int face = 0; face < faces; ++face) {
+                QTextureImageDataPrivate::Slice &slice = slices[(layer * faces + face) * mipLevelCount + level];
+                slice.offset = int(qint64(byteOffset) + (layer * faces + face) * sliceSize);
+                slice.size = int(sliceSize);
+            }
+        }
+    }
+
+    imageData = QTextureImageDataPtr::create();
+    QTextureImageDataPrivate::get(imageData.data())->setSlicedData(fileData, slices,
+                                                                   formatInfo->components,
+                                                                   formatInfo->compressed,
+                                                                   mapped ? file : QSharedPointer<QFile>());
+    imageData->setTarget(target);
+    imageData->setMipLevels(mipLevelCount);
+    imageData->setFormat(formatInfo->textureFormat);
+    imageData->setPixelFormat(formatInfo->pixelFormat);
+    imageData->setPixelType(formatInfo->pixelType);
+    imageData->setLayers(layers);
+    imageData->setDepth(depth);
+    imageData->setWidth(width);
+    imageData->setHeight(height);
+    imageData->setFaces(faces);
+
+    return imageData;
+}
+
 } // anonynous
 
 QTextureImageDataPtr TextureLoadingHelper::loadTextureData(const QUrl &url, bool allow3D, bool mirrored)
@@ -634,6 +1082,12 @@ QTextureImageDataPtr TextureLoadingHelper::loadTextureData(const QUrl &url, bool
         case PKM:
             textureData = setPkmFile(source);
             break;
+        case KTX:
+            textureData = setKtxFile(source);
+            break;
+        case KTX2:
+            textureData = setKtx2File(source);
+            break;
         default:
             QImage img;
             if (img.load(source)) {
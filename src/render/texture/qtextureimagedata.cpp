@@ -71,6 +71,11 @@ QByteArray QTextureImageDataPrivate::data(int layer, int face, int mipmapLevel)
         return QByteArray();
     }
 
+    if (!m_slices.isEmpty()) {
+        const Slice &slice = m_slices.at((layer * m_faces + face) * m_mipLevels + mipmapLevel);
+        return QByteArray::fromRawData(m_data.constData() + slice.offset, slice.size);
+    }
+
     int offset = layer * layerSize() + face * faceSize();
 
     for (int i = 0; i < mipmapLevel; i++)
@@ -90,6 +95,21 @@ void QTextureImageDataPrivate::setData(const QByteArray &data,
 {
     m_isCompressed = isCompressed;
     m_data = data;
+    m_slices.clear();
+    m_mappedFile.reset();
+    m_blockSize = blockSize;
+}
+
+void QTextureImageDataPrivate::setSlicedData(const QByteArray &data,
+                                             const QVector<Slice> &slices,
+                                             int blockSize,
+                                             bool isCompressed,
+                                             const QSharedPointer<QFile> &mappedFile)
+{
+    m_isCompressed = isCompressed;
+    m_data = data;
+    m_slices = slices;
+    m_mappedFile = mappedFile;
     m_blockSize = blockSize;
 }
 
@@ -171,6 +191,8 @@ void QTextureImageData::cleanup() Q_DECL_NOTHROW
     d->m_blockSize = 0;
     d->m_isCompressed = false;
     d->m_data.clear();
+    d->m_slices.clear();
+    d->m_mappedFile.reset();
 }
 
 /*!
@@ -52,9 +52,13 @@
 //
 
 #include "qtextureimagedata.h"
+#include <QSharedPointer>
+#include <QVector>
 
 QT_BEGIN_NAMESPACE
 
+class QFile;
+
 namespace Qt3DRender {
 
 class QTextureImageDataPrivate
@@ -62,7 +66,19 @@ class QTextureImageDataPrivate
 public:
     QTextureImageDataPrivate();
 
+    // Location of the data of a (layer, face, mip level) in m_data
+    struct Slice
+    {
+        int offset;
+        int size;
+    };
+
     void setData(const QByteArray &data, int blockSize, bool isCompressed);
+    // Slices are ordered by layer, face and mip level. If mappedFile is set,
+    // data is expected to point into its memory mapping.
+    void setSlicedData(const QByteArray &data, const QVector<Slice> &slices,
+                       int blockSize, bool isCompressed,
+                       const QSharedPointer<QFile> &mappedFile = QSharedPointer<QFile>());
 
     bool setCompressedFile(const QString &source);
 
@@ -82,7 +98,10 @@ public:
     QOpenGLTexture::PixelType m_pixelType;
 
     bool m_isCompressed;
+    // keeps the memory mapping referenced by m_data alive, must be declared before m_data
+    QSharedPointer<QFile> m_mappedFile;
     QByteArray m_data;
+    QVector<Slice> m_slices;
 
     static QTextureImageDataPrivate *get(QTextureImageData *imageData);
 
@@ -97,6 +116,8 @@ private:
 
 } // namespace Qt3DRender
 
+Q_DECLARE_TYPEINFO(Qt3DRender::QTextureImageDataPrivate::Slice, Q_PRIMITIVE_TYPE);
+
 
 QT_END_NAMESPACE
 
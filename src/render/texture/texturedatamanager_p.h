@@ -51,6 +51,7 @@
 // We mean it.
 //
 
+#include <QMultiHash>
 #include <QMutex>
 #include <QMutexLocker>
 #include <Qt3DRender/qtexture.h>
@@ -64,6 +65,21 @@ QT_BEGIN_NAMESPACE
 namespace Qt3DRender {
 namespace Render {
 
+/**
+ * Generators are indexed by a hash of their content so that looking up the
+ * entry of a generator doesn't require comparing it against every other
+ * generator. Generators whose type isn't known here all hash to the same
+ * value and are only told apart with their operator==.
+ */
+template <class Generator>
+uint generatorHash(const Generator &)
+{
+    return 0;
+}
+
+Q_AUTOTEST_EXPORT uint generatorHash(const QTextureGenerator &generator);
+Q_AUTOTEST_EXPORT uint generatorHash(const QTextureImageDataGenerator &generator);
+
 /**
  * The texture data managers associates each texture data generator
  * with the data objects generated by them. That is, either
@@ -80,12 +96,24 @@ namespace Render {
  * Each Generator is associated with a number of textures that reference it.
  * If the last texture disassociates from a generator, the QTextureData will
  * be deleted.
+ *
+ * Once every referencing texture has uploaded the data to the GPU, the CPU
+ * copy is evicted. The generator is executed again if a texture needs the
+ * data back, e.g. when its GL texture has to be recreated. Setting the
+ * QT3D_KEEP_TEXTURE_DATA environment variable disables the eviction.
  */
 template <class GeneratorPtr, class DataPtr, class APITexture>
 class GeneratorDataManager
 {
 public:
-    GeneratorDataManager() {}
+    GeneratorDataManager()
+        : m_evictUploadedData(qEnvironmentVariableIsEmpty("QT3D_KEEP_TEXTURE_DATA"))
+    {}
+
+    ~GeneratorDataManager()
+    {
+        qDeleteAll(m_entries);
+    }
 
     /*!
      * If no data for the given generator exists, make sure that the
@@ -96,38 +124,90 @@ public:
      */
     bool requestData(const GeneratorPtr &generator, APITexture *tex)
     {
+        const uint hash = generatorHash(*generator);
         QMutexLocker lock(&m_mutex);
 
-        Entry *entry = findEntry(generator);
+        Entry *entry = findEntry(generator, hash);
         const bool needsToBeCreated = (entry == nullptr);
         if (needsToBeCreated)
-            entry = createEntry(generator);
+            entry = createEntry(generator, hash);
         Q_ASSERT(entry);
         if (!entry->referencingTextures.contains(tex))
             entry->referencingTextures.push_back(tex);
+        // The texture will upload the data, if it was evicted
+        // have the generator executed again
+        if (!entry->pendingUploads.contains(tex))
+            entry->pendingUploads.push_back(tex);
+        entry->evicted = false;
         return needsToBeCreated;
     }
 
+    /*!
+     * Tell that texture \a tex has uploaded the data of \a generator. When
+     * all referencing textures have done so, the data is evicted.
+     */
+    void dataUploaded(const GeneratorPtr &generator, APITexture *tex)
+    {
+        const uint hash = generatorHash(*generator);
+        QMutexLocker lock(&m_mutex);
+
+        Entry *entry = findEntry(generator, hash);
+        if (entry == nullptr)
+            return;
+        entry->pendingUploads.removeAll(tex);
+        if (m_evictUploadedData && entry->pendingUploads.empty() && entry->data) {
+            entry->data.reset();
+            entry->evicted = true;
+        }
+    }
+
+    /*!
+     * Make sure the data of an evicted generator is generated again.
+     * Returns true if the data is still available.
+     */
+    bool reloadData(const GeneratorPtr &generator, APITexture *tex)
+    {
+        const uint hash = generatorHash(*generator);
+        QMutexLocker lock(&m_mutex);
+
+        Entry *entry = findEntry(generator, hash);
+        if (entry == nullptr)
+            return false;
+        if (!entry->pendingUploads.contains(tex))
+            entry->pendingUploads.push_back(tex);
+        entry->evicted = false;
+        return !entry->data.isNull();
+    }
+
+    void setEvictUploadedData(bool evict)
+    {
+        QMutexLocker lock(&m_mutex);
+        m_evictUploadedData = evict;
+    }
+
+    bool evictsUploadedData()
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_evictUploadedData;
+    }
+
     /*!
      * Dereference given generator from texture. If no other textures still reference
      * the generator, the associated data will be deleted
      */
     void releaseData(const GeneratorPtr &generator, APITexture *tex)
     {
+        const uint hash = generatorHash(*generator);
         QMutexLocker lock(&m_mutex);
 
-        const auto end = m_data.end();
-        for (auto it = m_data.begin(); it != end; ++it) {
-            Entry &entry = *it;
-            if (*entry.generator == *generator) {
-                entry.referencingTextures.removeAll(tex);
-                // delete, if that was the last reference
-                if (entry.referencingTextures.empty()) {
-                    m_data.erase(it);
-                    return;
-                }
-            }
-        }
+        Entry *entry = findEntry(generator, hash);
+        if (entry == nullptr)
+            return;
+        entry->referencingTextures.removeAll(tex);
+        entry->pendingUploads.removeAll(tex);
+        // delete, if that was the last reference
+        if (entry->referencingTextures.empty())
+            removeEntry(entry);
     }
 
     /*!
@@ -135,9 +215,10 @@ public:
      */
     DataPtr getData(const GeneratorPtr &generator)
     {
+        const uint hash = generatorHash(*generator);
         QMutexLocker lock(&m_mutex);
 
-        const Entry *entry = findEntry(generator);
+        const Entry *entry = findEntry(generator, hash);
         return entry ? entry->data : DataPtr();
     }
 
@@ -148,10 +229,11 @@ public:
     {
         QMutexLocker lock(&m_mutex);
 
+        // Entries are unique per generator, no need to check for duplicates
         QVector<GeneratorPtr> ret;
-        for (const Entry &entry : m_data)
-            if (!entry.data && !ret.contains(entry.generator))
-                ret.push_back(entry.generator);
+        for (const Entry *entry : qAsConst(m_entries))
+            if (!entry->data && !entry->evicted)
+                ret.push_back(entry->generator);
         return ret;
     }
 
@@ -161,13 +243,16 @@ public:
      */
     void assignData(const GeneratorPtr &generator, const DataPtr &data)
     {
+        const uint hash = generatorHash(*generator);
         QMutexLocker lock(&m_mutex);
 
-        Entry *entry = findEntry(generator);
+        Entry *entry = findEntry(generator, hash);
         if (!entry) {
             qWarning() << "[TextureDataManager] assignData() called with non-existent generator";
         } else {
             entry->data = data;
+            entry->evicted = false;
+            entry->pendingUploads = entry->referencingTextures;
 
             // Mark each texture that references this data as being dirty
             // so that the submission thread knows to upload
@@ -182,32 +267,54 @@ private:
     struct Entry {
         GeneratorPtr generator;
         QVector<APITexture*> referencingTextures;
+        // textures which haven't uploaded the data yet
+        QVector<APITexture*> pendingUploads;
         DataPtr data;
+        uint hash;
+        int position;
+        bool evicted;
     };
 
     /*!
      * Helper function: return entry for given generator if it exists, nullptr
-     * otherwise.
+     * otherwise. Only the generators sharing the same hash are compared.
      */
-    Entry* findEntry(const GeneratorPtr &generator)
+    Entry* findEntry(const GeneratorPtr &generator, uint hash)
     {
-        for (int i = 0, sz = m_data.size(); i < sz; ++i)
-            if (*m_data[i].generator == *generator)
-                return &m_data[i];
+        for (auto it = m_index.constFind(hash), end = m_index.cend(); it != end && it.key() == hash; ++it)
+            if (*it.value()->generator == *generator)
+                return it.value();
         return nullptr;
     }
 
-    Entry *createEntry(const GeneratorPtr &generator)
+    Entry *createEntry(const GeneratorPtr &generator, uint hash)
     {
-        Entry newEntry;
-        newEntry.generator = generator;
+        Entry *newEntry = new Entry;
+        newEntry->generator = generator;
+        newEntry->hash = hash;
+        newEntry->position = m_entries.size();
+        newEntry->evicted = false;
+
+        m_entries.push_back(newEntry);
+        m_index.insert(hash, newEntry);
+        return newEntry;
+    }
 
-        m_data.push_back(newEntry);
-        return &m_data.back();
+    void removeEntry(Entry *entry)
+    {
+        m_index.remove(entry->hash, entry);
+        // Swap with the last entry to keep removal O(1)
+        Entry *last = m_entries.last();
+        m_entries[entry->position] = last;
+        last->position = entry->position;
+        m_entries.removeLast();
+        delete entry;
     }
 
     QMutex m_mutex;
-    QVector<Entry> m_data;
+    bool m_evictUploadedData;
+    QVector<Entry *> m_entries;
+    QMultiHash<uint, Entry *> m_index;
 };
 
 class Q_AUTOTEST_EXPORT TextureDataManager
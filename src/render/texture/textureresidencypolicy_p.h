@@ -0,0 +1,148 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QT3DRENDER_RENDER_TEXTURERESIDENCYPOLICY_P_H
+#define QT3DRENDER_RENDER_TEXTURERESIDENCYPOLICY_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/QVector>
+#include <QtCore/QtGlobal>
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+struct TextureResidencyStatistics
+{
+    TextureResidencyStatistics()
+        : budget(0)
+        , residentSize(0)
+        , residentTextures(0)
+        , evictedTextures(0)
+        , totalEvictedTextures(0)
+    {}
+
+    qint64 budget;              // in bytes, 0 when there is no budget
+    qint64 residentSize;        // bytes of source texture data uploaded to the GPU
+    int residentTextures;
+    int evictedTextures;        // by the last eviction pass
+    qint64 totalEvictedTextures;
+};
+
+// Decides which textures to release from the GPU so that the uploaded texture
+// data fits within a memory budget, least recently used textures first.
+// APITexture needs to provide isUnique(), isResident(), lastUsedFrame() and
+// uploadedSourceDataSize().
+template <class APITexture>
+class TextureResidencyPolicy
+{
+public:
+    void setBudget(qint64 budget) { m_statistics.budget = qMax(qint64(0), budget); }
+    qint64 budget() const { return m_statistics.budget; }
+
+    // Statistics as of the last call to selectTexturesToEvict
+    TextureResidencyStatistics statistics() const { return m_statistics; }
+
+    // Returns the resident textures to evict so that the remaining ones fit
+    // within the budget. Unique textures (render targets) would lose their
+    // content and textures used during currentFrame are still needed, they
+    // are never evicted and may keep the resident size over budget.
+    QVector<APITexture *> selectTexturesToEvict(const QVector<APITexture *> &textures, qint64 currentFrame)
+    {
+        QVector<APITexture *> candidates;
+        qint64 residentSize = 0;
+        int residentTextures = 0;
+
+        for (APITexture *tex : textures) {
+            if (!tex->isResident())
+                continue;
+            residentSize += tex->uploadedSourceDataSize();
+            ++residentTextures;
+            if (!tex->isUnique() && tex->lastUsedFrame() < currentFrame && tex->uploadedSourceDataSize() > 0)
+                candidates.push_back(tex);
+        }
+
+        QVector<APITexture *> texturesToEvict;
+        if (m_statistics.budget > 0 && residentSize > m_statistics.budget) {
+            std::stable_sort(candidates.begin(), candidates.end(),
+                             [] (const APITexture *a, const APITexture *b) {
+                return a->lastUsedFrame() < b->lastUsedFrame();
+            });
+
+            for (APITexture *tex : qAsConst(candidates)) {
+                if (residentSize <= m_statistics.budget)
+                    break;
+                residentSize -= tex->uploadedSourceDataSize();
+                --residentTextures;
+                texturesToEvict.push_back(tex);
+            }
+        }
+
+        m_statistics.residentSize = residentSize;
+        m_statistics.residentTextures = residentTextures;
+        m_statistics.evictedTextures = texturesToEvict.size();
+        m_statistics.totalEvictedTextures += texturesToEvict.size();
+
+        return texturesToEvict;
+    }
+
+private:
+    TextureResidencyStatistics m_statistics;
+};
+
+} // namespace Render
+
+} // namespace Qt3DRender
+
+QT_END_NAMESPACE
+
+#endif // QT3DRENDER_RENDER_TEXTURERESIDENCYPOLICY_P_H
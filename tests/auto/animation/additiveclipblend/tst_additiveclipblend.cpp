@@ -65,7 +65,7 @@ public:
     double duration() const Q_DECL_FINAL { return m_duration; }
 
 protected:
-    ClipResults doBlend(const QVector<ClipResults> &) const Q_DECL_FINAL { return ClipResults(); }
+    void doBlend(const QVector<ClipResults> &, ClipResults &) const Q_DECL_FINAL { }
 
 private:
     double m_duration;
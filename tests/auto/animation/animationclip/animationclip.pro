@@ -10,3 +10,6 @@ SOURCES += \
     tst_animationclip.cpp
 
 include(../../core/common/common.pri)
+
+RESOURCES += \
+    animationclip.qrc
@@ -27,6 +27,7 @@
 ****************************************************************************/
 
 #include <QtTest/QTest>
+#include <QtCore/qregularexpression.h>
 #include <Qt3DAnimation/private/animationclip_p.h>
 #include <Qt3DAnimation/qanimationcliploader.h>
 #include <Qt3DCore/private/qnode_p.h>
@@ -185,6 +186,81 @@ private Q_SLOTS:
 
         arbiter.events.clear();
     }
+
+    void checkLoadBinaryClip_data()
+    {
+        QTest::addColumn<QString>("animationName");
+
+        QTest::newRow("first animation") << QString();
+        QTest::newRow("CubeAction") << QStringLiteral("CubeAction");
+        QTest::newRow("LinearTranslation") << QStringLiteral("LinearTranslation");
+    }
+
+    void checkLoadBinaryClip()
+    {
+        // GIVEN
+        QFETCH(QString, animationName);
+        QUrl jsonSource(QStringLiteral("qrc:/clips.json"));
+        QUrl binarySource(QStringLiteral("qrc:/clips.qac"));
+        jsonSource.setFragment(animationName);
+        binarySource.setFragment(animationName);
+        AnimationClip jsonClip;
+        AnimationClip binaryClip;
+        jsonClip.setDataType(AnimationClip::File);
+        jsonClip.setSource(jsonSource);
+        binaryClip.setDataType(AnimationClip::File);
+        binaryClip.setSource(binarySource);
+
+        // WHEN
+        jsonClip.loadAnimation();
+        binaryClip.loadAnimation();
+
+        // THEN
+        QVERIFY(!binaryClip.name().isEmpty());
+        QCOMPARE(binaryClip.name(), jsonClip.name());
+        if (!animationName.isEmpty())
+            QCOMPARE(binaryClip.name(), animationName);
+        QCOMPARE(binaryClip.duration(), jsonClip.duration());
+        QCOMPARE(binaryClip.channelCount(), jsonClip.channelCount());
+        QCOMPARE(binaryClip.channels().size(), jsonClip.channels().size());
+        for (int i = 0; i < jsonClip.channels().size(); ++i) {
+            const Channel &expectedChannel = jsonClip.channels().at(i);
+            const Channel &actualChannel = binaryClip.channels().at(i);
+            QCOMPARE(actualChannel.name, expectedChannel.name);
+            QCOMPARE(actualChannel.channelComponents.size(), expectedChannel.channelComponents.size());
+            for (int j = 0; j < expectedChannel.channelComponents.size(); ++j) {
+                const ChannelComponent &expected = expectedChannel.channelComponents.at(j);
+                const ChannelComponent &actual = actualChannel.channelComponents.at(j);
+                QCOMPARE(actual.name, expected.name);
+                QCOMPARE(actual.fcurve.keyframeCount(), expected.fcurve.keyframeCount());
+                for (int k = 0; k < expected.fcurve.keyframeCount(); ++k) {
+                    QCOMPARE(actual.fcurve.localTime(k), expected.fcurve.localTime(k));
+                    QCOMPARE(actual.fcurve.keyframe(k).interpolation, expected.fcurve.keyframe(k).interpolation);
+                    QCOMPARE(actual.fcurve.keyframe(k).value, expected.fcurve.keyframe(k).value);
+                    if (expected.fcurve.keyframe(k).interpolation == Qt3DAnimation::QKeyFrame::BezierInterpolation) {
+                        QCOMPARE(actual.fcurve.keyframe(k).leftControlPoint, expected.fcurve.keyframe(k).leftControlPoint);
+                        QCOMPARE(actual.fcurve.keyframe(k).rightControlPoint, expected.fcurve.keyframe(k).rightControlPoint);
+                    }
+                }
+            }
+        }
+    }
+
+    void checkLoadMissingNamedAnimation()
+    {
+        // GIVEN
+        AnimationClip binaryClip;
+        binaryClip.setDataType(AnimationClip::File);
+        binaryClip.setSource(QUrl(QStringLiteral("qrc:/clips.qac#DoesNotExist")));
+
+        // WHEN
+        QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("Could not load binary animation clip")));
+        binaryClip.loadAnimation();
+
+        // THEN
+        QCOMPARE(binaryClip.status(), Qt3DAnimation::QAnimationClipLoader::Error);
+        QVERIFY(binaryClip.channels().isEmpty());
+    }
 };
 
 QTEST_APPLESS_MAIN(tst_AnimationClip)
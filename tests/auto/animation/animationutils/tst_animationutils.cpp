@@ -93,16 +93,14 @@ public:
     double duration() const Q_DECL_FINAL { return 0.0f; }
 
 protected:
-    ClipResults doBlend(const QVector<ClipResults> &blendData) const Q_DECL_FINAL
+    void doBlend(const QVector<ClipResults> &blendData, ClipResults &blendResults) const Q_DECL_FINAL
     {
         Q_ASSERT(blendData.size() == 2);
         const int elementCount = blendData.first().size();
-        ClipResults blendResults(elementCount);
+        blendResults.resize(elementCount);
 
         for (int i = 0; i < elementCount; ++i)
             blendResults[i] = 0.5f * (blendData[0][i] + blendData[1][i]);
-
-        return blendResults;
     }
 
 private:
@@ -1942,6 +1940,58 @@ private Q_SLOTS:
         delete handler;
     }
 
+    void checkGatherBlendNodesToEvaluate()
+    {
+        // GIVEN
+        Handler handler;
+        const auto rootLerp = createLerpClipBlend(&handler);
+        const auto lerp = createLerpClipBlend(&handler);
+        const auto value1 = createClipBlendValue(&handler);
+        const auto value2 = createClipBlendValue(&handler);
+        const auto value3 = createClipBlendValue(&handler);
+        lerp->setStartClipId(value1->peerId());
+        lerp->setEndClipId(value2->peerId());
+        rootLerp->setStartClipId(lerp->peerId());
+        rootLerp->setEndClipId(value3->peerId());
+
+        // WHEN
+        const QVector<Qt3DCore::QNodeId> actualIds = gatherBlendNodesToEvaluate(&handler, rootLerp->peerId());
+
+        // THEN
+        const QVector<Qt3DCore::QNodeId> expectedIds = { lerp->peerId(), rootLerp->peerId() };
+        QCOMPARE(actualIds, expectedIds);
+    }
+
+    void checkDependencyRevision()
+    {
+        // GIVEN
+        Handler handler;
+        const auto lerp = createLerpClipBlend(&handler);
+        const auto value1 = createClipBlendValue(&handler);
+        const auto value2 = createClipBlendValue(&handler);
+        lerp->setStartClipId(value1->peerId());
+        lerp->setEndClipId(value2->peerId());
+        const int revision = handler.clipBlendNodeManager()->dependencyRevision();
+
+        // WHEN
+        auto blendFactorChange = Qt3DCore::QPropertyUpdatedChangePtr::create(lerp->peerId());
+        blendFactorChange->setPropertyName("blendFactor");
+        blendFactorChange->setValue(QVariant::fromValue(0.5f));
+        lerp->sceneChangeEvent(blendFactorChange);
+
+        // THEN
+        QCOMPARE(handler.clipBlendNodeManager()->dependencyRevision(), revision);
+
+        // WHEN
+        auto endClipChange = Qt3DCore::QPropertyUpdatedChangePtr::create(lerp->peerId());
+        endClipChange->setPropertyName("endClip");
+        endClipChange->setValue(QVariant::fromValue(value1->peerId()));
+        lerp->sceneChangeEvent(endClipChange);
+
+        // THEN
+        QVERIFY(handler.clipBlendNodeManager()->dependencyRevision() != revision);
+    }
+
     void checkEvaluateBlendTree_data()
     {
         QTest::addColumn<Handler *>("handler");
@@ -2187,6 +2237,15 @@ private Q_SLOTS:
         for (int i = 0; i < actualResults.size(); ++i)
             QCOMPARE(actualResults[i], expectedResults[i]);
 
+        // WHEN
+        const QVector<Qt3DCore::QNodeId> blendNodeIds = gatherBlendNodesToEvaluate(handler, blendNodeId);
+        const ClipResults cachedOrderResults = evaluateBlendTree(handler, animator, blendNodeId, blendNodeIds);
+
+        // THEN
+        QCOMPARE(cachedOrderResults.size(), expectedResults.size());
+        for (int i = 0; i < cachedOrderResults.size(); ++i)
+            QCOMPARE(cachedOrderResults[i], expectedResults[i]);
+
         // Cleanup
         delete handler;
     }
@@ -69,9 +69,9 @@ public:
     double duration() const Q_DECL_FINAL { return 0.0f; }
 
 protected:
-    ClipResults doBlend(const QVector<ClipResults> &) const Q_DECL_FINAL
+    void doBlend(const QVector<ClipResults> &, ClipResults &blendResults) const Q_DECL_FINAL
     {
-        return m_clipResults;
+        blendResults = m_clipResults;
     }
 
 private:
@@ -62,9 +62,9 @@ public:
     double duration() const Q_DECL_FINAL { return 0.0f; }
 
 protected:
-    Qt3DAnimation::Animation::ClipResults doBlend(const QVector<Qt3DAnimation::Animation::ClipResults> &) const Q_DECL_FINAL
+    void doBlend(const QVector<Qt3DAnimation::Animation::ClipResults> &,
+                 Qt3DAnimation::Animation::ClipResults &) const Q_DECL_FINAL
     {
-        return Qt3DAnimation::Animation::ClipResults();
     }
 };
 
@@ -7,6 +7,7 @@ SUBDIRS = \
     quick3d \
     cmake \
     input \
+    logic \
     animation \
     extras
 
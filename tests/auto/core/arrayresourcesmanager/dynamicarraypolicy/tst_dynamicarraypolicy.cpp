@@ -47,6 +47,7 @@ private slots:
     void resetResource();
     void lookupResource();
     void releaseResource();
+    void releaseResources();
     void heavyDutyMultiThreadedAccess();
     void heavyDutyMultiThreadedAccessRelease();
     void maximumNumberOfResources();
@@ -261,6 +262,40 @@ void tst_DynamicArrayPolicy::releaseResource()
     }
 }
 
+void tst_DynamicArrayPolicy::releaseResources()
+{
+    // GIVEN
+    Qt3DCore::QResourceManager<tst_ArrayResource, uint> manager;
+    QVector<uint> evenIds;
+    for (uint i = 0; i < 10; i++) {
+        manager.getOrCreateResource(i)->m_value = i;
+        if (i % 2 == 0)
+            evenIds.push_back(i);
+    }
+
+    // WHEN
+    manager.releaseResources(evenIds);
+
+    // THEN
+    QCOMPARE(manager.count(), 5);
+    QCOMPARE(manager.activeHandles().size(), 5);
+    for (uint i = 0; i < 10; i++)
+        QCOMPARE(manager.lookupResource(i) == nullptr, i % 2 == 0);
+
+    const QVector<tHandle> handles = manager.activeHandles();
+    for (const tHandle &handle : handles) {
+        QVERIFY(manager.data(handle) != nullptr);
+        QVERIFY(manager.data(handle)->m_value % 2 == 1);
+    }
+
+    // WHEN
+    manager.releaseResources(QVector<uint>() << 1 << 3 << 5 << 7 << 9 << 42);
+
+    // THEN
+    QCOMPARE(manager.count(), 0);
+    QVERIFY(manager.activeHandles().empty());
+}
+
 class tst_Thread : public QThread
 {
     Q_OBJECT
@@ -418,9 +453,9 @@ void tst_DynamicArrayPolicy::maximumNumberOfResources()
     QList<tst_ArrayResource *> resources;
     QList<tHandle16> handles;
 
-    QCOMPARE(tHandle16::maxIndex(), (uint)manager.maximumSize());
+    QCOMPARE(tHandle16::maxIndex(), manager.maximumSize());
 
-    for (int i = 0; i < manager.maximumSize(); i++) {
+    for (quint32 i = 0; i < manager.maximumSize(); i++) {
         handles << manager.acquire();
         resources << manager.data(handles.at(i));
         resources.at(i)->m_value = 4;
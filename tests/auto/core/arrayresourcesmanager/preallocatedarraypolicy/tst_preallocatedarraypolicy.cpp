@@ -412,9 +412,9 @@ void tst_PreallocatedArrayPolicy::maximumNumberOfResources()
     QList<tst_ArrayResource *> resources;
     QList<tHandle16> handles;
 
-    QCOMPARE(tHandle16::maxIndex(), (uint)manager.maximumSize());
+    QCOMPARE(tHandle16::maxIndex(), manager.maximumSize());
 
-    for (int i = 0; i < manager.maximumSize(); i++) {
+    for (quint32 i = 0; i < manager.maximumSize(); i++) {
         handles << manager.acquire();
         resources << manager.data(handles.at(i));
         resources.at(i)->m_value = 4;
@@ -3,6 +3,7 @@ TEMPLATE = subdirs
 SUBDIRS = \
     handle \
     handlemanager \
+    qflathash \
     arrayresourcesmanager \
     qcircularbuffer \
     qboundedcircularbuffer \
@@ -21,5 +22,6 @@ qtConfig(private_tests) {
     qtransform \
     threadpooler \
     aspectcommanddebugger \
-    qpostman
+    qpostman \
+    qabstractaspect
 }
@@ -51,6 +51,7 @@ private slots:
     void inequality();
     void staticLimits();
     void bigHandle();
+    void wideHandle();
 };
 
 class SimpleResource
@@ -65,6 +66,7 @@ public:
 
 typedef Qt3DCore::QHandle<SimpleResource> Handle;
 typedef Qt3DCore::QHandle<SimpleResource, 22> BigHandle;
+typedef Qt3DCore::QHandle<SimpleResource, 32> WideHandle;
 
 void tst_Handle::defaultConstruction()
 {
@@ -167,6 +169,29 @@ void tst_Handle::bigHandle()
     QVERIFY(BigHandle::maxCounter() == (1 << (32 - 22 - 2)) - 1);
 }
 
+void tst_Handle::wideHandle()
+{
+    QCOMPARE(sizeof(BigHandle), sizeof(quint32));
+    QCOMPARE(sizeof(WideHandle), sizeof(quint64));
+
+    WideHandle h;
+    QVERIFY(h.isNull() == true);
+    QVERIFY(h.index() == 0);
+    QVERIFY(h.counter() == 0);
+    QVERIFY(h.handle() == 0);
+
+    WideHandle h1(0xfffffffe, 1);
+    QVERIFY(h1.isNull() == false);
+    QCOMPARE(h1.index(), quint32(0xfffffffe));
+    QCOMPARE(h1.counter(), quint32(1));
+
+    WideHandle h2(0xfffffffe, 2);
+    QVERIFY(h1 != h2);
+
+    QCOMPARE(WideHandle::maxIndex(), quint32(0xffffffff));
+    QCOMPARE(WideHandle::maxCounter(), quint32((1 << (64 - 32 - 2)) - 1));
+}
+
 QTEST_APPLESS_MAIN(tst_Handle)
 
 #include "tst_handle.moc"
@@ -48,6 +48,7 @@ private slots:
     void resetRemovesAllEntries();
     void maximumEntries();
     void checkNoCounterOverflow();
+    void entriesBeyondSixteenBits();
 };
 
 class SimpleResource
@@ -299,7 +300,45 @@ void tst_HandleManager::checkNoCounterOverflow()
     QCOMPARE(h.counter(), (quint32)1);
 }
 
+void tst_HandleManager::entriesBeyondSixteenBits()
+{
+    // GIVEN
+    typedef Qt3DCore::QHandle<SimpleResource, 32> WideHandle;
+    Qt3DCore::QHandleManager<SimpleResource, 32> manager;
+    const int entryCount = (1 << 16) + 1000;
+    QVector<WideHandle> handles;
+    handles.reserve(entryCount);
 
+    // WHEN
+    for (int i = 0; i < entryCount; ++i) {
+        SimpleResource *p = (SimpleResource *)(quintptr)(0xdead0000 + i);
+        handles.push_back(manager.acquire(p));
+    }
+
+    // THEN
+    QCOMPARE(manager.activeEntries(), quint32(entryCount));
+    QCOMPARE(handles.last().index(), quint32(entryCount - 1));
+    for (int i = 0; i < entryCount; ++i)
+        QCOMPARE(manager.data(handles.at(i)), (SimpleResource *)(quintptr)(0xdead0000 + i));
+
+    // WHEN
+    const WideHandle released = handles.at(70000);
+    manager.release(released);
+    const WideHandle reacquired = manager.acquire((SimpleResource *)(quintptr)0xbeef);
+
+    // THEN
+    QCOMPARE(reacquired.index(), released.index());
+    QVERIFY(reacquired != released);
+    QVERIFY(manager.data(released) == nullptr);
+    QCOMPARE(manager.data(reacquired), (SimpleResource *)(quintptr)0xbeef);
+
+    // WHEN
+    manager.reset();
+
+    // THEN
+    QCOMPARE(manager.activeEntries(), quint32(0));
+    QVERIFY(manager.data(reacquired) == nullptr);
+}
 
 QTEST_APPLESS_MAIN(tst_HandleManager)
 
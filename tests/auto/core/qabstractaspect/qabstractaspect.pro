@@ -0,0 +1,7 @@
+TARGET = tst_qabstractaspect
+CONFIG += testcase
+TEMPLATE = app
+
+SOURCES += tst_qabstractaspect.cpp
+
+QT += testlib 3dcore 3dcore-private core-private
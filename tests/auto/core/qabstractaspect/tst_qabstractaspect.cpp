@@ -0,0 +1,184 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <Qt3DCore/qabstractaspect.h>
+#include <Qt3DCore/qbackendnode.h>
+#include <Qt3DCore/qentity.h>
+#include <Qt3DCore/qnodedestroyedchange.h>
+#include <Qt3DCore/qtransform.h>
+#include <Qt3DCore/private/qabstractaspect_p.h>
+#include <Qt3DCore/private/qbackendnode_p.h>
+#include <Qt3DCore/private/qnodecreatedchangegenerator_p.h>
+
+using namespace Qt3DCore;
+
+class TestMapper : public QBackendNodeMapper
+{
+public:
+    QBackendNode *create(const QNodeCreatedChangeBasePtr &change) const Q_DECL_OVERRIDE
+    {
+        QBackendNode *backend = new QBackendNode();
+        m_backends.insert(change->subjectId(), backend);
+        return backend;
+    }
+
+    QBackendNode *get(QNodeId id) const Q_DECL_OVERRIDE
+    {
+        return m_backends.value(id, nullptr);
+    }
+
+    void destroy(QNodeId id) const Q_DECL_OVERRIDE
+    {
+        delete m_backends.take(id);
+        singleDestroyedIds.push_back(id);
+    }
+
+    ~TestMapper()
+    {
+        qDeleteAll(m_backends);
+    }
+
+    mutable QVector<QNodeId> singleDestroyedIds;
+
+protected:
+    mutable QHash<QNodeId, QBackendNode *> m_backends;
+};
+
+class TestBatchMapper : public TestMapper, public QBackendNodeBatchDestroyer
+{
+public:
+    using TestMapper::destroy;
+
+    void destroy(const QVector<QNodeId> &ids) const Q_DECL_OVERRIDE
+    {
+        for (const QNodeId id : ids)
+            delete m_backends.take(id);
+        batchDestroyedIds.push_back(ids);
+    }
+
+    mutable QVector<QVector<QNodeId>> batchDestroyedIds;
+};
+
+class TestAspect : public QAbstractAspect
+{
+    Q_OBJECT
+public:
+    explicit TestAspect(const QSharedPointer<TestBatchMapper> &entityMapper,
+                        const QSharedPointer<TestMapper> &transformMapper)
+    {
+        registerBackendType<QEntity>(entityMapper);
+        registerBackendType<QTransform>(transformMapper);
+    }
+
+private:
+    QVector<QAspectJobPtr> jobsToExecute(qint64) Q_DECL_OVERRIDE
+    {
+        return QVector<QAspectJobPtr>();
+    }
+};
+
+class tst_QAbstractAspect : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkBatchedBackendNodeDestruction()
+    {
+        // GIVEN
+        QSharedPointer<TestBatchMapper> entityMapper(new TestBatchMapper());
+        QSharedPointer<TestMapper> transformMapper(new TestMapper());
+        TestAspect aspect(entityMapper, transformMapper);
+        QAbstractAspectPrivate *aspectPrivate = QAbstractAspectPrivate::get(&aspect);
+
+        QEntity root;
+        QEntity *child1 = new QEntity(&root);
+        QEntity *child2 = new QEntity(&root);
+        QTransform *transform = new QTransform(child1);
+        child1->addComponent(transform);
+
+        const QVector<QNodeCreatedChangeBasePtr> creationChanges = QNodeCreatedChangeGenerator(&root).creationChanges();
+        for (const QNodeCreatedChangeBasePtr &change : creationChanges)
+            aspectPrivate->createBackendNode(change);
+
+        // THEN
+        QVERIFY(entityMapper->get(root.id()) != nullptr);
+        QVERIFY(entityMapper->get(child1->id()) != nullptr);
+        QVERIFY(entityMapper->get(child2->id()) != nullptr);
+        QVERIFY(transformMapper->get(transform->id()) != nullptr);
+
+        // WHEN
+        const QVector<QNodeIdTypePair> subtreeIdsAndTypes = {
+            QNodeIdTypePair(root.id(), &QEntity::staticMetaObject),
+            QNodeIdTypePair(child1->id(), &QEntity::staticMetaObject),
+            QNodeIdTypePair(transform->id(), &QTransform::staticMetaObject),
+            QNodeIdTypePair(child2->id(), &QEntity::staticMetaObject)
+        };
+        aspectPrivate->clearBackendNode(QNodeDestroyedChangePtr::create(&root, subtreeIdsAndTypes));
+
+        // THEN
+        // The entities are released with a single batched call
+        QCOMPARE(entityMapper->batchDestroyedIds.size(), 1);
+        QCOMPARE(entityMapper->batchDestroyedIds.first(),
+                 QVector<QNodeId>() << root.id() << child1->id() << child2->id());
+        QVERIFY(entityMapper->singleDestroyedIds.isEmpty());
+        QVERIFY(entityMapper->get(root.id()) == nullptr);
+        QVERIFY(entityMapper->get(child1->id()) == nullptr);
+        QVERIFY(entityMapper->get(child2->id()) == nullptr);
+
+        // Mappers without batch support still get one call per node
+        QCOMPARE(transformMapper->singleDestroyedIds, QVector<QNodeId>() << transform->id());
+        QVERIFY(transformMapper->get(transform->id()) == nullptr);
+    }
+
+    void checkNoBatchForUnknownNodes()
+    {
+        // GIVEN
+        QSharedPointer<TestBatchMapper> entityMapper(new TestBatchMapper());
+        QSharedPointer<TestMapper> transformMapper(new TestMapper());
+        TestAspect aspect(entityMapper, transformMapper);
+        QAbstractAspectPrivate *aspectPrivate = QAbstractAspectPrivate::get(&aspect);
+        QEntity root;
+
+        // WHEN
+        const QVector<QNodeIdTypePair> subtreeIdsAndTypes = {
+            QNodeIdTypePair(root.id(), &QEntity::staticMetaObject)
+        };
+        aspectPrivate->clearBackendNode(QNodeDestroyedChangePtr::create(&root, subtreeIdsAndTypes));
+
+        // THEN
+        QVERIFY(entityMapper->batchDestroyedIds.isEmpty());
+        QVERIFY(entityMapper->singleDestroyedIds.isEmpty());
+    }
+};
+
+QTEST_MAIN(tst_QAbstractAspect)
+
+#include "tst_qabstractaspect.moc"
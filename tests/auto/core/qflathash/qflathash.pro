@@ -0,0 +1,7 @@
+TARGET = tst_qflathash
+CONFIG += testcase
+TEMPLATE = app
+
+SOURCES += tst_qflathash.cpp
+
+QT += testlib 3dcore 3dcore-private
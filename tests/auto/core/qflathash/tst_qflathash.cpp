@@ -0,0 +1,215 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <Qt3DCore/private/qflathash_p.h>
+
+using namespace Qt3DCore;
+
+class tst_QFlatHash : public QObject
+{
+    Q_OBJECT
+public:
+    tst_QFlatHash() {}
+    ~tst_QFlatHash() {}
+
+private slots:
+    void checkInitialState();
+    void checkInsertAndLookup();
+    void checkOverwrite();
+    void checkRemoveKeepsOtherKeysReachable();
+    void checkGrowth();
+    void checkIteration();
+    void checkMatchesQHash();
+};
+
+void tst_QFlatHash::checkInitialState()
+{
+    // GIVEN
+    QFlatHash<int, int> hash;
+
+    // THEN
+    QVERIFY(hash.isEmpty());
+    QCOMPARE(hash.size(), 0);
+    QVERIFY(!hash.contains(42));
+    QCOMPARE(hash.value(42, -1), -1);
+    QVERIFY(hash.cbegin() == hash.cend());
+}
+
+void tst_QFlatHash::checkInsertAndLookup()
+{
+    // GIVEN
+    QFlatHash<int, int> hash;
+
+    // WHEN
+    hash.insert(1, 10);
+    hash.insert(2, 20);
+    hash[3] = 30;
+
+    // THEN
+    QCOMPARE(hash.size(), 3);
+    QVERIFY(hash.contains(1));
+    QCOMPARE(hash.value(1), 10);
+    QCOMPARE(hash.value(2), 20);
+    QCOMPARE(hash.value(3), 30);
+    QVERIFY(!hash.contains(4));
+}
+
+void tst_QFlatHash::checkOverwrite()
+{
+    // GIVEN
+    QFlatHash<int, int> hash;
+    hash.insert(1, 10);
+
+    // WHEN
+    hash.insert(1, 100);
+
+    // THEN
+    QCOMPARE(hash.size(), 1);
+    QCOMPARE(hash.value(1), 100);
+
+    // WHEN
+    hash[1] += 1;
+
+    // THEN
+    QCOMPARE(hash.size(), 1);
+    QCOMPARE(hash.value(1), 101);
+}
+
+void tst_QFlatHash::checkRemoveKeepsOtherKeysReachable()
+{
+    // GIVEN
+    QFlatHash<int, int> hash;
+    const int count = 200;
+    for (int i = 0; i < count; ++i)
+        hash.insert(i, i * 2);
+
+    // WHEN
+    for (int i = 0; i < count; i += 2)
+        QVERIFY(hash.remove(i));
+
+    // THEN
+    QCOMPARE(hash.size(), count / 2);
+    for (int i = 0; i < count; ++i) {
+        QCOMPARE(hash.contains(i), (i % 2) != 0);
+        if (i % 2)
+            QCOMPARE(hash.value(i), i * 2);
+    }
+    QVERIFY(!hash.remove(0));
+
+    // WHEN
+    const int taken = hash.take(1);
+
+    // THEN
+    QCOMPARE(taken, 2);
+    QVERIFY(!hash.contains(1));
+    QCOMPARE(hash.size(), count / 2 - 1);
+}
+
+void tst_QFlatHash::checkGrowth()
+{
+    // GIVEN
+    QFlatHash<int, int> hash;
+
+    // WHEN
+    hash.reserve(1000);
+    const int reservedCapacity = hash.capacity();
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+
+    // THEN
+    QCOMPARE(hash.capacity(), reservedCapacity);
+    QVERIFY(hash.capacity() * 3 >= hash.size() * 4);
+
+    // WHEN
+    for (int i = 1000; i < 5000; ++i)
+        hash.insert(i, i);
+
+    // THEN
+    QCOMPARE(hash.size(), 5000);
+    QVERIFY(hash.capacity() * 3 >= hash.size() * 4);
+    for (int i = 0; i < 5000; ++i)
+        QCOMPARE(hash.value(i, -1), i);
+
+    // WHEN
+    hash.clear();
+
+    // THEN
+    QVERIFY(hash.isEmpty());
+    QVERIFY(!hash.contains(0));
+}
+
+void tst_QFlatHash::checkIteration()
+{
+    // GIVEN
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, -i);
+
+    // WHEN
+    QSet<int> keys;
+    for (auto it = hash.cbegin(), end = hash.cend(); it != end; ++it) {
+        QCOMPARE(it.value(), -it.key());
+        keys.insert(it.key());
+    }
+
+    // THEN
+    QCOMPARE(keys.size(), 100);
+}
+
+void tst_QFlatHash::checkMatchesQHash()
+{
+    // GIVEN
+    QFlatHash<int, int> hash;
+    QHash<int, int> reference;
+    qsrand(1234);
+
+    // WHEN
+    for (int i = 0; i < 20000; ++i) {
+        const int key = qrand() % 2048;
+        switch (qrand() % 3) {
+        case 0:
+        case 1:
+            hash.insert(key, i);
+            reference.insert(key, i);
+            break;
+        default:
+            QCOMPARE(hash.remove(key), reference.remove(key) > 0);
+            break;
+        }
+    }
+
+    // THEN
+    QCOMPARE(hash.size(), reference.size());
+    for (auto it = reference.cbegin(), end = reference.cend(); it != end; ++it)
+        QCOMPARE(hash.value(it.key(), -1), it.value());
+}
+
+QTEST_APPLESS_MAIN(tst_QFlatHash)
+
+#include "tst_qflathash.moc"
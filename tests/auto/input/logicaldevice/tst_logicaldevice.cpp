@@ -54,6 +54,9 @@ private Q_SLOTS:
         QCOMPARE(backendLogicalDevice.isEnabled(), false);
         QVERIFY(backendLogicalDevice.axes().empty());
         QVERIFY(backendLogicalDevice.actions().empty());
+        QVERIFY(backendLogicalDevice.axisHandles().empty());
+        QVERIFY(backendLogicalDevice.actionHandles().empty());
+        QCOMPARE(backendLogicalDevice.areHandlesDirty(), true);
     }
 
     void checkCleanupState()
@@ -89,6 +92,64 @@ private Q_SLOTS:
         QCOMPARE(backendLogicalDevice.isEnabled(), false);
         QCOMPARE(backendLogicalDevice.axes().size(), 0);
         QCOMPARE(backendLogicalDevice.actions().size(), 0);
+        QCOMPARE(backendLogicalDevice.areHandlesDirty(), true);
+    }
+
+    void checkHandlesInvalidation()
+    {
+        // GIVEN
+        Qt3DInput::Input::LogicalDevice backendLogicalDevice;
+
+        // WHEN
+        backendLogicalDevice.setHandles(QVector<Qt3DInput::Input::HAxis>(),
+                                        QVector<Qt3DInput::Input::HAction>());
+
+        // THEN
+        QCOMPARE(backendLogicalDevice.areHandlesDirty(), false);
+
+        // WHEN
+        Qt3DInput::QAxis axis;
+        {
+            const auto change = Qt3DCore::QPropertyNodeAddedChangePtr::create(Qt3DCore::QNodeId(), &axis);
+            change->setPropertyName("axis");
+            backendLogicalDevice.sceneChangeEvent(change);
+        }
+
+        // THEN
+        QCOMPARE(backendLogicalDevice.areHandlesDirty(), true);
+
+        // WHEN
+        backendLogicalDevice.setHandles(QVector<Qt3DInput::Input::HAxis>(),
+                                        QVector<Qt3DInput::Input::HAction>());
+        {
+            const auto change = Qt3DCore::QPropertyNodeRemovedChangePtr::create(Qt3DCore::QNodeId(), &axis);
+            change->setPropertyName("axis");
+            backendLogicalDevice.sceneChangeEvent(change);
+        }
+
+        // THEN
+        QCOMPARE(backendLogicalDevice.areHandlesDirty(), true);
+
+        // WHEN
+        backendLogicalDevice.setHandles(QVector<Qt3DInput::Input::HAxis>(),
+                                        QVector<Qt3DInput::Input::HAction>());
+        Qt3DInput::QAction action;
+        {
+            const auto change = Qt3DCore::QPropertyNodeAddedChangePtr::create(Qt3DCore::QNodeId(), &action);
+            change->setPropertyName("action");
+            backendLogicalDevice.sceneChangeEvent(change);
+        }
+
+        // THEN
+        QCOMPARE(backendLogicalDevice.areHandlesDirty(), true);
+
+        // WHEN
+        backendLogicalDevice.setHandles(QVector<Qt3DInput::Input::HAxis>(),
+                                        QVector<Qt3DInput::Input::HAction>());
+        backendLogicalDevice.markHandlesDirty();
+
+        // THEN
+        QCOMPARE(backendLogicalDevice.areHandlesDirty(), true);
     }
 
     void checkInitializeFromPeer()
@@ -0,0 +1,222 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QTest>
+#include <qbackendnodetester.h>
+#include "testdevice.h"
+
+#include <Qt3DCore/qpropertynodeaddedchange.h>
+#include <Qt3DInput/private/inputhandler_p.h>
+#include <Qt3DInput/private/inputmanagers_p.h>
+#include <Qt3DInput/private/updateaxisactionjob_p.h>
+#include <Qt3DInput/QAction>
+#include <Qt3DInput/QActionInput>
+#include <Qt3DInput/QAnalogAxisInput>
+#include <Qt3DInput/QAxis>
+#include <Qt3DInput/QLogicalDevice>
+
+namespace {
+
+struct TestLogicalDevice
+{
+    Qt3DInput::QLogicalDevice *logicalDevice;
+    Qt3DInput::QAction *action;
+    Qt3DInput::QActionInput *actionInput;
+    Qt3DInput::QAxis *axis;
+    Qt3DInput::QAnalogAxisInput *axisInput;
+};
+
+} // anonymous
+
+class tst_UpdateAxisActionJob : public Qt3DCore::QBackendNodeTester
+{
+    Q_OBJECT
+
+private:
+    // Creates a logical device with one action triggered by button and one
+    // axis reading axisIdentifier, along with their backend nodes
+    TestLogicalDevice createLogicalDevice(Qt3DInput::Input::InputHandler *handler, TestDevice *device,
+                                          int button, int axisIdentifier, Qt3DCore::QNode *parent)
+    {
+        TestLogicalDevice d;
+        d.logicalDevice = new Qt3DInput::QLogicalDevice(parent);
+        d.action = new Qt3DInput::QAction(d.logicalDevice);
+        d.actionInput = new Qt3DInput::QActionInput(d.action);
+        d.axis = new Qt3DInput::QAxis(d.logicalDevice);
+        d.axisInput = new Qt3DInput::QAnalogAxisInput(d.axis);
+
+        d.actionInput->setButtons(QVector<int>() << button);
+        d.actionInput->setSourceDevice(device);
+        d.action->addInput(d.actionInput);
+        d.axisInput->setAxis(axisIdentifier);
+        d.axisInput->setSourceDevice(device);
+        d.axis->addInput(d.axisInput);
+        d.logicalDevice->addAction(d.action);
+        d.logicalDevice->addAxis(d.axis);
+
+        simulateInitialization(d.actionInput, handler->actionInputManager()->getOrCreateResource(d.actionInput->id()));
+        simulateInitialization(d.action, handler->actionManager()->getOrCreateResource(d.action->id()));
+        simulateInitialization(d.axisInput, handler->analogAxisInputManager()->getOrCreateResource(d.axisInput->id()));
+        simulateInitialization(d.axis, handler->axisManager()->getOrCreateResource(d.axis->id()));
+        simulateInitialization(d.logicalDevice, handler->logicalDeviceManager()->getOrCreateResource(d.logicalDevice->id()));
+        return d;
+    }
+
+private Q_SLOTS:
+    void checkInitialState()
+    {
+        // GIVEN
+        Qt3DInput::Input::InputHandler handler;
+        Qt3DInput::Input::UpdateAxisActionJob job(&handler);
+
+        // THEN
+        QCOMPARE(job.currentTime(), qint64(0));
+        QVERIFY(job.devices().isEmpty());
+    }
+
+    void checkBatchedUpdate()
+    {
+        // GIVEN
+        TestDeviceIntegration deviceIntegration;
+        TestDevice *device = deviceIntegration.createPhysicalDevice("keyboard");
+        TestDeviceBackendNode *deviceBackend = deviceIntegration.physicalDevice(device->id());
+        Qt3DInput::Input::InputHandler handler;
+        handler.addInputDeviceIntegration(&deviceIntegration);
+
+        QScopedPointer<Qt3DCore::QNode> root(new Qt3DCore::QNode);
+        const TestLogicalDevice first = createLogicalDevice(&handler, device, Qt::Key_Space, 1, root.data());
+        const TestLogicalDevice second = createLogicalDevice(&handler, device, Qt::Key_Return, 2, root.data());
+        const TestLogicalDevice third = createLogicalDevice(&handler, device, Qt::Key_Up, 3, root.data());
+
+        Qt3DInput::Input::LogicalDeviceManager *logicalDeviceManager = handler.logicalDeviceManager();
+        Qt3DInput::Input::UpdateAxisActionJob firstJob(&handler);
+        firstJob.setDevices(QVector<Qt3DInput::Input::HLogicalDevice>()
+                            << logicalDeviceManager->lookupHandle(first.logicalDevice->id())
+                            << logicalDeviceManager->lookupHandle(second.logicalDevice->id()));
+        Qt3DInput::Input::UpdateAxisActionJob secondJob(&handler);
+        secondJob.setDevices(QVector<Qt3DInput::Input::HLogicalDevice>()
+                             << logicalDeviceManager->lookupHandle(third.logicalDevice->id()));
+
+        // WHEN
+        deviceBackend->setButtonPressed(Qt::Key_Space, true);
+        deviceBackend->setButtonPressed(Qt::Key_Up, true);
+        deviceBackend->setAxisValue(1, 0.25f);
+        deviceBackend->setAxisValue(2, -0.5f);
+        deviceBackend->setAxisValue(3, 0.75f);
+        firstJob.setCurrentTime(1000000000);
+        firstJob.run();
+        secondJob.setCurrentTime(1000000000);
+        secondJob.run();
+
+        // THEN
+        Qt3DInput::Input::Action *firstAction = handler.actionManager()->lookupResource(first.action->id());
+        Qt3DInput::Input::Action *secondAction = handler.actionManager()->lookupResource(second.action->id());
+        Qt3DInput::Input::Action *thirdAction = handler.actionManager()->lookupResource(third.action->id());
+        QCOMPARE(firstAction->actionTriggered(), true);
+        QCOMPARE(secondAction->actionTriggered(), false);
+        QCOMPARE(thirdAction->actionTriggered(), true);
+        QCOMPARE(handler.axisManager()->lookupResource(first.axis->id())->axisValue(), 0.25f);
+        QCOMPARE(handler.axisManager()->lookupResource(second.axis->id())->axisValue(), -0.5f);
+        QCOMPARE(handler.axisManager()->lookupResource(third.axis->id())->axisValue(), 0.75f);
+
+        // Input handles are resolved once by the first update
+        QCOMPARE(firstAction->areInputHandlesDirty(), false);
+        QCOMPARE(firstAction->actionInputHandles().size(), 1);
+        QCOMPARE(handler.axisManager()->lookupResource(first.axis->id())->areInputHandlesDirty(), false);
+        QCOMPARE(handler.axisManager()->lookupResource(first.axis->id())->analogAxisInputHandles().size(), 1);
+
+        // WHEN
+        deviceBackend->setButtonPressed(Qt::Key_Space, false);
+        deviceBackend->setButtonPressed(Qt::Key_Return, true);
+        deviceBackend->setAxisValue(3, 2.0f);
+        firstJob.run();
+        secondJob.run();
+
+        // THEN
+        QCOMPARE(firstAction->actionTriggered(), false);
+        QCOMPARE(secondAction->actionTriggered(), true);
+        QCOMPARE(thirdAction->actionTriggered(), true);
+        // Axis values are clamped to [-1, 1]
+        QCOMPARE(handler.axisManager()->lookupResource(third.axis->id())->axisValue(), 1.0f);
+    }
+
+    void checkInputHandlesRefresh()
+    {
+        // GIVEN
+        TestDeviceIntegration deviceIntegration;
+        TestDevice *device = deviceIntegration.createPhysicalDevice("keyboard");
+        TestDeviceBackendNode *deviceBackend = deviceIntegration.physicalDevice(device->id());
+        Qt3DInput::Input::InputHandler handler;
+        handler.addInputDeviceIntegration(&deviceIntegration);
+
+        QScopedPointer<Qt3DCore::QNode> root(new Qt3DCore::QNode);
+        const TestLogicalDevice d = createLogicalDevice(&handler, device, Qt::Key_Space, 1, root.data());
+        Qt3DInput::Input::UpdateAxisActionJob job(&handler);
+        job.setDevices(QVector<Qt3DInput::Input::HLogicalDevice>()
+                       << handler.logicalDeviceManager()->lookupHandle(d.logicalDevice->id()));
+        job.setCurrentTime(1000000000);
+        job.run();
+
+        Qt3DInput::Input::Action *backendAction = handler.actionManager()->lookupResource(d.action->id());
+        QCOMPARE(backendAction->actionTriggered(), false);
+
+        // WHEN -> an input is added to the action
+        Qt3DInput::QActionInput *returnInput = new Qt3DInput::QActionInput(root.data());
+        returnInput->setButtons(QVector<int>() << Qt::Key_Return);
+        returnInput->setSourceDevice(device);
+        simulateInitialization(returnInput, handler.actionInputManager()->getOrCreateResource(returnInput->id()));
+        const auto change = Qt3DCore::QPropertyNodeAddedChangePtr::create(d.action->id(), returnInput);
+        change->setPropertyName("input");
+        backendAction->sceneChangeEvent(change);
+
+        // THEN
+        QCOMPARE(backendAction->areInputHandlesDirty(), true);
+
+        // WHEN
+        deviceBackend->setButtonPressed(Qt::Key_Return, true);
+        job.run();
+
+        // THEN
+        QCOMPARE(backendAction->areInputHandlesDirty(), false);
+        QCOMPARE(backendAction->actionInputHandles().size(), 2);
+        QCOMPARE(backendAction->actionTriggered(), true);
+
+        // WHEN -> the added input is destroyed
+        handler.actionInputManager()->releaseResource(returnInput->id());
+        job.run();
+
+        // THEN
+        QCOMPARE(backendAction->actionTriggered(), false);
+        QCOMPARE(backendAction->areInputHandlesDirty(), true);
+    }
+};
+
+QTEST_MAIN(tst_UpdateAxisActionJob)
+
+#include "tst_updateaxisactionjob.moc"
@@ -0,0 +1,11 @@
+TEMPLATE = app
+
+TARGET = tst_updateaxisactionjob
+
+QT += core-private 3dcore 3dcore-private 3dinput 3dinput-private testlib
+
+CONFIG += testcase
+
+SOURCES += tst_updateaxisactionjob.cpp
+
+include(../commons/commons.pri)
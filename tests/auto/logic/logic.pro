@@ -0,0 +1,6 @@
+TEMPLATE = subdirs
+
+qtConfig(private_tests) {
+    SUBDIRS += \
+        manager
+}
@@ -0,0 +1,11 @@
+TEMPLATE = app
+
+TARGET = tst_manager
+
+QT += core-private 3dcore 3dcore-private 3dlogic 3dlogic-private testlib
+
+CONFIG += testcase
+
+SOURCES += tst_manager.cpp
+
+include(../../core/common/common.pri)
@@ -0,0 +1,176 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QTest>
+#include <QtCore/qthread.h>
+#include <Qt3DLogic/qframeaction.h>
+#include <Qt3DLogic/qlogicaspect.h>
+#include <Qt3DLogic/private/executor_p.h>
+#include <Qt3DLogic/private/handler_p.h>
+#include <Qt3DLogic/private/manager_p.h>
+#include <Qt3DLogic/private/managers_p.h>
+#include <Qt3DCore/private/qscene_p.h>
+#include <qbackendnodetester.h>
+
+namespace {
+
+// Plays the role of the logic aspect job running on the thread pool
+class FrameUpdateThread : public QThread
+{
+public:
+    FrameUpdateThread(Qt3DLogic::Logic::Manager *manager, int tickCount, float dt)
+        : m_manager(manager)
+        , m_tickCount(tickCount)
+        , m_dt(dt)
+    {}
+
+protected:
+    void run() Q_DECL_OVERRIDE
+    {
+        for (int i = 0; i < m_tickCount; ++i) {
+            m_manager->setDeltaTime(m_dt);
+            m_manager->triggerLogicFrameUpdates();
+        }
+    }
+
+private:
+    Qt3DLogic::Logic::Manager *m_manager;
+    int m_tickCount;
+    float m_dt;
+};
+
+} // anonymous
+
+class tst_Manager : public Qt3DCore::QBackendNodeTester
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void checkInitialState()
+    {
+        // GIVEN
+        Qt3DLogic::Logic::Manager manager;
+        Qt3DLogic::QLogicAspect aspect;
+
+        // THEN
+        QCOMPARE(manager.executionMode(), Qt3DLogic::QLogicAspect::Synchronous);
+        QCOMPARE(aspect.executionMode(), Qt3DLogic::QLogicAspect::Synchronous);
+
+        // WHEN
+        aspect.setExecutionMode(Qt3DLogic::QLogicAspect::Asynchronous);
+
+        // THEN
+        QCOMPARE(aspect.executionMode(), Qt3DLogic::QLogicAspect::Asynchronous);
+    }
+
+    void checkAsynchronousModeDoesNotWaitForMainThread()
+    {
+        // GIVEN
+        Qt3DCore::QScene scene;
+        Qt3DLogic::QFrameAction frameAction;
+        scene.addObservable(&frameAction);
+        int triggerCount = 0;
+        float deliveredDt = 0.0f;
+        QObject::connect(&frameAction, &Qt3DLogic::QFrameAction::triggered, [&] (float dt) {
+            ++triggerCount;
+            deliveredDt += dt;
+        });
+
+        Qt3DLogic::Logic::Executor executor;
+        executor.setScene(&scene);
+        Qt3DLogic::Logic::Manager manager;
+        manager.setExecutor(&executor);
+        manager.setExecutionMode(Qt3DLogic::QLogicAspect::Asynchronous);
+        Qt3DLogic::Logic::Handler *handler = manager.logicHandlerManager()->getOrCreateResource(frameAction.id());
+        setPeerId(handler, frameAction.id());
+        manager.appendHandler(handler);
+
+        // WHEN
+        // The main thread is blocked while the aspect side runs its ticks
+        FrameUpdateThread aspectThread(&manager, 10, 0.016f);
+        aspectThread.start();
+
+        // THEN
+        QVERIFY(aspectThread.wait(5000));
+        QCOMPARE(triggerCount, 0);
+
+        // WHEN
+        QCoreApplication::processEvents();
+
+        // THEN
+        // All missed ticks are delivered as a single trigger with their summed dt
+        QCOMPARE(triggerCount, 1);
+        QVERIFY(qFuzzyCompare(deliveredDt, 0.16f));
+
+        // WHEN
+        FrameUpdateThread secondAspectThread(&manager, 1, 0.02f);
+        secondAspectThread.start();
+        QVERIFY(secondAspectThread.wait(5000));
+        QCoreApplication::processEvents();
+
+        // THEN
+        QCOMPARE(triggerCount, 2);
+        QVERIFY(qFuzzyCompare(deliveredDt, 0.18f));
+    }
+
+    void checkWorkerThreadModeTriggersFromAspectThread()
+    {
+        // GIVEN
+        Qt3DCore::QScene scene;
+        Qt3DLogic::QFrameAction frameAction;
+        scene.addObservable(&frameAction);
+        QAtomicInt triggerCount;
+        QThread *triggerThread = nullptr;
+        QObject::connect(&frameAction, &Qt3DLogic::QFrameAction::triggered, [&] (float) {
+            triggerCount.ref();
+            triggerThread = QThread::currentThread();
+        }, Qt::DirectConnection);
+
+        Qt3DLogic::Logic::Executor executor;
+        executor.setScene(&scene);
+        Qt3DLogic::Logic::Manager manager;
+        manager.setExecutor(&executor);
+        manager.setExecutionMode(Qt3DLogic::QLogicAspect::WorkerThread);
+        Qt3DLogic::Logic::Handler *handler = manager.logicHandlerManager()->getOrCreateResource(frameAction.id());
+        setPeerId(handler, frameAction.id());
+        manager.appendHandler(handler);
+
+        // WHEN
+        FrameUpdateThread aspectThread(&manager, 10, 0.016f);
+        aspectThread.start();
+
+        // THEN
+        QVERIFY(aspectThread.wait(5000));
+        QCOMPARE(triggerCount.load(), 10);
+        QCOMPARE(triggerThread, &aspectThread);
+    }
+};
+
+QTEST_MAIN(tst_Manager)
+
+#include "tst_manager.moc"
@@ -288,6 +288,138 @@ private slots:
 
         qDeleteAll(components);
     }
+
+    void checkComponentHandlesResolution()
+    {
+        // GIVEN
+        TestRenderer renderer;
+        NodeManagers nodeManagers;
+        Qt3DCore::QEntity dummyFrontendEntity;
+        QMaterial material;
+        const HEntity entityHandle = nodeManagers.renderNodesManager()->getOrAcquireHandle(dummyFrontendEntity.id());
+        Entity *entity = nodeManagers.renderNodesManager()->data(entityHandle);
+        entity->setRenderer(&renderer);
+        entity->setNodeManagers(&nodeManagers);
+        entity->setHandle(entityHandle);
+
+        // THEN
+        QVERIFY(!entity->areComponentHandlesDirty());
+        QVERIFY(nodeManagers.renderNodesManager()->dirtyComponentHandles().isEmpty());
+
+        // WHEN
+        const auto addChange = QComponentAddedChangePtr::create(&dummyFrontendEntity, &material);
+        entity->sceneChangeEvent(addChange);
+
+        // THEN
+        QVERIFY(entity->areComponentHandlesDirty());
+        QCOMPARE(nodeManagers.renderNodesManager()->dirtyComponentHandles().size(), 1);
+
+        // WHEN -> no backend material exists yet
+        nodeManagers.renderNodesManager()->resolveDirtyComponentHandles();
+
+        // THEN
+        QVERIFY(entity->areComponentHandlesDirty());
+        QCOMPARE(nodeManagers.renderNodesManager()->dirtyComponentHandles().size(), 1);
+        QVERIFY(entity->renderComponent<Material>() == nullptr);
+
+        // WHEN
+        Material *backendMaterial = nodeManagers.materialManager()->getOrCreateResource(material.id());
+        nodeManagers.renderNodesManager()->resolveDirtyComponentHandles();
+
+        // THEN
+        QVERIFY(!entity->areComponentHandlesDirty());
+        QVERIFY(nodeManagers.renderNodesManager()->dirtyComponentHandles().isEmpty());
+        QCOMPARE(entity->renderComponent<Material>(), backendMaterial);
+        QCOMPARE(entity->componentHandle<Material>(), nodeManagers.materialManager()->lookupHandle(material.id()));
+
+        // WHEN
+        const auto removeChange = QComponentRemovedChangePtr::create(&dummyFrontendEntity, &material);
+        entity->sceneChangeEvent(removeChange);
+
+        // THEN
+        QVERIFY(entity->areComponentHandlesDirty());
+        QVERIFY(entity->renderComponent<Material>() == nullptr);
+        QVERIFY(entity->componentHandle<Material>().isNull());
+
+        // WHEN
+        nodeManagers.renderNodesManager()->resolveDirtyComponentHandles();
+
+        // THEN
+        QVERIFY(!entity->areComponentHandlesDirty());
+        QVERIFY(nodeManagers.renderNodesManager()->dirtyComponentHandles().isEmpty());
+    }
+
+    void checkComponentTypesArchetypes()
+    {
+        // GIVEN
+        TestRenderer renderer;
+        NodeManagers nodeManagers;
+        EntityManager *entityManager = nodeManagers.renderNodesManager();
+        Qt3DCore::QEntity dummyFrontendEntity1;
+        Qt3DCore::QEntity dummyFrontendEntity2;
+        QMaterial material;
+        QGeometryRenderer geometryRenderer;
+        QMaterial material2;
+        const HEntity entityHandle1 = entityManager->getOrAcquireHandle(dummyFrontendEntity1.id());
+        const HEntity entityHandle2 = entityManager->getOrAcquireHandle(dummyFrontendEntity2.id());
+        Entity *entity1 = entityManager->data(entityHandle1);
+        Entity *entity2 = entityManager->data(entityHandle2);
+        entity1->setRenderer(&renderer);
+        entity1->setNodeManagers(&nodeManagers);
+        entity1->setHandle(entityHandle1);
+        entity2->setRenderer(&renderer);
+        entity2->setNodeManagers(&nodeManagers);
+        entity2->setHandle(entityHandle2);
+
+        // THEN
+        QCOMPARE(entity1->componentTypes(), Entity::ComponentTypes());
+        QVERIFY(entityManager->entitiesWithComponentTypes(Entity::MaterialComponent).isEmpty());
+
+        // WHEN
+        entity1->sceneChangeEvent(QComponentAddedChangePtr::create(&dummyFrontendEntity1, &geometryRenderer));
+        entity1->sceneChangeEvent(QComponentAddedChangePtr::create(&dummyFrontendEntity1, &material));
+        entity2->sceneChangeEvent(QComponentAddedChangePtr::create(&dummyFrontendEntity2, &material2));
+
+        // THEN
+        QCOMPARE(entity1->componentTypes(), Entity::MaterialComponent | Entity::GeometryRendererComponent);
+        QCOMPARE(entity2->componentTypes(), Entity::ComponentTypes(Entity::MaterialComponent));
+        QVERIFY((entity1->containsComponentsOfType<GeometryRenderer, Material>()));
+        QVERIFY(!(entity2->containsComponentsOfType<GeometryRenderer, Material>()));
+        QCOMPARE(entityManager->entitiesWithComponentTypes(Entity::MaterialComponent),
+                 QVector<HEntity>() << entityHandle1 << entityHandle2);
+        QCOMPARE(entityManager->entitiesWithComponentTypes(Entity::componentTypesOf<GeometryRenderer, Material>()),
+                 QVector<HEntity>() << entityHandle1);
+
+        // WHEN
+        entity1->sceneChangeEvent(QComponentRemovedChangePtr::create(&dummyFrontendEntity1, &material));
+
+        // THEN
+        QCOMPARE(entity1->componentTypes(), Entity::ComponentTypes(Entity::GeometryRendererComponent));
+        QCOMPARE(entityManager->entitiesWithComponentTypes(Entity::MaterialComponent),
+                 QVector<HEntity>() << entityHandle2);
+        QCOMPARE(entityManager->entitiesWithComponentTypes(Entity::GeometryRendererComponent),
+                 QVector<HEntity>() << entityHandle1);
+
+        // WHEN
+        entity1->sceneChangeEvent(QComponentRemovedChangePtr::create(&dummyFrontendEntity1, &geometryRenderer));
+        entity1->sceneChangeEvent(QComponentAddedChangePtr::create(&dummyFrontendEntity1, &material));
+
+        // THEN -> archetypes stay in handle order whatever the insertion order
+        QCOMPARE(entity1->componentTypes(), Entity::ComponentTypes(Entity::MaterialComponent));
+        QCOMPARE(entityManager->entitiesWithComponentTypes(Entity::MaterialComponent),
+                 QVector<HEntity>() << entityHandle1 << entityHandle2);
+        QVERIFY(entityManager->entitiesWithComponentTypes(Entity::GeometryRendererComponent).isEmpty());
+
+        // WHEN
+        entity1->sceneChangeEvent(QComponentRemovedChangePtr::create(&dummyFrontendEntity1, &material));
+        entity1->sceneChangeEvent(QComponentAddedChangePtr::create(&dummyFrontendEntity1, &geometryRenderer));
+        entity2->cleanup();
+
+        // THEN
+        QVERIFY(entityManager->entitiesWithComponentTypes(Entity::MaterialComponent).isEmpty());
+        QCOMPARE(entityManager->entitiesWithComponentTypes(Entity::GeometryRendererComponent),
+                 QVector<HEntity>() << entityHandle1);
+    }
 };
 
 QTEST_APPLESS_MAIN(tst_RenderEntity)
@@ -0,0 +1,185 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QTest>
+#include <Qt3DRender/private/glstateshadow_p.h>
+#include <Qt3DRender/private/glbuffer_p.h>
+
+using namespace Qt3DRender::Render;
+
+class tst_GLStateShadow : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkInitialState()
+    {
+        // GIVEN
+        GLStateShadow shadow;
+
+        // THEN
+        for (int i = 0; i < GLStateShadow::CallTypeCount; ++i)
+            QCOMPARE(shadow.redundantCallCount(static_cast<GLStateShadow::CallType>(i)), 0);
+    }
+
+    void checkRedundantUniformsAreSkipped()
+    {
+        // GIVEN
+        GLStateShadow shadow;
+
+        // THEN
+        QVERIFY(shadow.updateUniform(1, 0, UniformValue(QVector3D(1.0f, 0.0f, 0.0f))));
+        QVERIFY(shadow.updateUniform(1, 1, UniformValue(0.5f)));
+        QVERIFY(!shadow.updateUniform(1, 0, UniformValue(QVector3D(1.0f, 0.0f, 0.0f))));
+        QVERIFY(!shadow.updateUniform(1, 1, UniformValue(0.5f)));
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::UniformUpload), 2);
+
+        // THEN
+        QVERIFY(!shadow.updateUniform(1, 0, UniformValue(QVector3D(1.0f, 0.0f, 0.0f))));
+        QVERIFY(shadow.updateUniform(1, 1, UniformValue(0.25f)));
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::UniformUpload), 3);
+    }
+
+    void checkUniformsAreShadowedPerProgram()
+    {
+        // GIVEN
+        GLStateShadow shadow;
+
+        // THEN
+        QVERIFY(shadow.updateUniform(1, 0, UniformValue(1.0f)));
+        QVERIFY(shadow.updateUniform(2, 0, UniformValue(1.0f)));
+        QVERIFY(!shadow.updateUniform(1, 0, UniformValue(1.0f)));
+        QVERIFY(!shadow.updateUniform(2, 0, UniformValue(1.0f)));
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::UniformUpload), 2);
+
+        // WHEN
+        shadow.removeProgram(1);
+
+        // THEN
+        QVERIFY(shadow.updateUniform(1, 0, UniformValue(1.0f)));
+        QVERIFY(!shadow.updateUniform(2, 0, UniformValue(1.0f)));
+    }
+
+    void checkRedundantBufferBindingsAreSkipped()
+    {
+        // GIVEN
+        GLStateShadow shadow;
+
+        // THEN
+        QVERIFY(shadow.updateUniformBlockBinding(1, 0, 0));
+        QVERIFY(shadow.updateBufferBinding(GLBuffer::UniformBuffer, 0, 10));
+        QVERIFY(!shadow.updateUniformBlockBinding(1, 0, 0));
+        QVERIFY(!shadow.updateBufferBinding(GLBuffer::UniformBuffer, 0, 10));
+        // Block bindings are program state, buffer bindings aren't
+        QVERIFY(shadow.updateUniformBlockBinding(2, 0, 0));
+        QVERIFY(!shadow.updateBufferBinding(GLBuffer::UniformBuffer, 0, 10));
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::UniformBlockBinding), 1);
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::BufferBinding), 2);
+
+        // THEN
+        QVERIFY(!shadow.updateUniformBlockBinding(2, 0, 0));
+        QVERIFY(shadow.updateBufferBinding(GLBuffer::UniformBuffer, 0, 11));
+    }
+
+    void checkBindingsAreForgottenWithTheirBuffer()
+    {
+        // GIVEN
+        GLStateShadow shadow;
+        shadow.updateBufferBinding(GLBuffer::UniformBuffer, 0, 10);
+        shadow.updateBufferBinding(GLBuffer::UniformBuffer, 1, 11);
+        shadow.updateBufferBinding(GLBuffer::ShaderStorageBuffer, 0, 10);
+
+        // WHEN
+        shadow.removeBuffer(10);
+
+        // THEN
+        QVERIFY(shadow.updateBufferBinding(GLBuffer::UniformBuffer, 0, 10));
+        QVERIFY(!shadow.updateBufferBinding(GLBuffer::UniformBuffer, 1, 11));
+        QVERIFY(shadow.updateBufferBinding(GLBuffer::ShaderStorageBuffer, 0, 10));
+
+        // WHEN
+        shadow.resetBufferBindings();
+
+        // THEN
+        QVERIFY(shadow.updateBufferBinding(GLBuffer::UniformBuffer, 1, 11));
+    }
+
+    void checkResetCounters()
+    {
+        // GIVEN
+        GLStateShadow shadow;
+        shadow.countRedundantCall(GLStateShadow::VertexArrayBinding);
+        shadow.updateUniform(1, 0, UniformValue(1.0f));
+        shadow.updateUniform(1, 0, UniformValue(1.0f));
+
+        // THEN
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::VertexArrayBinding), 1);
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::UniformUpload), 1);
+
+        // WHEN
+        shadow.resetCounters();
+
+        // THEN
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::VertexArrayBinding), 0);
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::UniformUpload), 0);
+        // Shadowed values are kept
+        QVERIFY(!shadow.updateUniform(1, 0, UniformValue(1.0f)));
+    }
+
+    void checkStartFrame()
+    {
+        // GIVEN
+        GLStateShadow shadow;
+        shadow.countRedundantCall(GLStateShadow::VertexArrayBinding);
+        shadow.countRedundantCall(GLStateShadow::VertexArrayBinding);
+
+        // THEN
+        QCOMPARE(shadow.previousFrameRedundantCallCount(GLStateShadow::VertexArrayBinding), 0);
+
+        // WHEN
+        shadow.startFrame();
+
+        // THEN
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::VertexArrayBinding), 0);
+        QCOMPARE(shadow.previousFrameRedundantCallCount(GLStateShadow::VertexArrayBinding), 2);
+
+        // WHEN
+        shadow.countRedundantCall(GLStateShadow::VertexArrayBinding);
+        shadow.startFrame();
+
+        // THEN
+        QCOMPARE(shadow.redundantCallCount(GLStateShadow::VertexArrayBinding), 0);
+        QCOMPARE(shadow.previousFrameRedundantCallCount(GLStateShadow::VertexArrayBinding), 1);
+    }
+};
+
+QTEST_APPLESS_MAIN(tst_GLStateShadow)
+
+#include "tst_glstateshadow.moc"
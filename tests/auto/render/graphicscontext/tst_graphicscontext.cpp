@@ -0,0 +1,279 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QTest>
+#include <qbackendnodetester.h>
+#include <Qt3DRender/qbuffer.h>
+#include <Qt3DRender/qshaderprogram.h>
+#include <Qt3DRender/private/buffer_p.h>
+#include <Qt3DRender/private/glstateshadow_p.h>
+#include <Qt3DRender/private/graphicscontext_p.h>
+#include <Qt3DRender/private/graphicshelpergl3_3_p.h>
+#include <Qt3DRender/private/managers_p.h>
+#include <Qt3DRender/private/nodemanagers_p.h>
+#include <Qt3DRender/private/renderer_p.h>
+#include <Qt3DRender/private/shader_p.h>
+#include <Qt3DRender/private/shaderparameterpack_p.h>
+#include <Qt3DRender/private/stringtoint_p.h>
+#include <QOpenGLFunctions_3_3_Core>
+
+#if !defined(QT_OPENGL_ES_2) && defined(QT_OPENGL_3_2)
+
+#define TEST_SHOULD_BE_PERFORMED 1
+
+using namespace Qt3DRender;
+using namespace Qt3DRender::Render;
+
+namespace {
+
+const QByteArray vertCode = QByteArrayLiteral(
+            "#version 330 core\n" \
+            "in vec3 vertexPosition;\n" \
+            "layout(std140) uniform Block\n" \
+            "{\n" \
+            "   vec4 offset;\n" \
+            "};\n" \
+            "void main()\n" \
+            "{\n" \
+            "   gl_Position = vec4(vertexPosition, 1.0) + offset;\n" \
+            "}\n");
+
+const QByteArray fragCode = QByteArrayLiteral(
+            "#version 330 core\n" \
+            "uniform vec4 color;\n" \
+            "uniform float intensity;\n" \
+            "out vec4 fragColor;\n" \
+            "void main()\n" \
+            "{\n" \
+            "   fragColor = color * intensity;\n" \
+            "}\n");
+
+// Records the calls that the GLStateShadow lets through, before issuing them
+class RecordingGraphicsHelper : public GraphicsHelperGL3_3
+{
+public:
+    void bindBufferBase(GLenum target, GLuint index, GLuint buffer) Q_DECL_OVERRIDE
+    {
+        calls.push_back(QStringLiteral("bindBufferBase"));
+        GraphicsHelperGL3_3::bindBufferBase(target, index, buffer);
+    }
+
+    void bindUniformBlock(GLuint programId, GLuint uniformBlockIndex, GLuint uniformBlockBinding) Q_DECL_OVERRIDE
+    {
+        calls.push_back(QStringLiteral("bindUniformBlock"));
+        GraphicsHelperGL3_3::bindUniformBlock(programId, uniformBlockIndex, uniformBlockBinding);
+    }
+
+    void glUniform1fv(GLint location, GLsizei count, const GLfloat *value) Q_DECL_OVERRIDE
+    {
+        calls.push_back(QStringLiteral("glUniform1fv"));
+        GraphicsHelperGL3_3::glUniform1fv(location, count, value);
+    }
+
+    void glUniform4fv(GLint location, GLsizei count, const GLfloat *value) Q_DECL_OVERRIDE
+    {
+        calls.push_back(QStringLiteral("glUniform4fv"));
+        GraphicsHelperGL3_3::glUniform4fv(location, count, value);
+    }
+
+    QStringList calls;
+};
+
+} // anonymous
+
+class tst_GraphicsContext : public Qt3DCore::QBackendNodeTester
+{
+    Q_OBJECT
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        // Programs must be compiled rather than loaded from a previous run
+        qputenv("QT3D_DISABLE_SHADER_CACHE", QByteArrayLiteral("1"));
+    }
+
+    void init()
+    {
+        m_window.reset(new QWindow);
+        m_window->setSurfaceType(QWindow::OpenGLSurface);
+        m_window->setGeometry(0, 0, 10, 10);
+
+        QSurfaceFormat format;
+        format.setVersion(3, 3);
+        format.setProfile(QSurfaceFormat::CoreProfile);
+        m_window->setFormat(format);
+        m_glContext.setFormat(format);
+
+        m_window->create();
+
+        if (!m_glContext.create()) {
+            qWarning() << "Failed to create OpenGL context";
+            return;
+        }
+
+        if (!m_glContext.makeCurrent(m_window.data())) {
+            qWarning() << "Failed to make OpenGL context current";
+            return;
+        }
+
+        m_initializationSuccessful = (m_glContext.versionFunctions<QOpenGLFunctions_3_3_Core>() != nullptr);
+    }
+
+    void cleanup()
+    {
+        m_glContext.doneCurrent();
+    }
+
+    void checkRedundantCallsAreSkippedAndCounted()
+    {
+        if (!m_initializationSuccessful)
+            QSKIP("Initialization failed, OpenGL 3.3 Core functions not supported");
+
+        // GIVEN
+        Renderer renderer(QRenderAspect::Synchronous);
+        NodeManagers nodeManagers;
+        renderer.setNodeManagers(&nodeManagers);
+
+        QShaderProgram frontendShader;
+        frontendShader.setVertexShaderCode(vertCode);
+        frontendShader.setFragmentShaderCode(fragCode);
+        Shader *shader = nodeManagers.shaderManager()->getOrCreateResource(frontendShader.id());
+        shader->setRenderer(&renderer);
+        simulateInitialization(&frontendShader, shader);
+
+        const float offset[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        Qt3DRender::QBuffer frontendBuffer(Qt3DRender::QBuffer::UniformBuffer);
+        frontendBuffer.setData(QByteArray(reinterpret_cast<const char *>(offset), sizeof(offset)));
+        Buffer *buffer = nodeManagers.bufferManager()->getOrCreateResource(frontendBuffer.id());
+        buffer->setRenderer(&renderer);
+        buffer->setManager(nodeManagers.bufferManager());
+        simulateInitialization(&frontendBuffer, buffer);
+
+        QScopedPointer<GraphicsContext> context(new GraphicsContext());
+        context->setRenderer(&renderer);
+        context->setOpenGLContext(&m_glContext);
+        QVERIFY(context->beginDrawing(m_window.data()));
+
+        RecordingGraphicsHelper *helper = new RecordingGraphicsHelper();
+        helper->initializeHelper(&m_glContext, m_glContext.versionFunctions<QOpenGLFunctions_3_3_Core>());
+        context->setGraphicsHelper(m_window.data(), helper);
+
+        context->loadShader(shader, nodeManagers.shaderManager());
+        QCOMPARE(shader->status(), QShaderProgram::Ready);
+
+        ShaderParameterPack pack;
+        pack.setUniform(StringToInt::lookupId(QLatin1String("color")), UniformValue(QVector4D(1.0f, 0.0f, 0.0f, 1.0f)));
+        pack.setUniform(StringToInt::lookupId(QLatin1String("intensity")), UniformValue(0.5f));
+        pack.setUniformBuffer(BlockToUBO { shader->uniformBlockForBlockName(QStringLiteral("Block")).m_index,
+                                           frontendBuffer.id(), false, QByteArray() });
+        shader->prepareUniforms(pack);
+        QCOMPARE(pack.submissionUniforms().size(), 2);
+
+        // WHEN
+        QVERIFY(context->activateShader(shader->dna()));
+        context->setParameters(pack);
+
+        // THEN
+        QCOMPARE(helper->calls.count(QStringLiteral("bindUniformBlock")), 1);
+        QCOMPARE(helper->calls.count(QStringLiteral("bindBufferBase")), 1);
+        QCOMPARE(helper->calls.count(QStringLiteral("glUniform4fv")), 1);
+        QCOMPARE(helper->calls.count(QStringLiteral("glUniform1fv")), 1);
+        QCOMPARE(context->glStateShadow()->redundantCallCount(GLStateShadow::UniformUpload), 0);
+
+        // WHEN
+        helper->calls.clear();
+        context->setParameters(pack);
+
+        // THEN -> nothing changed, every call is skipped
+        QVERIFY(helper->calls.isEmpty());
+        QCOMPARE(context->glStateShadow()->redundantCallCount(GLStateShadow::UniformUpload), 2);
+        QCOMPARE(context->glStateShadow()->redundantCallCount(GLStateShadow::UniformBlockBinding), 1);
+        QCOMPARE(context->glStateShadow()->redundantCallCount(GLStateShadow::BufferBinding), 1);
+
+        // WHEN
+        helper->calls.clear();
+        pack.setUniform(StringToInt::lookupId(QLatin1String("intensity")), UniformValue(0.25f));
+        context->setParameters(pack);
+
+        // THEN
+        QCOMPARE(helper->calls, QStringList() << QStringLiteral("glUniform1fv"));
+        QCOMPARE(context->glStateShadow()->redundantCallCount(GLStateShadow::UniformUpload), 3);
+
+        // WHEN
+        context->endDrawing(false);
+        QVERIFY(context->beginDrawing(m_window.data()));
+
+        // THEN -> the counters of the previous frame are kept
+        for (int i = 0; i < GLStateShadow::CallTypeCount; ++i)
+            QCOMPARE(context->glStateShadow()->redundantCallCount(static_cast<GLStateShadow::CallType>(i)), 0);
+        QCOMPARE(context->glStateShadow()->previousFrameRedundantCallCount(GLStateShadow::UniformUpload), 3);
+        QCOMPARE(context->glStateShadow()->previousFrameRedundantCallCount(GLStateShadow::UniformBlockBinding), 2);
+        QCOMPARE(context->glStateShadow()->previousFrameRedundantCallCount(GLStateShadow::BufferBinding), 2);
+
+        // WHEN
+        helper->calls.clear();
+        QVERIFY(context->activateShader(shader->dna()));
+        context->setParameters(pack);
+
+        // THEN -> buffer bindings are reset every frame, program state isn't
+        QCOMPARE(helper->calls, QStringList() << QStringLiteral("bindBufferBase"));
+        QCOMPARE(context->glStateShadow()->redundantCallCount(GLStateShadow::UniformUpload), 2);
+        QCOMPARE(context->glStateShadow()->redundantCallCount(GLStateShadow::UniformBlockBinding), 1);
+        QCOMPARE(context->glStateShadow()->redundantCallCount(GLStateShadow::BufferBinding), 0);
+
+        context->endDrawing(false);
+    }
+
+private:
+    QScopedPointer<QWindow> m_window;
+    QOpenGLContext m_glContext;
+    bool m_initializationSuccessful = false;
+};
+
+#endif
+
+QT_BEGIN_NAMESPACE
+QTEST_ADD_GPU_BLACKLIST_SUPPORT_DEFS
+QT_END_NAMESPACE
+
+int main(int argc, char *argv[])
+{
+#ifdef TEST_SHOULD_BE_PERFORMED
+    QGuiApplication app(argc, argv);
+    app.setAttribute(Qt::AA_Use96Dpi, true);
+    QTEST_ADD_GPU_BLACKLIST_SUPPORT
+    tst_GraphicsContext tc;
+    QTEST_SET_MAIN_SOURCE_PATH
+    return QTest::qExec(&tc, argc, argv);
+#endif
+    return 0;
+}
+
+#ifdef TEST_SHOULD_BE_PERFORMED
+#include "tst_graphicscontext.moc"
+#endif
@@ -1188,6 +1188,7 @@ private Q_SLOTS:
         SUPPORTS_FEATURE(GraphicsHelperInterface::DrawBuffersBlend, false);
         // Tesselation could be true or false depending on extensions so not tested
         SUPPORTS_FEATURE(GraphicsHelperInterface::BlitFramebuffer, true);
+        SUPPORTS_FEATURE(GraphicsHelperInterface::MultiDrawIndirect, false);
     }
 
 
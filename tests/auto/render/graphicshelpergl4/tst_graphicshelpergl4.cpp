@@ -1380,6 +1380,7 @@ private Q_SLOTS:
     {
         for (int i = 0; i <= GraphicsHelperInterface::BlitFramebuffer; ++i)
             QVERIFY(m_glHelper.supportsFeature(static_cast<GraphicsHelperInterface::Feature>(i)));
+        QVERIFY(m_glHelper.supportsFeature(GraphicsHelperInterface::MultiDrawIndirect));
     }
 
 
@@ -34,6 +34,7 @@
 #include <Qt3DRender/private/filterlayerentityjob_p.h>
 #include <Qt3DRender/private/updatetreeenabledjob_p.h>
 #include <Qt3DRender/qlayer.h>
+#include <Qt3DCore/qcomponentremovedchange.h>
 #include "testaspect.h"
 
 class tst_LayerFiltering : public QObject
@@ -224,6 +225,57 @@ private Q_SLOTS:
         for (auto i = 0, m = expectedSelectedEntities.size(); i < m; ++i)
             QCOMPARE(expectedSelectedEntities.at(i), filterEntities.at(i)->peerId());
     }
+
+    void updateLayerMembership()
+    {
+        // GIVEN
+        Qt3DCore::QEntity *rootEntity = new Qt3DCore::QEntity();
+        Qt3DCore::QEntity *childEntity1 = new Qt3DCore::QEntity(rootEntity);
+        Qt3DCore::QEntity *childEntity2 = new Qt3DCore::QEntity(rootEntity);
+        // Created after the entities referencing it
+        Qt3DRender::QLayer *layer = new Qt3DRender::QLayer(rootEntity);
+        childEntity1->addComponent(layer);
+        childEntity2->addComponent(layer);
+
+        QScopedPointer<Qt3DRender::TestAspect> aspect(new Qt3DRender::TestAspect(rootEntity));
+        Qt3DRender::Render::EntityManager *entityManager = aspect->nodeManagers()->renderNodesManager();
+        Qt3DRender::Render::Layer *backendLayer = aspect->nodeManagers()->layerManager()->lookupResource(layer->id());
+        const int index1 = int(entityManager->lookupHandle(childEntity1->id()).index());
+        const int index2 = int(entityManager->lookupHandle(childEntity2->id()).index());
+        const int rootIndex = int(entityManager->lookupHandle(rootEntity->id()).index());
+
+        // THEN
+        QVERIFY(backendLayer != nullptr);
+        QCOMPARE(backendLayer->entities().count(true), 2);
+        QVERIFY(backendLayer->entities().testBit(index1));
+        QVERIFY(backendLayer->entities().testBit(index2));
+        QVERIFY(rootIndex >= backendLayer->entities().size() || !backendLayer->entities().testBit(rootIndex));
+
+        // WHEN
+        Qt3DRender::Render::Entity *backendEntity1 = entityManager->lookupResource(childEntity1->id());
+        backendEntity1->sceneChangeEvent(Qt3DCore::QComponentRemovedChangePtr::create(childEntity1, layer));
+
+        // THEN
+        QCOMPARE(backendLayer->entities().count(true), 1);
+        QVERIFY(!backendLayer->entities().testBit(index1));
+
+        // WHEN
+        Qt3DRender::Render::FilterLayerEntityJob filterJob;
+        filterJob.setHasLayerFilter(true);
+        filterJob.setLayers(Qt3DCore::QNodeIdVector() << layer->id());
+        filterJob.setManager(aspect->nodeManagers());
+        filterJob.run();
+
+        // THEN
+        QCOMPARE(filterJob.filteredEntities().size(), 1);
+        QCOMPARE(filterJob.filteredEntities().first()->peerId(), childEntity2->id());
+
+        // WHEN
+        aspect->nodeManagers()->renderNodesManager()->releaseResource(childEntity2->id());
+
+        // THEN
+        QCOMPARE(backendLayer->entities().count(true), 0);
+    }
 };
 
 QTEST_MAIN(tst_LayerFiltering)
@@ -36,6 +36,8 @@
 #include <Qt3DRender/private/managers_p.h>
 #include <Qt3DRender/private/entity_p.h>
 #include <Qt3DRender/private/materialparametergathererjob_p.h>
+#include <Qt3DRender/private/materialparametergatherercache_p.h>
+#include <Qt3DRender/private/renderer_p.h>
 #include <Qt3DRender/private/techniquefilternode_p.h>
 #include <Qt3DRender/private/technique_p.h>
 #include <Qt3DRender/private/techniquemanager_p.h>
@@ -88,6 +90,11 @@ public:
         return d_func()->m_renderer->nodeManagers();
     }
 
+    Render::Renderer *renderer() const
+    {
+        return static_cast<Render::Renderer *>(d_func()->m_renderer);
+    }
+
     void initializeRenderer()
     {
         d_func()->m_renderer->initialize();
@@ -460,6 +467,61 @@ private Q_SLOTS:
         // THEN
         QCOMPARE(gatherer->materialToPassAndParameter().size(), 0);
     }
+
+    void checkRunReusesCachedParametersUntilMaterialDirty()
+    {
+        // GIVEN
+        TestMaterial material;
+        Qt3DCore::QEntity *sceneRoot = buildScene(viewportFrameGraph(), &material);
+        Qt3DRender::TestAspect testAspect(sceneRoot);
+        Qt3DRender::Render::MaterialParameterGathererCache *cache = testAspect.renderer()->materialParameterGathererCache();
+        Qt3DRender::Render::MaterialParameterGathererJobPtr gatherer = testAspect.materialGathererJob();
+
+        testAspect.initializeRenderer();
+
+        // WHEN
+        gatherer->setHandles(testAspect.nodeManagers()->materialManager()->activeHandles());
+        gatherer->setCache(cache);
+        gatherer->run();
+
+        // THEN
+        QCOMPARE(gatherer->materialToPassAndParameter().size(), 1);
+        QCOMPARE(cache->size(), 1);
+
+        // WHEN
+        // Changes which don't mark the renderer dirty are not picked up
+        const auto handles = testAspect.nodeManagers()->techniqueManager()->activeHandles();
+        for (const auto handle : handles)
+            testAspect.nodeManagers()->techniqueManager()->data(handle)->setCompatibleWithRenderer(false);
+
+        Qt3DRender::Render::MaterialParameterGathererJobPtr cachedGatherer = testAspect.materialGathererJob();
+        cachedGatherer->setHandles(testAspect.nodeManagers()->materialManager()->activeHandles());
+        cachedGatherer->setCache(cache);
+        cachedGatherer->run();
+
+        // THEN
+        QCOMPARE(cachedGatherer->materialToPassAndParameter().size(), 1);
+        const QVector<Qt3DRender::Render::RenderPassParameterData> passesData = gatherer->materialToPassAndParameter().value(material.id());
+        const QVector<Qt3DRender::Render::RenderPassParameterData> cachedPassesData = cachedGatherer->materialToPassAndParameter().value(material.id());
+        QCOMPARE(cachedPassesData.size(), passesData.size());
+        for (int i = 0, m = passesData.size(); i < m; ++i)
+            QCOMPARE(cachedPassesData.at(i).pass, passesData.at(i).pass);
+
+        // WHEN
+        testAspect.renderer()->markDirty(Qt3DRender::Render::AbstractRenderer::MaterialDirty, nullptr);
+
+        // THEN
+        QCOMPARE(cache->size(), 0);
+
+        // WHEN
+        Qt3DRender::Render::MaterialParameterGathererJobPtr invalidatedGatherer = testAspect.materialGathererJob();
+        invalidatedGatherer->setHandles(testAspect.nodeManagers()->materialManager()->activeHandles());
+        invalidatedGatherer->setCache(cache);
+        invalidatedGatherer->run();
+
+        // THEN
+        QCOMPARE(invalidatedGatherer->materialToPassAndParameter().size(), 0);
+    }
 };
 
 QTEST_MAIN(tst_MaterialParameterGatherer)
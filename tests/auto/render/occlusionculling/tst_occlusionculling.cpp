@@ -0,0 +1,135 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QTest>
+#include <Qt3DRender/qocclusionculling.h>
+#include <Qt3DRender/qlayer.h>
+#include <Qt3DRender/private/qocclusionculling_p.h>
+#include <Qt3DRender/private/occlusionculling_p.h>
+#include <Qt3DCore/qpropertyupdatedchange.h>
+#include "qbackendnodetester.h"
+#include "testrenderer.h"
+
+class tst_OcclusionCulling : public Qt3DCore::QBackendNodeTester
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkInitialState()
+    {
+        // GIVEN
+        Qt3DRender::Render::OcclusionCulling backendOcclusionCulling;
+
+        // THEN
+        QCOMPARE(backendOcclusionCulling.nodeType(), Qt3DRender::Render::FrameGraphNode::OcclusionCulling);
+        QCOMPARE(backendOcclusionCulling.isEnabled(), false);
+        QVERIFY(backendOcclusionCulling.peerId().isNull());
+        QVERIFY(backendOcclusionCulling.occluderLayerId().isNull());
+        QCOMPARE(backendOcclusionCulling.depthBufferSize(), QSize(256, 128));
+    }
+
+    void checkInitializeFromPeer()
+    {
+        // GIVEN
+        Qt3DRender::QOcclusionCulling occlusionCulling;
+        Qt3DRender::QLayer layer;
+        occlusionCulling.setOccluderLayer(&layer);
+        occlusionCulling.setDepthBufferSize(QSize(64, 32));
+
+        {
+            // WHEN
+            Qt3DRender::Render::OcclusionCulling backendOcclusionCulling;
+            simulateInitialization(&occlusionCulling, &backendOcclusionCulling);
+
+            // THEN
+            QCOMPARE(backendOcclusionCulling.isEnabled(), true);
+            QCOMPARE(backendOcclusionCulling.peerId(), occlusionCulling.id());
+            QCOMPARE(backendOcclusionCulling.occluderLayerId(), layer.id());
+            QCOMPARE(backendOcclusionCulling.depthBufferSize(), QSize(64, 32));
+        }
+        {
+            // WHEN
+            Qt3DRender::Render::OcclusionCulling backendOcclusionCulling;
+            occlusionCulling.setEnabled(false);
+            simulateInitialization(&occlusionCulling, &backendOcclusionCulling);
+
+            // THEN
+            QCOMPARE(backendOcclusionCulling.peerId(), occlusionCulling.id());
+            QCOMPARE(backendOcclusionCulling.isEnabled(), false);
+        }
+    }
+
+    void checkSceneChangeEvents()
+    {
+        // GIVEN
+        Qt3DRender::Render::OcclusionCulling backendOcclusionCulling;
+        TestRenderer renderer;
+        backendOcclusionCulling.setRenderer(&renderer);
+
+        {
+             // WHEN
+             const bool newValue = false;
+             const auto change = Qt3DCore::QPropertyUpdatedChangePtr::create(Qt3DCore::QNodeId());
+             change->setPropertyName("enabled");
+             change->setValue(newValue);
+             backendOcclusionCulling.sceneChangeEvent(change);
+
+             // THEN
+            QCOMPARE(backendOcclusionCulling.isEnabled(), newValue);
+        }
+        {
+             // WHEN
+             const Qt3DCore::QNodeId newValue = Qt3DCore::QNodeId::createId();
+             const auto change = Qt3DCore::QPropertyUpdatedChangePtr::create(Qt3DCore::QNodeId());
+             change->setPropertyName("occluderLayer");
+             change->setValue(QVariant::fromValue(newValue));
+             backendOcclusionCulling.sceneChangeEvent(change);
+
+             // THEN
+            QCOMPARE(backendOcclusionCulling.occluderLayerId(), newValue);
+        }
+        {
+             // WHEN
+             const QSize newValue(512, 512);
+             const auto change = Qt3DCore::QPropertyUpdatedChangePtr::create(Qt3DCore::QNodeId());
+             change->setPropertyName("depthBufferSize");
+             change->setValue(newValue);
+             backendOcclusionCulling.sceneChangeEvent(change);
+
+             // THEN
+            QCOMPARE(backendOcclusionCulling.depthBufferSize(), newValue);
+        }
+    }
+
+};
+
+QTEST_MAIN(tst_OcclusionCulling)
+
+#include "tst_occlusionculling.moc"
@@ -0,0 +1,12 @@
+TEMPLATE = app
+
+TARGET = tst_occlusioncullingjob
+
+QT += core-private 3dcore 3dcore-private 3drender 3drender-private 3dextras testlib
+
+CONFIG += testcase
+
+SOURCES += tst_occlusioncullingjob.cpp
+
+include(../commons/commons.pri)
+include(../../core/common/common.pri)
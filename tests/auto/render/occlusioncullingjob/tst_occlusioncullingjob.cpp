@@ -0,0 +1,199 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QTest>
+#include <Qt3DCore/qentity.h>
+#include <Qt3DCore/qtransform.h>
+#include <Qt3DCore/private/qnodecreatedchangegenerator_p.h>
+#include <Qt3DRender/qlayer.h>
+#include <Qt3DRender/qrenderaspect.h>
+#include <Qt3DRender/private/qrenderaspect_p.h>
+#include <Qt3DRender/private/nodemanagers_p.h>
+#include <Qt3DRender/private/managers_p.h>
+#include <Qt3DRender/private/entity_p.h>
+#include <Qt3DRender/private/occlusioncullingjob_p.h>
+#include <Qt3DRender/private/updateworldtransformjob_p.h>
+#include <Qt3DRender/private/loadbufferjob_p.h>
+#include <Qt3DRender/private/buffermanager_p.h>
+#include <Qt3DRender/private/calcboundingvolumejob_p.h>
+#include <Qt3DRender/private/updateworldboundingvolumejob_p.h>
+#include <Qt3DExtras/qcuboidmesh.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+class TestAspect : public Qt3DRender::QRenderAspect
+{
+public:
+    TestAspect(Qt3DCore::QNode *root)
+        : Qt3DRender::QRenderAspect(Qt3DRender::QRenderAspect::Synchronous)
+    {
+        QRenderAspect::onRegistered();
+
+        const Qt3DCore::QNodeCreatedChangeGenerator generator(root);
+        const QVector<Qt3DCore::QNodeCreatedChangeBasePtr> creationChanges = generator.creationChanges();
+
+        d_func()->setRootAndCreateNodes(qobject_cast<Qt3DCore::QEntity *>(root), creationChanges);
+    }
+
+    ~TestAspect()
+    {
+        QRenderAspect::onUnregistered();
+    }
+
+    Qt3DRender::Render::NodeManagers *nodeManagers() const { return d_func()->m_renderer->nodeManagers(); }
+
+    Qt3DRender::Render::Entity *entity(Qt3DCore::QNodeId id) const
+    {
+        return nodeManagers()->renderNodesManager()->lookupResource(id);
+    }
+};
+
+} // namespace Qt3DRender
+
+QT_END_NAMESPACE
+
+namespace {
+
+Qt3DCore::QEntity *createCuboid(Qt3DCore::QEntity *parent, const QVector3D &extents, const QVector3D &translation)
+{
+    Qt3DCore::QEntity *entity = new Qt3DCore::QEntity(parent);
+    Qt3DExtras::QCuboidMesh *mesh = new Qt3DExtras::QCuboidMesh();
+    mesh->setXExtent(extents.x());
+    mesh->setYExtent(extents.y());
+    mesh->setZExtent(extents.z());
+    Qt3DCore::QTransform *transform = new Qt3DCore::QTransform();
+    transform->setTranslation(translation);
+    entity->addComponent(mesh);
+    entity->addComponent(transform);
+    return entity;
+}
+
+void runRequiredJobs(Qt3DRender::TestAspect *test, Qt3DRender::Render::Entity *root)
+{
+    Qt3DRender::Render::UpdateWorldTransformJob updateWorldTransform;
+    updateWorldTransform.setRoot(root);
+    updateWorldTransform.run();
+
+    const QVector<Qt3DRender::Render::HBuffer> bufferHandles = test->nodeManagers()->bufferManager()->activeHandles();
+    for (const auto bufferHandle : bufferHandles) {
+        Qt3DRender::Render::LoadBufferJob loadBuffer(bufferHandle);
+        loadBuffer.setNodeManager(test->nodeManagers());
+        loadBuffer.run();
+    }
+
+    Qt3DRender::Render::CalculateBoundingVolumeJob calcBVolume;
+    calcBVolume.setManagers(test->nodeManagers());
+    calcBVolume.setRoot(root);
+    calcBVolume.run();
+
+    Qt3DRender::Render::UpdateWorldBoundingVolumeJob updateWorldBVolume;
+    updateWorldBVolume.setManager(test->nodeManagers()->renderNodesManager());
+    updateWorldBVolume.run();
+}
+
+void runOcclusionCulling(Qt3DRender::Render::OcclusionCullingJob *job,
+                         QVector<Qt3DRender::Render::Entity *> &entities)
+{
+    job->run();
+    for (const auto rasterizerJob : job->rasterizerJobs())
+        rasterizerJob->run();
+    job->removeOccludedEntities(entities);
+}
+
+} // anonymous
+
+class tst_OcclusionCullingJob : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkEntitiesBehindOccluderAreRemoved()
+    {
+        // GIVEN -> a wall at the origin seen from z = 10, a cube hidden
+        // behind it and a cube on its side
+        QScopedPointer<Qt3DCore::QEntity> root(new Qt3DCore::QEntity());
+        Qt3DRender::QLayer *occluderLayer = new Qt3DRender::QLayer(root.data());
+        Qt3DCore::QEntity *wall = createCuboid(root.data(), QVector3D(4.0f, 4.0f, 0.1f), QVector3D());
+        wall->addComponent(occluderLayer);
+        Qt3DCore::QEntity *hidden = createCuboid(root.data(), QVector3D(1.0f, 1.0f, 1.0f), QVector3D(0.0f, 0.0f, -5.0f));
+        Qt3DCore::QEntity *visible = createCuboid(root.data(), QVector3D(1.0f, 1.0f, 1.0f), QVector3D(5.0f, 0.0f, -5.0f));
+
+        Qt3DRender::TestAspect test(root.data());
+        runRequiredJobs(&test, test.entity(root->id()));
+
+        QMatrix4x4 projection;
+        projection.perspective(45.0f, 1.0f, 0.1f, 100.0f);
+        QMatrix4x4 view;
+        view.lookAt(QVector3D(0.0f, 0.0f, 10.0f), QVector3D(), QVector3D(0.0f, 1.0f, 0.0f));
+
+        Qt3DRender::Render::OcclusionCullingJob job(2);
+        job.setManagers(test.nodeManagers());
+        job.setViewProjection(projection * view);
+        job.setDepthBufferSize(QSize(64, 64));
+        job.setOccluderLayerId(occluderLayer->id());
+        job.setActive(true);
+
+        Qt3DRender::Render::Entity *wallEntity = test.entity(wall->id());
+        Qt3DRender::Render::Entity *hiddenEntity = test.entity(hidden->id());
+        Qt3DRender::Render::Entity *visibleEntity = test.entity(visible->id());
+        const QVector<Qt3DRender::Render::Entity *> entities = { wallEntity, hiddenEntity, visibleEntity };
+
+        // WHEN
+        QVector<Qt3DRender::Render::Entity *> remainingEntities = entities;
+        runOcclusionCulling(&job, remainingEntities);
+
+        // THEN
+        QVERIFY(!job.rasterizerJobs().first()->triangles().isEmpty());
+        QCOMPARE(remainingEntities, QVector<Qt3DRender::Render::Entity *>() << wallEntity << visibleEntity);
+
+        // WHEN -> the layer isn't used by any entity
+        remainingEntities = entities;
+        job.setOccluderLayerId(Qt3DCore::QNodeId::createId());
+        runOcclusionCulling(&job, remainingEntities);
+
+        // THEN
+        QVERIFY(job.rasterizerJobs().first()->triangles().isEmpty());
+        QCOMPARE(remainingEntities, entities);
+
+        // WHEN -> inactive
+        remainingEntities = entities;
+        job.setOccluderLayerId(occluderLayer->id());
+        job.setActive(false);
+        runOcclusionCulling(&job, remainingEntities);
+
+        // THEN
+        QCOMPARE(remainingEntities, entities);
+    }
+};
+
+QTEST_MAIN(tst_OcclusionCullingJob)
+
+#include "tst_occlusioncullingjob.moc"
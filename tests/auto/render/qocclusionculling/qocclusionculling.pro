@@ -0,0 +1,12 @@
+TEMPLATE = app
+
+TARGET = tst_qocclusionculling
+
+QT += 3dcore 3dcore-private 3drender 3drender-private testlib
+
+CONFIG += testcase
+
+SOURCES += tst_qocclusionculling.cpp
+
+include(../../core/common/common.pri)
+include(../commons/commons.pri)
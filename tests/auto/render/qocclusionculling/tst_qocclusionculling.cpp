@@ -0,0 +1,228 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QTest>
+#include <Qt3DRender/qocclusionculling.h>
+#include <Qt3DRender/private/qocclusionculling_p.h>
+#include <Qt3DRender/qlayer.h>
+#include <QObject>
+#include <QSignalSpy>
+#include <Qt3DCore/qpropertyupdatedchange.h>
+#include <Qt3DCore/private/qnodecreatedchangegenerator_p.h>
+#include <Qt3DCore/qnodecreatedchange.h>
+#include "testpostmanarbiter.h"
+
+class tst_QOcclusionCulling : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkDefaultConstruction()
+    {
+        // GIVEN
+        Qt3DRender::QOcclusionCulling occlusionCulling;
+
+        // THEN
+        QVERIFY(occlusionCulling.occluderLayer() == nullptr);
+        QCOMPARE(occlusionCulling.depthBufferSize(), QSize(256, 128));
+    }
+
+    void checkPropertyChanges()
+    {
+        // GIVEN
+        Qt3DRender::QOcclusionCulling occlusionCulling;
+
+        {
+            // WHEN
+            QSignalSpy spy(&occlusionCulling, SIGNAL(occluderLayerChanged(QLayer *)));
+            Qt3DRender::QLayer newValue;
+            occlusionCulling.setOccluderLayer(&newValue);
+
+            // THEN
+            QVERIFY(spy.isValid());
+            QCOMPARE(occlusionCulling.occluderLayer(), &newValue);
+            QCOMPARE(spy.count(), 1);
+
+            // WHEN
+            spy.clear();
+            occlusionCulling.setOccluderLayer(&newValue);
+
+            // THEN
+            QCOMPARE(occlusionCulling.occluderLayer(), &newValue);
+            QCOMPARE(spy.count(), 0);
+        }
+        {
+            // WHEN
+            QSignalSpy spy(&occlusionCulling, SIGNAL(depthBufferSizeChanged(QSize)));
+            const QSize newValue(512, 256);
+            occlusionCulling.setDepthBufferSize(newValue);
+
+            // THEN
+            QVERIFY(spy.isValid());
+            QCOMPARE(occlusionCulling.depthBufferSize(), newValue);
+            QCOMPARE(spy.count(), 1);
+
+            // WHEN
+            spy.clear();
+            occlusionCulling.setDepthBufferSize(newValue);
+
+            // THEN
+            QCOMPARE(occlusionCulling.depthBufferSize(), newValue);
+            QCOMPARE(spy.count(), 0);
+        }
+    }
+
+    void checkOccluderLayerBookkeeping()
+    {
+        // GIVEN
+        QScopedPointer<Qt3DRender::QOcclusionCulling> occlusionCulling(new Qt3DRender::QOcclusionCulling);
+        {
+            // WHEN
+            Qt3DRender::QLayer layer;
+            occlusionCulling->setOccluderLayer(&layer);
+
+            // THEN
+            QCOMPARE(layer.parent(), occlusionCulling.data());
+            QCOMPARE(occlusionCulling->occluderLayer(), &layer);
+        }
+        // THEN (Should not crash and occluderLayer be unset)
+        QVERIFY(occlusionCulling->occluderLayer() == nullptr);
+    }
+
+    void checkCreationData()
+    {
+        // GIVEN
+        Qt3DRender::QOcclusionCulling occlusionCulling;
+        Qt3DRender::QLayer *layer = new Qt3DRender::QLayer();
+
+        occlusionCulling.setOccluderLayer(layer);
+        occlusionCulling.setDepthBufferSize(QSize(64, 32));
+
+        // WHEN
+        QVector<Qt3DCore::QNodeCreatedChangeBasePtr> creationChanges;
+
+        {
+            Qt3DCore::QNodeCreatedChangeGenerator creationChangeGenerator(&occlusionCulling);
+            creationChanges = creationChangeGenerator.creationChanges();
+        }
+
+        // THEN
+        {
+            QCOMPARE(creationChanges.size(), 2); // OcclusionCulling + Layer
+
+            const auto creationChangeData = qSharedPointerCast<Qt3DCore::QNodeCreatedChange<Qt3DRender::QOcclusionCullingData>>(creationChanges.first());
+            const Qt3DRender::QOcclusionCullingData cloneData = creationChangeData->data;
+
+            QCOMPARE(layer->id(), cloneData.occluderLayerId);
+            QCOMPARE(occlusionCulling.depthBufferSize(), cloneData.depthBufferSize);
+            QCOMPARE(occlusionCulling.id(), creationChangeData->subjectId());
+            QCOMPARE(occlusionCulling.isEnabled(), true);
+            QCOMPARE(occlusionCulling.isEnabled(), creationChangeData->isNodeEnabled());
+            QCOMPARE(occlusionCulling.metaObject(), creationChangeData->metaObject());
+        }
+
+        // WHEN
+        occlusionCulling.setEnabled(false);
+
+        {
+            Qt3DCore::QNodeCreatedChangeGenerator creationChangeGenerator(&occlusionCulling);
+            creationChanges = creationChangeGenerator.creationChanges();
+        }
+
+        // THEN
+        {
+            QCOMPARE(creationChanges.size(), 2); // OcclusionCulling + Layer
+
+            const auto creationChangeData = qSharedPointerCast<Qt3DCore::QNodeCreatedChange<Qt3DRender::QOcclusionCullingData>>(creationChanges.first());
+            const Qt3DRender::QOcclusionCullingData cloneData = creationChangeData->data;
+
+            QCOMPARE(layer->id(), cloneData.occluderLayerId);
+            QCOMPARE(occlusionCulling.depthBufferSize(), cloneData.depthBufferSize);
+            QCOMPARE(occlusionCulling.id(), creationChangeData->subjectId());
+            QCOMPARE(occlusionCulling.isEnabled(), false);
+            QCOMPARE(occlusionCulling.isEnabled(), creationChangeData->isNodeEnabled());
+            QCOMPARE(occlusionCulling.metaObject(), creationChangeData->metaObject());
+        }
+    }
+
+    void checkPropertyUpdates()
+    {
+        // GIVEN
+        TestArbiter arbiter;
+        Qt3DRender::QOcclusionCulling occlusionCulling;
+        arbiter.setArbiterOnNode(&occlusionCulling);
+
+        {
+            // WHEN
+            Qt3DRender::QLayer *layer = new Qt3DRender::QLayer(&occlusionCulling);
+            QCoreApplication::processEvents();
+            arbiter.events.clear();
+
+            occlusionCulling.setOccluderLayer(layer);
+            QCoreApplication::processEvents();
+
+            // THEN
+            QCOMPARE(arbiter.events.size(), 1);
+            auto change = arbiter.events.first().staticCast<Qt3DCore::QPropertyUpdatedChange>();
+            QCOMPARE(change->propertyName(), "occluderLayer");
+            QCOMPARE(change->value().value<Qt3DCore::QNodeId>(), layer->id());
+            QCOMPARE(change->type(), Qt3DCore::PropertyUpdated);
+
+            arbiter.events.clear();
+        }
+        {
+            // WHEN
+            occlusionCulling.setDepthBufferSize(QSize(128, 128));
+            QCoreApplication::processEvents();
+
+            // THEN
+            QCOMPARE(arbiter.events.size(), 1);
+            auto change = arbiter.events.first().staticCast<Qt3DCore::QPropertyUpdatedChange>();
+            QCOMPARE(change->propertyName(), "depthBufferSize");
+            QCOMPARE(change->value().toSize(), occlusionCulling.depthBufferSize());
+            QCOMPARE(change->type(), Qt3DCore::PropertyUpdated);
+
+            arbiter.events.clear();
+        }
+        {
+            // WHEN
+            occlusionCulling.setDepthBufferSize(QSize(128, 128));
+            QCoreApplication::processEvents();
+
+            // THEN
+            QCOMPARE(arbiter.events.size(), 0);
+        }
+    }
+
+};
+
+QTEST_MAIN(tst_QOcclusionCulling)
+
+#include "tst_qocclusionculling.moc"
@@ -61,6 +61,7 @@ private Q_SLOTS:
         // THEN
         QVERIFY(renderSettings.pickingSettings() != nullptr);
         QCOMPARE(renderSettings.renderPolicy(),  Qt3DRender::QRenderSettings::Always);
+        QCOMPARE(renderSettings.textureMemoryBudget(), 0);
         QVERIFY(renderSettings.activeFrameGraph() == nullptr);
         QCOMPARE(renderSettings.pickingSettings()->pickMethod(), Qt3DRender::QPickingSettings::BoundingVolumePicking);
         QCOMPARE(renderSettings.pickingSettings()->pickResultMode(), Qt3DRender::QPickingSettings::NearestPick);
@@ -92,6 +93,32 @@ private Q_SLOTS:
             QCOMPARE(renderSettings.renderPolicy(), newValue);
             QCOMPARE(spy.count(), 0);
         }
+        {
+            // WHEN
+            QSignalSpy spy(&renderSettings, SIGNAL(textureMemoryBudgetChanged(int)));
+            const int newValue = 512;
+            renderSettings.setTextureMemoryBudget(newValue);
+
+            // THEN
+            QVERIFY(spy.isValid());
+            QCOMPARE(renderSettings.textureMemoryBudget(), newValue);
+            QCOMPARE(spy.count(), 1);
+
+            // WHEN
+            spy.clear();
+            renderSettings.setTextureMemoryBudget(newValue);
+
+            // THEN
+            QCOMPARE(renderSettings.textureMemoryBudget(), newValue);
+            QCOMPARE(spy.count(), 0);
+
+            // WHEN
+            renderSettings.setTextureMemoryBudget(-1);
+
+            // THEN
+            QCOMPARE(renderSettings.textureMemoryBudget(), 0);
+            QCOMPARE(spy.count(), 1);
+        }
         {
             // WHEN
             QSignalSpy spy(&renderSettings, SIGNAL(activeFrameGraphChanged(QFrameGraphNode *)));
@@ -180,6 +207,7 @@ private Q_SLOTS:
         Qt3DRender::QViewport frameGraphRoot;
 
         renderSettings.setRenderPolicy(Qt3DRender::QRenderSettings::OnDemand);
+        renderSettings.setTextureMemoryBudget(256);
         renderSettings.setActiveFrameGraph(&frameGraphRoot);
         pickingSettings->setPickMethod(Qt3DRender::QPickingSettings::TrianglePicking);
         pickingSettings->setPickResultMode(Qt3DRender::QPickingSettings::AllPicks);
@@ -204,6 +232,7 @@ private Q_SLOTS:
             QCOMPARE(renderSettings.pickingSettings()->pickResultMode(), cloneData.pickResultMode);
             QCOMPARE(renderSettings.pickingSettings()->faceOrientationPickingMode(), cloneData.faceOrientationPickingMode);
             QCOMPARE(renderSettings.renderPolicy(), cloneData.renderPolicy);
+            QCOMPARE(renderSettings.textureMemoryBudget(), cloneData.textureMemoryBudget);
             QCOMPARE(renderSettings.activeFrameGraph()->id(), cloneData.activeFrameGraphId);
             QCOMPARE(renderSettings.id(), creationChangeData->subjectId());
             QCOMPARE(renderSettings.isEnabled(), true);
@@ -230,6 +259,7 @@ private Q_SLOTS:
             QCOMPARE(renderSettings.pickingSettings()->pickResultMode(), cloneData.pickResultMode);
             QCOMPARE(renderSettings.pickingSettings()->faceOrientationPickingMode(), cloneData.faceOrientationPickingMode);
             QCOMPARE(renderSettings.renderPolicy(), cloneData.renderPolicy);
+            QCOMPARE(renderSettings.textureMemoryBudget(), cloneData.textureMemoryBudget);
             QCOMPARE(renderSettings.activeFrameGraph()->id(), cloneData.activeFrameGraphId);
             QCOMPARE(renderSettings.id(), creationChangeData->subjectId());
             QCOMPARE(renderSettings.isEnabled(), false);
@@ -271,6 +301,39 @@ private Q_SLOTS:
 
     }
 
+    void checkTextureMemoryBudgetUpdate()
+    {
+        // GIVEN
+        TestArbiter arbiter;
+        Qt3DRender::QRenderSettings renderSettings;
+        arbiter.setArbiterOnNode(&renderSettings);
+
+        {
+            // WHEN
+            renderSettings.setTextureMemoryBudget(128);
+            QCoreApplication::processEvents();
+
+            // THEN
+            QCOMPARE(arbiter.events.size(), 1);
+            auto change = arbiter.events.first().staticCast<Qt3DCore::QPropertyUpdatedChange>();
+            QCOMPARE(change->propertyName(), "textureMemoryBudget");
+            QCOMPARE(change->value().toInt(), renderSettings.textureMemoryBudget());
+            QCOMPARE(change->type(), Qt3DCore::PropertyUpdated);
+
+            arbiter.events.clear();
+        }
+
+        {
+            // WHEN
+            renderSettings.setTextureMemoryBudget(128);
+            QCoreApplication::processEvents();
+
+            // THEN
+            QCOMPARE(arbiter.events.size(), 0);
+        }
+
+    }
+
     void checkActiveFrameGraphUpdate()
     {
         // GIVEN
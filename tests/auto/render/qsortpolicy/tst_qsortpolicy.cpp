@@ -52,21 +52,28 @@ private Q_SLOTS:
         QScopedPointer<Qt3DRender::QSortPolicy> defaultsortPolicy(new Qt3DRender::QSortPolicy);
 
         QVERIFY(defaultsortPolicy->sortTypes().isEmpty());
+        QCOMPARE(defaultsortPolicy->isInstancingEnabled(), false);
     }
 
     void checkCloning_data()
     {
         QTest::addColumn<Qt3DRender::QSortPolicy *>("sortPolicy");
         QTest::addColumn<QVector<Qt3DRender::QSortPolicy::SortType> >("sortTypes");
+        QTest::addColumn<bool>("instancingEnabled");
 
         Qt3DRender::QSortPolicy *defaultConstructed = new Qt3DRender::QSortPolicy();
-        QTest::newRow("defaultConstructed") << defaultConstructed << QVector<Qt3DRender::QSortPolicy::SortType>();
+        QTest::newRow("defaultConstructed") << defaultConstructed << QVector<Qt3DRender::QSortPolicy::SortType>() << false;
 
         Qt3DRender::QSortPolicy *sortPolicyWithSortTypes = new Qt3DRender::QSortPolicy();
         auto sortTypes = QVector<Qt3DRender::QSortPolicy::SortType>() << Qt3DRender::QSortPolicy::BackToFront
                                                                       << Qt3DRender::QSortPolicy::Material;
         sortPolicyWithSortTypes->setSortTypes(sortTypes);
-        QTest::newRow("sortPolicyWithSortTypes") << sortPolicyWithSortTypes << sortTypes ;
+        QTest::newRow("sortPolicyWithSortTypes") << sortPolicyWithSortTypes << sortTypes << false;
+
+        Qt3DRender::QSortPolicy *sortPolicyWithInstancing = new Qt3DRender::QSortPolicy();
+        sortPolicyWithInstancing->setSortTypes(sortTypes);
+        sortPolicyWithInstancing->setInstancingEnabled(true);
+        QTest::newRow("sortPolicyWithInstancing") << sortPolicyWithInstancing << sortTypes << true;
     }
 
     void checkCloning()
@@ -74,9 +81,11 @@ private Q_SLOTS:
         // GIVEN
         QFETCH(Qt3DRender::QSortPolicy*, sortPolicy);
         QFETCH(QVector<Qt3DRender::QSortPolicy::SortType>, sortTypes);
+        QFETCH(bool, instancingEnabled);
 
         // THEN
         QCOMPARE(sortPolicy->sortTypes(), sortTypes);
+        QCOMPARE(sortPolicy->isInstancingEnabled(), instancingEnabled);
 
         // WHEN
         Qt3DCore::QNodeCreatedChangeGenerator creationChangeGenerator(sortPolicy);
@@ -94,6 +103,7 @@ private Q_SLOTS:
         QCOMPARE(sortPolicy->metaObject(), creationChangeData->metaObject());
         QCOMPARE(sortPolicy->sortTypes().count(), cloneData.sortTypes.count());
         QCOMPARE(sortPolicy->sortTypes(), cloneData.sortTypes);
+        QCOMPARE(sortPolicy->isInstancingEnabled(), cloneData.instancingEnabled);
 
         delete sortPolicy;
     }
@@ -122,6 +132,26 @@ private Q_SLOTS:
         QCOMPARE(change->type(), Qt3DCore::PropertyUpdated);
 
         arbiter.events.clear();
+
+        // WHEN
+        sortPolicy->setInstancingEnabled(true);
+        QCoreApplication::processEvents();
+
+        // THEN
+        QCOMPARE(arbiter.events.size(), 1);
+        change = arbiter.events.first().staticCast<Qt3DCore::QPropertyUpdatedChange>();
+        QCOMPARE(change->propertyName(), "instancingEnabled");
+        QCOMPARE(change->value().toBool(), true);
+        QCOMPARE(change->type(), Qt3DCore::PropertyUpdated);
+
+        arbiter.events.clear();
+
+        // WHEN
+        sortPolicy->setInstancingEnabled(true);
+        QCoreApplication::processEvents();
+
+        // THEN
+        QCOMPARE(arbiter.events.size(), 0);
     }
 };
 
@@ -53,6 +53,8 @@ qtConfig(private_tests) {
         triangleboundingvolume \
         ddstextures \
         shadercache \
+        shaderbinarycache \
+        glstateshadow \
         layerfiltering \
         filterentitybycomponent \
         genericlambdajob \
@@ -70,6 +72,7 @@ qtConfig(private_tests) {
         graphicshelpergl3_3 \
         graphicshelpergl3_2 \
         graphicshelpergl2 \
+        graphicscontext \
         gltfplugins \
         pickboundingvolumejob \
         sendrendercapturejob \
@@ -84,6 +87,7 @@ qtConfig(private_tests) {
         updatemeshtrianglelistjob \
         updateshaderdatatransformjob \
         texturedatamanager \
+        textureresidencypolicy \
         rendertarget \
         transform \
         computecommand \
@@ -108,7 +112,11 @@ qtConfig(private_tests) {
         qscene2d \
         scene2d \
         coordinatereader \
-        framegraphvisitor
+        framegraphvisitor \
+        qocclusionculling \
+        occlusionculling \
+        softwaredepthbuffer \
+        occlusioncullingjob
 
     !macos: SUBDIRS += graphicshelpergl4
 }
@@ -46,9 +46,12 @@
 #include <Qt3DRender/qcameraselector.h>
 #include <Qt3DRender/qcamera.h>
 #include <Qt3DRender/qlayer.h>
+#include <Qt3DRender/qocclusionculling.h>
 #include <Qt3DRender/private/qrenderaspect_p.h>
 #include <Qt3DRender/private/nodemanagers_p.h>
 #include <Qt3DRender/private/managers_p.h>
+#include <Qt3DRender/private/rendercommand_p.h>
+#include <Qt3DRender/private/sphere_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -198,8 +201,11 @@ private Q_SLOTS:
         QVERIFY(!renderViewBuilder.setClearDrawBufferIndexJob().isNull());
         QCOMPARE(renderViewBuilder.renderViewBuilderJobs().size(), Qt3DRender::Render::RenderViewBuilder::optimalJobCount());
         QCOMPARE(renderViewBuilder.materialGathererJobs().size(), Qt3DRender::Render::RenderViewBuilder::optimalJobCount());
+        QCOMPARE(renderViewBuilder.frustumCullingJob()->chunkJobs().size(), Qt3DRender::Render::RenderViewBuilder::optimalJobCount());
+        QVERIFY(!renderViewBuilder.occlusionCullingJob().isNull());
+        QCOMPARE(renderViewBuilder.occlusionCullingJob()->rasterizerJobs().size(), Qt3DRender::Render::RenderViewBuilder::optimalJobCount());
 
-        QCOMPARE(renderViewBuilder.buildJobHierachy().size(), 11 + 2 * Qt3DRender::Render::RenderViewBuilder::optimalJobCount());
+        QCOMPARE(renderViewBuilder.buildJobHierachy().size(), 9 + 4 * Qt3DRender::Render::RenderViewBuilder::optimalJobCount());
     }
 
     void checkCheckJobDependencies()
@@ -252,7 +258,13 @@ private Q_SLOTS:
         QVERIFY(renderViewBuilder.frustumCullingJob()->dependencies().contains(renderViewBuilder.syncFrustumCullingJob()));
         QVERIFY(renderViewBuilder.frustumCullingJob()->dependencies().contains(testAspect.renderer()->expandBoundingVolumeJob()));
 
-        QCOMPARE(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().size(), renderViewBuilder.materialGathererJobs().size() + 6);
+        QCOMPARE(renderViewBuilder.occlusionCullingJob()->dependencies().size(), 3);
+        QVERIFY(renderViewBuilder.occlusionCullingJob()->dependencies().contains(renderViewBuilder.syncFrustumCullingJob()));
+        QVERIFY(renderViewBuilder.occlusionCullingJob()->dependencies().contains(testAspect.renderer()->updateTreeEnabledJob()));
+        QVERIFY(renderViewBuilder.occlusionCullingJob()->dependencies().contains(testAspect.renderer()->expandBoundingVolumeJob()));
+
+        QCOMPARE(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().size(), renderViewBuilder.materialGathererJobs().size() + renderViewBuilder.frustumCullingJob()->chunkJobs().size()
+                 + renderViewBuilder.occlusionCullingJob()->rasterizerJobs().size() + 7);
         QVERIFY(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().contains(renderViewBuilder.syncRenderViewInitializationJob()));
         QVERIFY(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().contains(renderViewBuilder.renderableEntityFilterJob()));
         QVERIFY(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().contains(renderViewBuilder.computableEntityFilterJob()));
@@ -262,6 +274,17 @@ private Q_SLOTS:
         for (const auto materialGatherer : renderViewBuilder.materialGathererJobs()) {
             QVERIFY(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().contains(materialGatherer));
         }
+        for (const auto frustumCullingChunkJob : renderViewBuilder.frustumCullingJob()->chunkJobs()) {
+            QCOMPARE(frustumCullingChunkJob->dependencies().size(), 1);
+            QCOMPARE(frustumCullingChunkJob->dependencies().first().data(), renderViewBuilder.frustumCullingJob().data());
+            QVERIFY(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().contains(frustumCullingChunkJob));
+        }
+        QVERIFY(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().contains(renderViewBuilder.occlusionCullingJob()));
+        for (const auto occlusionRasterizerJob : renderViewBuilder.occlusionCullingJob()->rasterizerJobs()) {
+            QCOMPARE(occlusionRasterizerJob->dependencies().size(), 1);
+            QCOMPARE(occlusionRasterizerJob->dependencies().first().data(), renderViewBuilder.occlusionCullingJob().data());
+            QVERIFY(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().contains(occlusionRasterizerJob));
+        }
 
         // Step 5
         for (const auto renderViewBuilderJob : renderViewBuilder.renderViewBuilderJobs()) {
@@ -276,6 +299,72 @@ private Q_SLOTS:
         }
     }
 
+    void checkEntityFilteringJobsAreShared()
+    {
+        // GIVEN
+        Qt3DRender::QViewport *viewport = new Qt3DRender::QViewport();
+        Qt3DRender::QClearBuffers *clearBuffer = new Qt3DRender::QClearBuffers(viewport);
+        Qt3DRender::QClearBuffers *clearBuffer2 = new Qt3DRender::QClearBuffers(viewport);
+        Qt3DRender::TestAspect testAspect(buildSimpleScene(viewport));
+
+        // THEN
+        Qt3DRender::Render::FrameGraphNode *leafNode = testAspect.nodeManagers()->frameGraphManager()->lookupNode(clearBuffer->id());
+        Qt3DRender::Render::FrameGraphNode *leafNode2 = testAspect.nodeManagers()->frameGraphManager()->lookupNode(clearBuffer2->id());
+        QVERIFY(leafNode != nullptr);
+        QVERIFY(leafNode2 != nullptr);
+
+        // WHEN
+        Qt3DRender::Render::RenderViewBuilder renderViewBuilder(leafNode, 0, testAspect.renderer());
+        Qt3DRender::Render::RenderViewBuilder renderViewBuilder2(leafNode2, 1, testAspect.renderer());
+        const QVector<Qt3DCore::QAspectJobPtr> jobs = renderViewBuilder.buildJobHierachy() + renderViewBuilder2.buildJobHierachy();
+
+        // THEN
+        QCOMPARE(renderViewBuilder.renderableEntityFilterJob().data(), testAspect.renderer()->renderableEntityFilterJob().data());
+        QCOMPARE(renderViewBuilder2.renderableEntityFilterJob().data(), testAspect.renderer()->renderableEntityFilterJob().data());
+        QCOMPARE(renderViewBuilder.computableEntityFilterJob().data(), testAspect.renderer()->computableEntityFilterJob().data());
+        QCOMPARE(renderViewBuilder2.computableEntityFilterJob().data(), testAspect.renderer()->computableEntityFilterJob().data());
+        QCOMPARE(renderViewBuilder.lightGathererJob().data(), testAspect.renderer()->lightGathererJob().data());
+        QCOMPARE(renderViewBuilder2.lightGathererJob().data(), testAspect.renderer()->lightGathererJob().data());
+
+        // The shared jobs are scheduled by the Renderer, not by each RenderView
+        QVERIFY(!jobs.contains(testAspect.renderer()->renderableEntityFilterJob()));
+        QVERIFY(!jobs.contains(testAspect.renderer()->computableEntityFilterJob()));
+        QVERIFY(!jobs.contains(testAspect.renderer()->lightGathererJob()));
+        QVERIFY(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().contains(testAspect.renderer()->renderableEntityFilterJob()));
+        QVERIFY(renderViewBuilder2.syncRenderCommandBuildingJob()->dependencies().contains(testAspect.renderer()->renderableEntityFilterJob()));
+    }
+
+    void checkPrepareJobsForReuse()
+    {
+        // GIVEN
+        Qt3DRender::QViewport *viewport = new Qt3DRender::QViewport();
+        Qt3DRender::QClearBuffers *clearBuffer = new Qt3DRender::QClearBuffers(viewport);
+        Qt3DRender::TestAspect testAspect(buildSimpleScene(viewport));
+
+        // THEN
+        Qt3DRender::Render::FrameGraphNode *leafNode = testAspect.nodeManagers()->frameGraphManager()->lookupNode(clearBuffer->id());
+        QVERIFY(leafNode != nullptr);
+
+        // WHEN
+        Qt3DRender::Render::RenderViewBuilder renderViewBuilder(leafNode, 0, testAspect.renderer());
+        const QVector<Qt3DCore::QAspectJobPtr> jobs = renderViewBuilder.buildJobHierachy();
+        renderViewBuilder.prepareJobs();
+        renderViewBuilder.prepareJobs();
+
+        // THEN
+        int materialHandleCount = 0;
+        for (const auto materialGatherer : renderViewBuilder.materialGathererJobs())
+            materialHandleCount += materialGatherer->handles().size();
+        QCOMPARE(materialHandleCount, testAspect.nodeManagers()->materialManager()->activeHandles().size());
+
+        // Dependencies are only wired once
+        QCOMPARE(renderViewBuilder.syncRenderViewInitializationJob()->dependencies().size(), 1);
+        QCOMPARE(renderViewBuilder.syncRenderCommandBuildingJob()->dependencies().size(), renderViewBuilder.materialGathererJobs().size() + renderViewBuilder.frustumCullingJob()->chunkJobs().size()
+                 + renderViewBuilder.occlusionCullingJob()->rasterizerJobs().size() + 7);
+        QCOMPARE(renderViewBuilder.syncRenderViewCommandBuildersJob()->dependencies().size(), renderViewBuilder.renderViewBuilderJobs().size());
+        QCOMPARE(jobs.size(), 9 + 4 * Qt3DRender::Render::RenderViewBuilder::optimalJobCount());
+    }
+
     void checkRenderViewJobExecution()
     {
         // GIVEN
@@ -296,6 +385,55 @@ private Q_SLOTS:
         QVERIFY(renderViewBuilder.renderViewJob()->renderView() != nullptr);
     }
 
+    void checkRenderViewBuilderJobWithNoDraw()
+    {
+        // GIVEN
+        Qt3DRender::QViewport *viewport = new Qt3DRender::QViewport();
+        Qt3DRender::QClearBuffers *clearBuffer = new Qt3DRender::QClearBuffers(viewport);
+        Qt3DRender::TestAspect testAspect(buildSimpleScene(viewport));
+
+        // THEN
+        Qt3DRender::Render::FrameGraphNode *leafNode = testAspect.nodeManagers()->frameGraphManager()->lookupNode(clearBuffer->id());
+        QVERIFY(leafNode != nullptr);
+
+        // WHEN
+        Qt3DRender::Render::RenderViewBuilder renderViewBuilder(leafNode, 0, testAspect.renderer());
+        renderViewBuilder.buildJobHierachy();
+        renderViewBuilder.renderViewJob()->run();
+        renderViewBuilder.renderableEntityFilterJob()->run();
+
+        Qt3DRender::Render::RenderView *renderView = renderViewBuilder.renderViewJob()->renderView();
+        const Qt3DRender::Render::RenderViewBuilderJobPtr builderJob = renderViewBuilder.renderViewBuilderJobs().first();
+        builderJob->setRenderView(renderView);
+        builderJob->setRenderables(renderViewBuilder.renderableEntityFilterJob()->filteredEntities());
+        builderJob->run();
+        const int commandCount = builderJob->commands().size();
+
+        // Commands built on a previous frame and not taken by the RenderView
+        Qt3DRender::Render::RenderCommand previousCommand;
+        builderJob->commands().push_back(&previousCommand);
+
+        renderView->setNoDraw(true);
+        builderJob->run();
+
+        // THEN
+        QVERIFY(builderJob->commands().isEmpty());
+
+        // WHEN
+        renderView->setNoDraw(false);
+        builderJob->run();
+
+        // THEN
+        QCOMPARE(builderJob->commands().size(), commandCount);
+
+        // WHEN
+        renderView->setNoDraw(true);
+        builderJob->run();
+
+        // THEN
+        QVERIFY(builderJob->commands().isEmpty());
+    }
+
     void checkRenderableEntitiesFilteringExecution()
     {
         // GIVEN
@@ -381,6 +519,57 @@ private Q_SLOTS:
         }
     }
 
+    void checkSyncOcclusionCullingInitializationExecution()
+    {
+        // GIVEN
+        Qt3DRender::QViewport *viewport = new Qt3DRender::QViewport();
+        Qt3DRender::QClearBuffers *clearBuffer = new Qt3DRender::QClearBuffers(viewport);
+        Qt3DRender::QOcclusionCulling *occlusionCulling = new Qt3DRender::QOcclusionCulling(clearBuffer);
+        Qt3DRender::QCameraSelector *cameraSelector = new Qt3DRender::QCameraSelector(occlusionCulling);
+        Qt3DRender::QCamera *camera = new Qt3DRender::QCamera();
+        Qt3DRender::QLayer *occluderLayer = new Qt3DRender::QLayer();
+        cameraSelector->setCamera(camera);
+        occlusionCulling->setOccluderLayer(occluderLayer);
+        occlusionCulling->setDepthBufferSize(QSize(128, 64));
+
+        Qt3DRender::TestAspect testAspect(buildSimpleScene(viewport));
+
+        // THEN
+        Qt3DRender::Render::FrameGraphNode *leafNode = testAspect.nodeManagers()->frameGraphManager()->lookupNode(cameraSelector->id());
+        QVERIFY(leafNode != nullptr);
+
+        // WHEN
+        Qt3DRender::Render::RenderViewBuilder renderViewBuilder(leafNode, 0, testAspect.renderer());
+        renderViewBuilder.buildJobHierachy();
+
+        // THEN
+        QCOMPARE(renderViewBuilder.occlusionCullingJob()->isActive(), false);
+
+        // WHEN
+        renderViewBuilder.renderViewJob()->run();
+        renderViewBuilder.syncRenderViewInitializationJob()->run();
+        renderViewBuilder.syncFrustumCullingJob()->run();
+
+        // THEN
+        QCOMPARE(renderViewBuilder.occlusionCullingJob()->isActive(), true);
+        QCOMPARE(renderViewBuilder.occlusionCullingJob()->occluderLayerId(), occluderLayer->id());
+        QCOMPARE(renderViewBuilder.occlusionCullingJob()->depthBufferSize(), QSize(128, 64));
+        QCOMPARE(renderViewBuilder.occlusionCullingJob()->viewProjection(), camera->projectionMatrix() * camera->viewMatrix());
+
+        // WHEN -> no entity has the occluder layer
+        renderViewBuilder.occlusionCullingJob()->run();
+
+        // THEN
+        QCOMPARE(renderViewBuilder.occlusionCullingJob()->depthBuffer()->size(), QSize(128, 64));
+        int rowCount = 0;
+        for (const auto occlusionRasterizerJob : renderViewBuilder.occlusionCullingJob()->rasterizerJobs()) {
+            QCOMPARE(occlusionRasterizerJob->firstRow(), rowCount);
+            QVERIFY(occlusionRasterizerJob->triangles().isEmpty());
+            rowCount = occlusionRasterizerJob->lastRow();
+        }
+        QCOMPARE(rowCount, 64);
+    }
+
     void checkSyncFrustumCullingExecution()
     {
         // GIVEN
@@ -412,6 +601,90 @@ private Q_SLOTS:
         QCOMPARE(renderViewBuilder.frustumCullingJob()->viewProjection(), camera->projectionMatrix() * camera->viewMatrix());
     }
 
+    void checkChunkedFrustumCullingExecution()
+    {
+        // GIVEN
+        Qt3DRender::QViewport *viewport = new Qt3DRender::QViewport();
+        Qt3DRender::QClearBuffers *clearBuffer = new Qt3DRender::QClearBuffers(viewport);
+        Qt3DRender::QLayerFilter *layerFilter = new Qt3DRender::QLayerFilter(clearBuffer);
+        Qt3DRender::QLayer *layer = new Qt3DRender::QLayer();
+        layerFilter->addLayer(layer);
+        Qt3DCore::QEntity *root = buildEntityFilterTestScene(viewport, layer);
+        Qt3DRender::TestAspect testAspect(root);
+
+        // THEN
+        Qt3DRender::Render::FrameGraphNode *leafNode = testAspect.nodeManagers()->frameGraphManager()->lookupNode(layerFilter->id());
+        QVERIFY(leafNode != nullptr);
+
+        // WHEN
+        Qt3DRender::Render::RenderViewBuilder renderViewBuilder(leafNode, 0, testAspect.renderer());
+        renderViewBuilder.buildJobHierachy();
+
+        const Qt3DRender::Render::FrustumCullingJobPtr frustumCullingJob = renderViewBuilder.frustumCullingJob();
+        frustumCullingJob->setRoot(testAspect.nodeManagers()->renderNodesManager()->lookupResource(root->id()));
+        frustumCullingJob->setActive(true);
+        frustumCullingJob->run();
+        for (const auto frustumCullingChunkJob : frustumCullingJob->chunkJobs())
+            frustumCullingChunkJob->run();
+
+        // THEN -> all entities are within the identity frustum
+        const QVector<Qt3DRender::Render::Entity *> visibleEntities = frustumCullingJob->visibleEntities();
+        QCOMPARE(visibleEntities.size(), testAspect.nodeManagers()->renderNodesManager()->activeHandles().size());
+
+        // WHEN
+        frustumCullingJob->run();
+        for (const auto frustumCullingChunkJob : frustumCullingJob->chunkJobs())
+            frustumCullingChunkJob->run();
+
+        // THEN -> the concatenated result is stable across frames
+        QCOMPARE(frustumCullingJob->visibleEntities(), visibleEntities);
+
+        // WHEN
+        Qt3DRender::Render::Entity *rootEntity = testAspect.nodeManagers()->renderNodesManager()->lookupResource(root->id());
+        const QVector<Qt3DRender::Render::Entity *> children = rootEntity->children();
+        QVector<Qt3DRender::Render::Entity *> expectedVisibleEntities;
+        expectedVisibleEntities.push_back(rootEntity);
+        for (int i = 0, m = children.size(); i < m; ++i) {
+            // Move every third entity out of the identity frustum
+            if (i % 3 == 0)
+                children.at(i)->worldBoundingVolumeWithChildren()->setCenter(QVector3D(10.0f, 0.0f, 0.0f));
+            else
+                expectedVisibleEntities.push_back(children.at(i));
+        }
+
+        // Enough chunks for the culled entities to be spread across all of them
+        Qt3DRender::Render::FrustumCullingJob chunkedFrustumCullingJob(4);
+        chunkedFrustumCullingJob.setRoot(rootEntity);
+        chunkedFrustumCullingJob.setActive(true);
+        chunkedFrustumCullingJob.run();
+        for (const auto frustumCullingChunkJob : chunkedFrustumCullingJob.chunkJobs())
+            frustumCullingChunkJob->run();
+
+        // THEN
+        for (const auto frustumCullingChunkJob : chunkedFrustumCullingJob.chunkJobs()) {
+            QVERIFY(!frustumCullingChunkJob->visibleEntities().isEmpty());
+            QVERIFY(frustumCullingChunkJob->visibleEntities().size() < frustumCullingChunkJob->roots().size());
+        }
+        QCOMPARE(chunkedFrustumCullingJob.visibleEntities(), expectedVisibleEntities);
+
+        // WHEN
+        frustumCullingJob->run();
+        for (const auto frustumCullingChunkJob : frustumCullingJob->chunkJobs())
+            frustumCullingChunkJob->run();
+
+        // THEN -> same result whatever the chunk count
+        QCOMPARE(frustumCullingJob->visibleEntities(), expectedVisibleEntities);
+
+        // WHEN
+        frustumCullingJob->setActive(false);
+        frustumCullingJob->run();
+        for (const auto frustumCullingChunkJob : frustumCullingJob->chunkJobs())
+            frustumCullingChunkJob->run();
+
+        // THEN
+        QVERIFY(frustumCullingJob->visibleEntities().isEmpty());
+    }
+
     void checkRemoveEntitiesNotInSubset()
     {
         // GIVEN
@@ -34,6 +34,8 @@
 #include <private/memorybarrier_p.h>
 #include <private/renderviewjobutils_p.h>
 #include <private/rendercommand_p.h>
+#include <private/stringtoint_p.h>
+#include <private/managers_p.h>
 #include <testpostmanarbiter.h>
 
 QT_BEGIN_NAMESPACE
@@ -83,6 +85,8 @@ private Q_SLOTS:
 
         // THEN
         QCOMPARE(renderView.memoryBarrier(), QMemoryBarrier::None);
+        QCOMPARE(renderView.occlusionCulling(), false);
+        QVERIFY(renderView.occluderLayerId().isNull());
     }
 
     void checkMemoryBarrierInitialization()
@@ -313,7 +317,326 @@ private Q_SLOTS:
         // RenderCommands are deleted by RenderView dtor
     }
 
+    void checkInstancableCommandsMerging()
+    {
+        // GIVEN
+        RenderView renderView;
+        QVector<RenderCommand *> rawCommands;
+        const int colorNameId = StringToInt::lookupId(QLatin1String("color"));
+        const int modelMatrixNameId = StringToInt::lookupId(QLatin1String("modelMatrix"));
+
+        for (int i = 0; i < 10; ++i) {
+            QMatrix4x4 transform;
+            transform.translate(float(i), 0.0f, 0.0f);
+            RenderCommand *c = createInstancableCommand(transform);
+            c->m_parameterPack.setUniform(colorNameId, UniformValue(QVector3D(1.0f, 0.0f, 0.0f)));
+            c->m_parameterPack.setUniform(modelMatrixNameId, UniformValue(transform));
+            rawCommands.push_back(c);
+        }
+
+        // WHEN
+        renderView.setInstancingEnabled(true);
+        renderView.setCommands(rawCommands);
+        renderView.sort();
+
+        // THEN
+        const QVector<RenderCommand *> mergedCommands = renderView.commands();
+        QCOMPARE(mergedCommands.size(), 1);
+        QCOMPARE(mergedCommands.first(), rawCommands.first());
+        QCOMPARE(mergedCommands.first()->m_instanceTransforms.size(), 10);
+        QCOMPARE(mergedCommands.first()->m_instanceCount, 10);
+        for (int i = 0; i < 10; ++i) {
+            QMatrix4x4 transform;
+            transform.translate(float(i), 0.0f, 0.0f);
+            QCOMPARE(mergedCommands.first()->m_instanceTransforms.at(i), transform);
+        }
+
+        // RenderCommands are deleted by RenderView dtor
+    }
+
+    void checkCommandsWithDifferentParametersAreNotMerged()
+    {
+        // GIVEN
+        RenderView renderView;
+        QVector<RenderCommand *> rawCommands;
+        const int colorNameId = StringToInt::lookupId(QLatin1String("color"));
+
+        for (int i = 0; i < 6; ++i) {
+            RenderCommand *c = createInstancableCommand(QMatrix4x4());
+            c->m_parameterPack.setUniform(colorNameId, UniformValue(QVector3D(float(i / 2), 0.0f, 0.0f)));
+            rawCommands.push_back(c);
+        }
+        // Already instanced geometries are left untouched
+        rawCommands.at(1)->m_instanceCount = 4;
+
+        // WHEN
+        renderView.setInstancingEnabled(true);
+        renderView.setCommands(rawCommands);
+        renderView.sort();
+
+        // THEN
+        const QVector<RenderCommand *> mergedCommands = renderView.commands();
+        QCOMPARE(mergedCommands.size(), 4);
+        QCOMPARE(mergedCommands.at(0), rawCommands.at(0));
+        QCOMPARE(mergedCommands.at(1), rawCommands.at(1));
+        QCOMPARE(mergedCommands.at(2), rawCommands.at(2));
+        QCOMPARE(mergedCommands.at(3), rawCommands.at(4));
+        QCOMPARE(mergedCommands.at(0)->m_instanceTransforms.size(), 1);
+        QCOMPARE(mergedCommands.at(1)->m_instanceTransforms.size(), 1);
+        QCOMPARE(mergedCommands.at(2)->m_instanceTransforms.size(), 2);
+        QCOMPARE(mergedCommands.at(3)->m_instanceTransforms.size(), 2);
+
+        // RenderCommands are deleted by RenderView dtor
+    }
+
+    void checkCommandsAreNotMergedWithoutInstancing()
+    {
+        // GIVEN
+        RenderView renderView;
+        QVector<RenderCommand *> rawCommands;
+
+        for (int i = 0; i < 10; ++i)
+            rawCommands.push_back(createInstancableCommand(QMatrix4x4()));
+        // Commands whose shader doesn't declare the instance transform attribute
+        rawCommands.at(5)->m_instanceTransforms.clear();
+        rawCommands.at(6)->m_instanceTransforms.clear();
+
+        // WHEN
+        renderView.setCommands(rawCommands);
+        renderView.sort();
+
+        // THEN
+        QCOMPARE(renderView.isInstancingEnabled(), false);
+        QCOMPARE(renderView.commands().size(), 10);
+
+        // WHEN
+        renderView.setInstancingEnabled(true);
+        renderView.sort();
+
+        // THEN
+        const QVector<RenderCommand *> mergedCommands = renderView.commands();
+        QCOMPARE(mergedCommands.size(), 4);
+        QCOMPARE(mergedCommands.at(0), rawCommands.at(0));
+        QCOMPARE(mergedCommands.at(1), rawCommands.at(5));
+        QCOMPARE(mergedCommands.at(2), rawCommands.at(6));
+        QCOMPARE(mergedCommands.at(3), rawCommands.at(7));
+        QCOMPARE(mergedCommands.at(0)->m_instanceTransforms.size(), 5);
+        QCOMPARE(mergedCommands.at(3)->m_instanceTransforms.size(), 3);
+
+        // RenderCommands are deleted by RenderView dtor
+    }
+
+    void checkCommandsSharingBuffersAreMultiDrawn()
+    {
+        // GIVEN
+        RenderView renderView;
+        QVector<RenderCommand *> rawCommands;
+        const QVector<VertexAttributeLayout> attributeLayouts = interleavedLayouts(Qt3DCore::QNodeId::createId(), 0);
+        const Qt3DCore::QNodeId indexBufferId = Qt3DCore::QNodeId::createId();
+
+        for (int i = 0; i < 4; ++i) {
+            RenderCommand *c = createMultiDrawableCommand(attributeLayouts, indexBufferId);
+            c->m_primitiveCount = 6 * (i + 1);
+            c->m_indexAttributeByteOffset = uint(i * 100 * sizeof(quint16));
+            c->m_indexOffset = i * 50;
+            rawCommands.push_back(c);
+        }
+
+        // WHEN
+        renderView.setMultiDrawEnabled(true);
+        renderView.setCommands(rawCommands);
+        renderView.sort();
+
+        // THEN
+        const QVector<RenderCommand *> mergedCommands = renderView.commands();
+        QCOMPARE(mergedCommands.size(), 1);
+        QCOMPARE(mergedCommands.first(), rawCommands.first());
+        const QVector<MultiDrawRange> ranges = mergedCommands.first()->m_multiDrawRanges;
+        QCOMPARE(ranges.size(), 4);
+        for (int i = 0; i < 4; ++i) {
+            QCOMPARE(ranges.at(i).count, GLuint(6 * (i + 1)));
+            QCOMPARE(ranges.at(i).instanceCount, GLuint(1));
+            QCOMPARE(ranges.at(i).firstIndex, GLuint(i * 100));
+            QCOMPARE(ranges.at(i).baseVertex, GLint(i * 50));
+            QCOMPARE(ranges.at(i).baseInstance, GLuint(0));
+        }
+
+        // RenderCommands are deleted by RenderView dtor
+    }
+
+    void checkMultiDrawRangesAddressInstanceTransforms()
+    {
+        // GIVEN
+        RenderView renderView;
+        QVector<RenderCommand *> rawCommands;
+        GeometryManager geometryManager;
+        const QVector<VertexAttributeLayout> attributeLayouts = interleavedLayouts(Qt3DCore::QNodeId::createId(), 0);
+        const Qt3DCore::QNodeId indexBufferId = Qt3DCore::QNodeId::createId();
+        const HGeometry geometries[] = {
+            geometryManager.getOrAcquireHandle(Qt3DCore::QNodeId::createId()),
+            geometryManager.getOrAcquireHandle(Qt3DCore::QNodeId::createId())
+        };
+
+        // Two entities for each geometry
+        for (int i = 0; i < 4; ++i) {
+            QMatrix4x4 transform;
+            transform.translate(float(i), 0.0f, 0.0f);
+            RenderCommand *c = createMultiDrawableCommand(attributeLayouts, indexBufferId);
+            c->m_instanceTransformLocation = 4;
+            c->m_instanceTransforms.push_back(transform);
+            c->m_geometry = geometries[i / 2];
+            c->m_indexAttributeByteOffset = uint((i / 2) * 64 * sizeof(quint16));
+            rawCommands.push_back(c);
+        }
+
+        // WHEN
+        renderView.setInstancingEnabled(true);
+        renderView.setMultiDrawEnabled(true);
+        renderView.setCommands(rawCommands);
+        renderView.sort();
+
+        // THEN
+        const QVector<RenderCommand *> mergedCommands = renderView.commands();
+        QCOMPARE(mergedCommands.size(), 1);
+        const RenderCommand *batch = mergedCommands.first();
+        QCOMPARE(batch->m_instanceTransforms.size(), 4);
+        QCOMPARE(batch->m_instanceCount, 4);
+        QCOMPARE(batch->m_multiDrawRanges.size(), 3);
+        QCOMPARE(batch->m_multiDrawRanges.at(0).firstIndex, GLuint(0));
+        QCOMPARE(batch->m_multiDrawRanges.at(0).instanceCount, GLuint(2));
+        QCOMPARE(batch->m_multiDrawRanges.at(0).baseInstance, GLuint(0));
+        QCOMPARE(batch->m_multiDrawRanges.at(1).firstIndex, GLuint(64));
+        QCOMPARE(batch->m_multiDrawRanges.at(1).instanceCount, GLuint(1));
+        QCOMPARE(batch->m_multiDrawRanges.at(1).baseInstance, GLuint(2));
+        QCOMPARE(batch->m_multiDrawRanges.at(2).firstIndex, GLuint(64));
+        QCOMPARE(batch->m_multiDrawRanges.at(2).instanceCount, GLuint(1));
+        QCOMPARE(batch->m_multiDrawRanges.at(2).baseInstance, GLuint(3));
+
+        // RenderCommands are deleted by RenderView dtor
+    }
+
+    void checkCommandsWithDifferentBuffersAreNotMultiDrawn()
+    {
+        // GIVEN
+        RenderView renderView;
+        QVector<RenderCommand *> rawCommands;
+        const QVector<VertexAttributeLayout> attributeLayouts = interleavedLayouts(Qt3DCore::QNodeId::createId(), 0);
+        const QVector<VertexAttributeLayout> otherAttributeLayouts = interleavedLayouts(Qt3DCore::QNodeId::createId(), 0);
+        const Qt3DCore::QNodeId indexBufferId = Qt3DCore::QNodeId::createId();
+
+        rawCommands.push_back(createMultiDrawableCommand(attributeLayouts, indexBufferId));
+        rawCommands.push_back(createMultiDrawableCommand(otherAttributeLayouts, indexBufferId));
+        rawCommands.push_back(createMultiDrawableCommand(otherAttributeLayouts, Qt3DCore::QNodeId::createId()));
+        RenderCommand *nonIndexed = createMultiDrawableCommand(otherAttributeLayouts, Qt3DCore::QNodeId());
+        nonIndexed->m_drawIndexed = false;
+        rawCommands.push_back(nonIndexed);
+
+        // WHEN
+        renderView.setMultiDrawEnabled(true);
+        renderView.setCommands(rawCommands);
+        renderView.sort();
+
+        // THEN
+        const QVector<RenderCommand *> mergedCommands = renderView.commands();
+        QCOMPARE(mergedCommands.size(), 4);
+        for (const RenderCommand *command : mergedCommands)
+            QVERIFY(command->m_multiDrawRanges.isEmpty());
+
+        // RenderCommands are deleted by RenderView dtor
+    }
+
+    void checkMeshesSharingOneBuffer()
+    {
+        // GIVEN
+        RenderView renderView;
+        QVector<RenderCommand *> rawCommands;
+        const Qt3DCore::QNodeId vertexBufferId = Qt3DCore::QNodeId::createId();
+        const Qt3DCore::QNodeId indexBufferId = Qt3DCore::QNodeId::createId();
+
+        // Two meshes with their own attributes packed in the same buffer,
+        // selected by their base vertex
+        RenderCommand *mesh1 = createMultiDrawableCommand(interleavedLayouts(vertexBufferId, 0), indexBufferId);
+        RenderCommand *mesh2 = createMultiDrawableCommand(interleavedLayouts(vertexBufferId, 0), indexBufferId);
+        mesh2->m_indexAttributeByteOffset = uint(36 * sizeof(quint16));
+        mesh2->m_indexOffset = 24;
+        // A third mesh whose attributes start further in the same buffer
+        RenderCommand *mesh3 = createMultiDrawableCommand(interleavedLayouts(vertexBufferId, 1024), indexBufferId);
+        // A fourth mesh that isn't interleaved
+        QVector<VertexAttributeLayout> separateLayouts = interleavedLayouts(vertexBufferId, 0);
+        separateLayouts[1].byteOffset = 2048;
+        separateLayouts[1].byteStride = 3 * sizeof(float);
+        RenderCommand *mesh4 = createMultiDrawableCommand(separateLayouts, indexBufferId);
+        // A fifth mesh reading positions with another type
+        QVector<VertexAttributeLayout> halfFloatLayouts = interleavedLayouts(vertexBufferId, 0);
+        halfFloatLayouts[0].vertexBaseType = QAttribute::HalfFloat;
+        RenderCommand *mesh5 = createMultiDrawableCommand(halfFloatLayouts, indexBufferId);
+        rawCommands << mesh1 << mesh2 << mesh3 << mesh4 << mesh5;
+
+        // WHEN
+        renderView.setMultiDrawEnabled(true);
+        renderView.setCommands(rawCommands);
+        renderView.sort();
+
+        // THEN
+        const QVector<RenderCommand *> mergedCommands = renderView.commands();
+        QCOMPARE(mergedCommands, QVector<RenderCommand *>() << mesh1 << mesh3 << mesh4 << mesh5);
+        QCOMPARE(mesh1->m_multiDrawRanges.size(), 2);
+        QCOMPARE(mesh1->m_multiDrawRanges.at(1).firstIndex, GLuint(36));
+        QCOMPARE(mesh1->m_multiDrawRanges.at(1).baseVertex, GLint(24));
+        QVERIFY(mesh3->m_multiDrawRanges.isEmpty());
+        QVERIFY(mesh4->m_multiDrawRanges.isEmpty());
+        QVERIFY(mesh5->m_multiDrawRanges.isEmpty());
+
+        // RenderCommands are deleted by RenderView dtor
+    }
+
 private:
+    // Positions and normals interleaved in bufferId from byteOffset
+    static QVector<VertexAttributeLayout> interleavedLayouts(Qt3DCore::QNodeId bufferId, uint byteOffset)
+    {
+        VertexAttributeLayout position;
+        position.bufferId = bufferId;
+        position.nameId = StringToInt::lookupId(QAttribute::defaultPositionAttributeName());
+        position.vertexBaseType = QAttribute::Float;
+        position.vertexSize = 3;
+        position.byteOffset = byteOffset;
+        position.byteStride = 6 * sizeof(float);
+
+        VertexAttributeLayout normal = position;
+        normal.nameId = StringToInt::lookupId(QAttribute::defaultNormalAttributeName());
+        normal.byteOffset = byteOffset + 3 * sizeof(float);
+
+        QVector<VertexAttributeLayout> layouts = { position, normal };
+        std::sort(layouts.begin(), layouts.end(),
+                  [] (const VertexAttributeLayout &a, const VertexAttributeLayout &b) {
+            return a.nameId < b.nameId;
+        });
+        return layouts;
+    }
+
+    static RenderCommand *createMultiDrawableCommand(const QVector<VertexAttributeLayout> &attributeLayouts,
+                                                     Qt3DCore::QNodeId indexBufferId)
+    {
+        RenderCommand *c = new RenderCommand();
+        c->m_shaderDna = 1;
+        c->m_isValid = true;
+        c->m_instanceCount = 1;
+        c->m_drawIndexed = true;
+        c->m_vertexAttributeLayouts = attributeLayouts;
+        c->m_indexBufferId = indexBufferId;
+        return c;
+    }
+
+    static RenderCommand *createInstancableCommand(const QMatrix4x4 &transform)
+    {
+        RenderCommand *c = new RenderCommand();
+        c->m_shaderDna = 1;
+        c->m_isValid = true;
+        c->m_instanceCount = 1;
+        c->m_instanceTransformLocation = 4;
+        c->m_instanceTransforms.push_back(transform);
+        return c;
+    }
 };
 
 } // Render
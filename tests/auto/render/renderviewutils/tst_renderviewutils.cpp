@@ -52,6 +52,8 @@ private Q_SLOTS:
     void topLevelDynamicProperties();
     void transformedProperties();
     void shouldNotifyDynamicPropertyChanges();
+    void fillUniformBlockMember();
+    void fillBlockData();
 
 private:
     void initBackendShaderData(Qt3DRender::QShaderData *frontend,
@@ -780,6 +782,88 @@ void tst_RenderViewUtils::shouldNotifyDynamicPropertyChanges()
     QCOMPARE(change->value(), QVariant::fromValue(texture->id()));
 }
 
+void tst_RenderViewUtils::fillUniformBlockMember()
+{
+    // GIVEN
+    QByteArray blockData(96, '\0');
+
+    Qt3DRender::Render::ShaderUniform vec3Array;
+    vec3Array.m_uniformType = Qt3DRender::Render::Vec3;
+    vec3Array.m_size = 2;
+    vec3Array.m_offset = 0;
+    vec3Array.m_arrayStride = 16;
+
+    Qt3DRender::Render::ShaderUniform mat3;
+    mat3.m_uniformType = Qt3DRender::Render::Mat3;
+    mat3.m_size = 1;
+    mat3.m_offset = 32;
+    mat3.m_matrixStride = 16;
+
+    const QVariantList positions = { QVector3D(1.0f, 2.0f, 3.0f), QVector3D(4.0f, 5.0f, 6.0f) };
+    const QMatrix3x3 matrix(QMatrix4x4(1.0f, 2.0f, 3.0f, 0.0f,
+                                       4.0f, 5.0f, 6.0f, 0.0f,
+                                       7.0f, 8.0f, 9.0f, 0.0f,
+                                       0.0f, 0.0f, 0.0f, 1.0f).toGenericMatrix<3, 3>());
+
+    // WHEN
+    Qt3DRender::Render::fillUniformBlockMember(blockData, vec3Array,
+                                               Qt3DRender::Render::UniformValue::fromVariant(positions));
+    Qt3DRender::Render::fillUniformBlockMember(blockData, mat3,
+                                               Qt3DRender::Render::UniformValue(matrix));
+
+    // THEN
+    const float *data = reinterpret_cast<const float *>(blockData.constData());
+    // Array elements are aligned on vec4 boundaries
+    QCOMPARE(data[0], 1.0f);
+    QCOMPARE(data[1], 2.0f);
+    QCOMPARE(data[2], 3.0f);
+    QCOMPARE(data[3], 0.0f);
+    QCOMPARE(data[4], 4.0f);
+    QCOMPARE(data[5], 5.0f);
+    QCOMPARE(data[6], 6.0f);
+    QCOMPARE(data[7], 0.0f);
+    // Matrix columns use the matrix stride
+    for (int col = 0; col < 3; ++col) {
+        for (int row = 0; row < 3; ++row)
+            QCOMPARE(data[8 + col * 4 + row], matrix.constData()[col * 3 + row]);
+        QCOMPARE(data[8 + col * 4 + 3], 0.0f);
+    }
+}
+
+void tst_RenderViewUtils::fillBlockData()
+{
+    // GIVEN
+    QScopedPointer<ScalarShaderData> shaderData(new ScalarShaderData());
+    QScopedPointer<Qt3DRender::Render::ShaderDataManager> manager(new Qt3DRender::Render::ShaderDataManager());
+    QScopedPointer<Qt3DRender::Render::TextureManager> textureManager(new Qt3DRender::Render::TextureManager());
+    shaderData->setScalar(883.0f);
+    initBackendShaderData(shaderData.data(), manager.data());
+    Qt3DRender::Render::ShaderData *backendShaderData = manager->lookupResource(shaderData->id());
+    QVERIFY(backendShaderData != nullptr);
+
+    Qt3DRender::Render::UniformBlockValueBuilder blockBuilder;
+    blockBuilder.shaderDataManager = manager.data();
+    blockBuilder.textureManager = textureManager.data();
+    blockBuilder.updatedPropertiesOnly = false;
+    blockBuilder.uniforms = shaderData->buildUniformMap(QStringLiteral("MyBlock"));
+    Qt3DRender::Render::ShaderUniform &scalarUniform = blockBuilder.uniforms[QStringLiteral("MyBlock.scalar")];
+    scalarUniform.m_uniformType = Qt3DRender::Render::Float;
+    scalarUniform.m_size = 1;
+    scalarUniform.m_offset = 4;
+    blockBuilder.buildActiveUniformNameValueMapStructHelper(backendShaderData, QStringLiteral("MyBlock"));
+
+    // WHEN
+    QByteArray blockData(16, '\0');
+    blockBuilder.fillBlockData(blockData);
+
+    // THEN
+    const float *data = reinterpret_cast<const float *>(blockData.constData());
+    QCOMPARE(data[0], 0.0f);
+    QCOMPARE(data[1], 883.0f);
+    QCOMPARE(data[2], 0.0f);
+    QCOMPARE(data[3], 0.0f);
+}
+
 QTEST_MAIN(tst_RenderViewUtils)
 
 #include "tst_renderviewutils.moc"
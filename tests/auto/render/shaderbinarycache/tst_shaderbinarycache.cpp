@@ -0,0 +1,298 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QTest>
+#include <Qt3DRender/private/shaderbinarycache_p.h>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+
+using namespace Qt3DRender::Render;
+
+namespace {
+
+ShaderBinaryCache::Binary createBinary(const QByteArray &data)
+{
+    ShaderBinaryCache::Binary binary;
+    binary.sourceHash = ShaderBinaryCache::sourceHash({ QByteArray("vertex"), QByteArray("fragment") },
+                                                      QHash<QString, int>());
+    binary.format = 0x1234;
+    binary.data = data;
+    return binary;
+}
+
+} // anonymous
+
+class tst_ShaderBinaryCache : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkDisabledByDefault()
+    {
+        // GIVEN
+        ShaderBinaryCache cache;
+        cache.setDriverKey(QByteArrayLiteral("vendor"));
+        ShaderBinaryCache::Binary binary;
+
+        // THEN
+        QVERIFY(!cache.isEnabled());
+        QVERIFY(!cache.store(ProgramDNA(1), createBinary(QByteArrayLiteral("binary"))));
+        QVERIFY(!cache.load(ProgramDNA(1), &binary));
+        QVERIFY(cache.cachedPrograms().isEmpty());
+    }
+
+    void checkStoreAndLoad()
+    {
+        // GIVEN
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ShaderBinaryCache cache;
+        cache.setCacheDirectory(dir.path());
+        cache.setDriverKey(QByteArrayLiteral("vendor\nrenderer\nversion"));
+        const ShaderBinaryCache::Binary stored = createBinary(QByteArrayLiteral("binary"));
+
+        // WHEN
+        const bool success = cache.store(ProgramDNA(0xcafe), stored);
+
+        // THEN
+        QVERIFY(cache.isEnabled());
+        QVERIFY(success);
+        QCOMPARE(cache.cachedPrograms(), QVector<ProgramDNA>({ ProgramDNA(0xcafe) }));
+
+        // WHEN
+        ShaderBinaryCache::Binary loaded;
+        const bool found = cache.load(ProgramDNA(0xcafe), &loaded);
+
+        // THEN
+        QVERIFY(found);
+        QCOMPARE(loaded.sourceHash, stored.sourceHash);
+        QCOMPARE(loaded.format, stored.format);
+        QCOMPARE(loaded.data, stored.data);
+        QVERIFY(!cache.load(ProgramDNA(0xbeef), &loaded));
+    }
+
+    void checkEntriesAreDriverSpecific()
+    {
+        // GIVEN
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ShaderBinaryCache cache;
+        cache.setCacheDirectory(dir.path());
+        cache.setDriverKey(QByteArrayLiteral("driver 1"));
+        QVERIFY(cache.store(ProgramDNA(42), createBinary(QByteArrayLiteral("binary"))));
+
+        // WHEN
+        cache.setDriverKey(QByteArrayLiteral("driver 2"));
+        ShaderBinaryCache::Binary loaded;
+
+        // THEN
+        QVERIFY(!cache.load(ProgramDNA(42), &loaded));
+        QVERIFY(cache.cachedPrograms().isEmpty());
+
+        // WHEN
+        cache.setDriverKey(QByteArrayLiteral("driver 1"));
+
+        // THEN
+        QVERIFY(cache.load(ProgramDNA(42), &loaded));
+    }
+
+    void checkRemove()
+    {
+        // GIVEN
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ShaderBinaryCache cache;
+        cache.setCacheDirectory(dir.path());
+        cache.setDriverKey(QByteArrayLiteral("driver"));
+        QVERIFY(cache.store(ProgramDNA(1), createBinary(QByteArrayLiteral("one"))));
+        QVERIFY(cache.store(ProgramDNA(2), createBinary(QByteArrayLiteral("two"))));
+
+        // WHEN
+        cache.remove(ProgramDNA(1));
+
+        // THEN
+        QCOMPARE(cache.cachedPrograms(), QVector<ProgramDNA>({ ProgramDNA(2) }));
+    }
+
+    void checkInvalidEntriesAreDiscarded()
+    {
+        // GIVEN
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ShaderBinaryCache cache;
+        cache.setCacheDirectory(dir.path());
+        cache.setDriverKey(QByteArrayLiteral("driver"));
+        QVERIFY(cache.store(ProgramDNA(7), createBinary(QByteArrayLiteral("binary"))));
+
+        // WHEN
+        const QStringList driverDirs = QDir(dir.path()).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+        QCOMPARE(driverDirs.size(), 1);
+        QFile file(dir.path() + QLatin1Char('/') + driverDirs.first() + QLatin1String("/7.bin"));
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write("garbage");
+        file.close();
+
+        ShaderBinaryCache::Binary loaded;
+        const bool found = cache.load(ProgramDNA(7), &loaded);
+
+        // THEN
+        QVERIFY(!found);
+        QVERIFY(!file.exists());
+        QVERIFY(cache.cachedPrograms().isEmpty());
+    }
+
+    void checkRecentlyUsedPrograms()
+    {
+        // GIVEN
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        {
+            ShaderBinaryCache cache;
+            cache.setCacheDirectory(dir.path());
+            cache.setDriverKey(QByteArrayLiteral("driver"));
+            cache.beginSession(10);
+            QCOMPARE(cache.session(), quint32(1));
+            QVERIFY(cache.recentlyUsedPrograms().isEmpty());
+
+            // WHEN
+            QVERIFY(cache.store(ProgramDNA(3), createBinary(QByteArrayLiteral("three"))));
+            QVERIFY(cache.store(ProgramDNA(1), createBinary(QByteArrayLiteral("one"))));
+            QVERIFY(cache.saveUsage());
+        }
+
+        ShaderBinaryCache cache;
+        cache.setCacheDirectory(dir.path());
+        cache.setDriverKey(QByteArrayLiteral("driver"));
+        cache.beginSession(10);
+
+        // THEN
+        QCOMPARE(cache.session(), quint32(2));
+        QCOMPARE(cache.recentlyUsedPrograms(), QVector<ProgramDNA>({ ProgramDNA(1), ProgramDNA(3) }));
+
+        // WHEN
+        cache.markUsed(ProgramDNA(3));
+        QVERIFY(cache.saveUsage());
+        cache.beginSession(10);
+
+        // THEN -> only the programs used by the previous session are listed
+        QCOMPARE(cache.session(), quint32(3));
+        QCOMPARE(cache.recentlyUsedPrograms(), QVector<ProgramDNA>({ ProgramDNA(3) }));
+        QCOMPARE(cache.cachedPrograms().size(), 2);
+    }
+
+    void checkUnusedEntriesAreEvicted()
+    {
+        // GIVEN
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ShaderBinaryCache cache;
+        cache.setCacheDirectory(dir.path());
+        cache.setDriverKey(QByteArrayLiteral("driver"));
+        cache.beginSession(2);
+        QVERIFY(cache.store(ProgramDNA(1), createBinary(QByteArrayLiteral("one"))));
+        QVERIFY(cache.store(ProgramDNA(2), createBinary(QByteArrayLiteral("two"))));
+        QVERIFY(cache.saveUsage());
+
+        // WHEN
+        for (int i = 0; i < 2; ++i) {
+            cache.beginSession(2);
+            cache.markUsed(ProgramDNA(2));
+            QVERIFY(cache.saveUsage());
+        }
+
+        // THEN -> not used by the last two sessions yet
+        QCOMPARE(cache.session(), quint32(3));
+        QCOMPARE(cache.cachedPrograms().size(), 2);
+
+        // WHEN
+        cache.beginSession(2);
+
+        // THEN
+        QCOMPARE(cache.cachedPrograms(), QVector<ProgramDNA>({ ProgramDNA(2) }));
+        ShaderBinaryCache::Binary loaded;
+        QVERIFY(!cache.load(ProgramDNA(1), &loaded));
+        QVERIFY(cache.load(ProgramDNA(2), &loaded));
+    }
+
+    void checkEntriesWithoutUsageAreAged()
+    {
+        // GIVEN
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ShaderBinaryCache cache;
+        cache.setCacheDirectory(dir.path());
+        cache.setDriverKey(QByteArrayLiteral("driver"));
+        QVERIFY(cache.store(ProgramDNA(5), createBinary(QByteArrayLiteral("five"))));
+
+        // WHEN -> the usage recorded by the store was never saved
+        cache.beginSession(1);
+
+        // THEN
+        QCOMPARE(cache.cachedPrograms(), QVector<ProgramDNA>({ ProgramDNA(5) }));
+        QVERIFY(cache.recentlyUsedPrograms().isEmpty());
+
+        // WHEN
+        cache.beginSession(1);
+        cache.beginSession(1);
+
+        // THEN
+        QVERIFY(cache.cachedPrograms().isEmpty());
+    }
+
+    void checkSourceHash()
+    {
+        // GIVEN
+        const QVector<QByteArray> code = { QByteArray("vertex"), QByteArray("fragment") };
+        QHash<QString, int> outputs;
+        outputs.insert(QStringLiteral("color"), 0);
+        outputs.insert(QStringLiteral("normal"), 1);
+
+        // THEN
+        const QByteArray hash = ShaderBinaryCache::sourceHash(code, outputs);
+        QVERIFY(!hash.isEmpty());
+        QCOMPARE(ShaderBinaryCache::sourceHash(code, outputs), hash);
+        QVERIFY(ShaderBinaryCache::sourceHash(code, QHash<QString, int>()) != hash);
+        // moving code between stages changes the program
+        QVERIFY(ShaderBinaryCache::sourceHash({ QByteArray("vertexfragment"), QByteArray() }, outputs) != hash);
+
+        // WHEN
+        QHash<QString, int> swappedOutputs;
+        swappedOutputs.insert(QStringLiteral("color"), 1);
+        swappedOutputs.insert(QStringLiteral("normal"), 0);
+
+        // THEN
+        QVERIFY(ShaderBinaryCache::sourceHash(code, swappedOutputs) != hash);
+    }
+};
+
+QTEST_APPLESS_MAIN(tst_ShaderBinaryCache)
+
+#include "tst_shaderbinarycache.moc"
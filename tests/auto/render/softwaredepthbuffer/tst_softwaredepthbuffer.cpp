@@ -0,0 +1,289 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QTest>
+#include <Qt3DRender/private/softwaredepthbuffer_p.h>
+#include <Qt3DRender/private/occlusioncullingjob_p.h>
+
+namespace {
+
+// Covers the whole buffer with two triangles of opposite windings
+void rasterizeQuad(Qt3DRender::Render::SoftwareDepthBuffer &buffer, const QRectF &rect, float depth)
+{
+    const QVector3D topLeft(rect.left(), rect.top(), depth);
+    const QVector3D topRight(rect.right(), rect.top(), depth);
+    const QVector3D bottomLeft(rect.left(), rect.bottom(), depth);
+    const QVector3D bottomRight(rect.right(), rect.bottom(), depth);
+    buffer.rasterizeTriangle(topLeft, topRight, bottomRight);
+    buffer.rasterizeTriangle(topLeft, bottomLeft, bottomRight);
+}
+
+} // anonymous
+
+class tst_SoftwareDepthBuffer : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkInitialState()
+    {
+        // GIVEN
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+
+        // THEN
+        QCOMPARE(buffer.size(), QSize(1, 1));
+        QCOMPARE(buffer.levelCount(), 1);
+        QCOMPARE(buffer.depth(0, 0), 1.0f);
+    }
+
+    void checkResize_data()
+    {
+        QTest::addColumn<QSize>("size");
+        QTest::addColumn<int>("levelCount");
+        QTest::addColumn<QSize>("secondLevelSize");
+
+        QTest::newRow("8x4") << QSize(8, 4) << 4 << QSize(4, 2);
+        QTest::newRow("5x3") << QSize(5, 3) << 4 << QSize(3, 2);
+        QTest::newRow("2x2") << QSize(2, 2) << 2 << QSize(1, 1);
+    }
+
+    void checkResize()
+    {
+        // GIVEN
+        QFETCH(QSize, size);
+        QFETCH(int, levelCount);
+        QFETCH(QSize, secondLevelSize);
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+
+        // WHEN
+        buffer.resize(size);
+
+        // THEN
+        QCOMPARE(buffer.size(), size);
+        QCOMPARE(buffer.levelCount(), levelCount);
+        QCOMPARE(buffer.levelSize(0), size);
+        QCOMPARE(buffer.levelSize(1), secondLevelSize);
+        QCOMPARE(buffer.levelSize(levelCount - 1), QSize(1, 1));
+        for (int y = 0; y < size.height(); ++y)
+            for (int x = 0; x < size.width(); ++x)
+                QCOMPARE(buffer.depth(x, y), 1.0f);
+    }
+
+    void checkRasterizeTriangles()
+    {
+        // GIVEN
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+        buffer.resize(QSize(8, 8));
+
+        // WHEN
+        rasterizeQuad(buffer, QRectF(0.0f, 0.0f, 8.0f, 8.0f), 0.5f);
+
+        // THEN
+        for (int y = 0; y < 8; ++y)
+            for (int x = 0; x < 8; ++x)
+                QCOMPARE(buffer.depth(x, y), 0.5f);
+
+        // WHEN -> farther occluders don't overwrite nearer ones
+        rasterizeQuad(buffer, QRectF(0.0f, 0.0f, 8.0f, 8.0f), 0.75f);
+
+        // THEN
+        QCOMPARE(buffer.depth(3, 3), 0.5f);
+
+        // WHEN
+        buffer.clear();
+
+        // THEN
+        QCOMPARE(buffer.depth(3, 3), 1.0f);
+    }
+
+    void checkDepthInterpolation()
+    {
+        // GIVEN
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+        buffer.resize(QSize(8, 8));
+
+        // WHEN -> depth goes from 0 to 1 along x
+        buffer.rasterizeTriangle(QVector3D(0.0f, 0.0f, 0.0f), QVector3D(8.0f, 0.0f, 1.0f), QVector3D(0.0f, 8.0f, 0.0f));
+
+        // THEN
+        QVERIFY(qFuzzyCompare(buffer.depth(0, 0), 0.0625f));
+        QVERIFY(qFuzzyCompare(buffer.depth(4, 0), 0.5625f));
+        QVERIFY(qFuzzyCompare(buffer.depth(0, 6), 0.0625f));
+        // Outside of the triangle
+        QCOMPARE(buffer.depth(7, 7), 1.0f);
+    }
+
+    void checkRasterizeRows()
+    {
+        // GIVEN
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+        buffer.resize(QSize(8, 8));
+
+        // WHEN
+        buffer.rasterizeTriangle(QVector3D(0.0f, 0.0f, 0.5f), QVector3D(8.0f, 0.0f, 0.5f), QVector3D(8.0f, 8.0f, 0.5f), 0, 4);
+        buffer.rasterizeTriangle(QVector3D(0.0f, 0.0f, 0.5f), QVector3D(0.0f, 8.0f, 0.5f), QVector3D(8.0f, 8.0f, 0.5f), 0, 4);
+
+        // THEN
+        for (int y = 0; y < 8; ++y)
+            for (int x = 0; x < 8; ++x)
+                QCOMPARE(buffer.depth(x, y), y < 4 ? 0.5f : 1.0f);
+    }
+
+    void checkBuildPyramid()
+    {
+        // GIVEN
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+        buffer.resize(QSize(8, 8));
+
+        // WHEN
+        rasterizeQuad(buffer, QRectF(0.0f, 0.0f, 4.0f, 8.0f), 0.25f);
+        buffer.buildPyramid();
+
+        // THEN
+        QCOMPARE(buffer.levelCount(), 4);
+        for (int y = 0; y < 4; ++y)
+            for (int x = 0; x < 4; ++x)
+                QCOMPARE(buffer.maxDepth(1, x, y), x < 2 ? 0.25f : 1.0f);
+        QCOMPARE(buffer.maxDepth(2, 0, 0), 0.25f);
+        QCOMPARE(buffer.maxDepth(2, 1, 0), 1.0f);
+        QCOMPARE(buffer.maxDepth(3, 0, 0), 1.0f);
+    }
+
+    void checkIsOccluded()
+    {
+        // GIVEN
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+        buffer.resize(QSize(64, 32));
+
+        // WHEN
+        rasterizeQuad(buffer, QRectF(0.0f, 0.0f, 32.0f, 32.0f), 0.5f);
+        buffer.buildPyramid();
+
+        // THEN
+        QCOMPARE(buffer.isOccluded(QRectF(2.0f, 2.0f, 3.0f, 3.0f), 0.7f), true);
+        QCOMPARE(buffer.isOccluded(QRectF(2.0f, 2.0f, 20.0f, 20.0f), 0.7f), true);
+        QCOMPARE(buffer.isOccluded(QRectF(2.0f, 2.0f, 3.0f, 3.0f), 0.3f), false);
+        // Partially behind the occluder
+        QCOMPARE(buffer.isOccluded(QRectF(24.0f, 2.0f, 16.0f, 3.0f), 0.7f), false);
+        // Not behind the occluder
+        QCOMPARE(buffer.isOccluded(QRectF(40.0f, 2.0f, 3.0f, 3.0f), 0.7f), false);
+        // Off screen
+        QCOMPARE(buffer.isOccluded(QRectF(-20.0f, -20.0f, 5.0f, 5.0f), 0.7f), false);
+    }
+
+    void checkIsOccludedWithPartiallyCoveredPixels()
+    {
+        // GIVEN
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+        buffer.resize(QSize(32, 32));
+
+        // WHEN -> the occluder edge crosses column 15 right of its centre
+        rasterizeQuad(buffer, QRectF(0.0f, 0.0f, 15.75f, 32.0f), 0.5f);
+        buffer.buildPyramid();
+
+        // THEN
+        QCOMPARE(buffer.depth(15, 4), 0.5f);
+        QCOMPARE(buffer.depth(16, 4), 1.0f);
+        QCOMPARE(buffer.isOccluded(QRectF(4.0f, 4.0f, 4.0f, 4.0f), 0.7f), true);
+        // Only in the part of column 15 that isn't covered
+        QCOMPARE(buffer.isOccluded(QRectF(15.8f, 4.0f, 0.1f, 4.0f), 0.7f), false);
+
+        // WHEN -> depth goes from 0.25 to 0.75 along x
+        buffer.clear();
+        buffer.rasterizeTriangle(QVector3D(0.0f, 0.0f, 0.25f), QVector3D(32.0f, 0.0f, 0.75f), QVector3D(32.0f, 32.0f, 0.75f));
+        buffer.rasterizeTriangle(QVector3D(0.0f, 0.0f, 0.25f), QVector3D(0.0f, 32.0f, 0.25f), QVector3D(32.0f, 32.0f, 0.75f));
+        buffer.buildPyramid();
+
+        // THEN -> the occluder is farther than the depth at the centre of the pixel on its right side
+        const float rightSideDepth = 0.25f + 0.5f * 17.0f / 32.0f;
+        QVERIFY(buffer.depth(16, 4) < rightSideDepth);
+        QCOMPARE(buffer.isOccluded(QRectF(16.0f, 4.0f, 1.0f, 1.0f), rightSideDepth - 0.001f), false);
+        QCOMPARE(buffer.isOccluded(QRectF(16.0f, 4.0f, 1.0f, 1.0f), 0.9f), true);
+    }
+
+    void checkRasterizerJobs()
+    {
+        // GIVEN
+        Qt3DRender::Render::SoftwareDepthBuffer buffer;
+        buffer.resize(QSize(16, 16));
+        const QVector<QVector3D> triangles = {
+            QVector3D(0.0f, 0.0f, 0.5f), QVector3D(16.0f, 0.0f, 0.5f), QVector3D(16.0f, 16.0f, 0.5f),
+            QVector3D(0.0f, 0.0f, 0.5f), QVector3D(0.0f, 16.0f, 0.5f), QVector3D(16.0f, 16.0f, 0.5f)
+        };
+
+        Qt3DRender::Render::OcclusionRasterizerJob topJob;
+        topJob.setDepthBuffer(&buffer);
+        topJob.setRows(0, 8);
+        topJob.setTriangles(triangles);
+
+        Qt3DRender::Render::OcclusionRasterizerJob bottomJob;
+        bottomJob.setDepthBuffer(&buffer);
+        bottomJob.setRows(8, 16);
+        bottomJob.setTriangles(triangles);
+
+        // WHEN
+        topJob.run();
+
+        // THEN
+        QCOMPARE(buffer.depth(5, 7), 0.5f);
+        QCOMPARE(buffer.depth(5, 8), 1.0f);
+
+        // WHEN
+        bottomJob.run();
+
+        // THEN
+        for (int y = 0; y < 16; ++y)
+            for (int x = 0; x < 16; ++x)
+                QCOMPARE(buffer.depth(x, y), 0.5f);
+    }
+
+    void checkOcclusionCullingJobInitialState()
+    {
+        // GIVEN
+        Qt3DRender::Render::OcclusionCullingJob job(3);
+
+        // THEN
+        QCOMPARE(job.isActive(), false);
+        QVERIFY(job.occluderLayerId().isNull());
+        QCOMPARE(job.depthBufferSize(), QSize(256, 128));
+        QCOMPARE(job.rasterizerJobs().size(), 3);
+
+        // WHEN -> inactive jobs leave the rasterizers idle
+        job.run();
+
+        // THEN
+        for (const auto rasterizerJob : job.rasterizerJobs())
+            QVERIFY(rasterizerJob->triangles().isEmpty());
+    }
+};
+
+QTEST_MAIN(tst_SoftwareDepthBuffer)
+
+#include "tst_softwaredepthbuffer.moc"
@@ -47,6 +47,7 @@ private Q_SLOTS:
         QVERIFY(backendNode.peerId().isNull());
         QVERIFY(backendNode.parentId().isNull());
         QVERIFY(backendNode.sortTypes().isEmpty());
+        QCOMPARE(backendNode.isInstancingEnabled(), false);
     }
 
     void checkPeerPropertyMirroring()
@@ -65,6 +66,7 @@ private Q_SLOTS:
         backendNode.setFrameGraphManager(&manager);
         Qt3DRender::QSortPolicy sortPolicy(&parent);
         sortPolicy.setSortTypes(sortTypes);
+        sortPolicy.setInstancingEnabled(true);
 
         // WHEN
         simulateInitialization(&sortPolicy, &backendNode);
@@ -73,6 +75,7 @@ private Q_SLOTS:
         QCOMPARE(backendNode.peerId(), sortPolicy.id());
         QCOMPARE(backendNode.parentId(), parent.id());
         QCOMPARE(backendNode.sortTypes(), sortTypes);
+        QCOMPARE(backendNode.isInstancingEnabled(), true);
     }
 
     void checkPropertyChanges()
@@ -96,6 +99,15 @@ private Q_SLOTS:
 
         // THEN
         QCOMPARE(backendNode.sortTypes(), sortTypes);
+
+        // WHEN
+        updateChange.reset(new Qt3DCore::QPropertyUpdatedChange(Qt3DCore::QNodeId()));
+        updateChange->setValue(true);
+        updateChange->setPropertyName("instancingEnabled");
+        backendNode.sceneChangeEvent(updateChange);
+
+        // THEN
+        QCOMPARE(backendNode.isInstancingEnabled(), true);
     }
 };
 
@@ -29,6 +29,8 @@
 
 #include <QtTest/QTest>
 #include <Qt3DRender/private/texturedatamanager_p.h>
+#include <Qt3DRender/private/qtexture_p.h>
+#include <Qt3DRender/qtexture.h>
 
 namespace {
 
@@ -48,11 +50,20 @@ public:
     {
         return !(other == *this);
     }
+
+    QString name() const { return m_name; }
+
 private:
     QString m_name;
 };
 typedef QSharedPointer<FakeGenerator> FakeGeneratorPtr;
 
+// Only keep the first character to get collisions
+uint generatorHash(const FakeGenerator &generator)
+{
+    return qHash(generator.name().left(1));
+}
+
 class FakeData
 {
 public:
@@ -242,6 +253,130 @@ private Q_SLOTS:
         QCOMPARE(manager.pendingGenerators().size(), 1);
         QCOMPARE(manager.pendingGenerators().first(), generator2);
     }
+
+    void checkDataEvictedOnceUploaded()
+    {
+        // GIVEN
+        Manager manager;
+        manager.setEvictUploadedData(true);
+        FakeGeneratorPtr generator(FakeGeneratorPtr::create(QStringLiteral("ZR1")));
+        FakeDataPtr data(FakeDataPtr::create(883));
+        FakeAPITexture texture;
+        FakeAPITexture texture2;
+
+        // WHEN
+        manager.requestData(generator, &texture);
+        manager.requestData(generator, &texture2);
+        manager.assignData(generator, data);
+        manager.dataUploaded(generator, &texture);
+
+        // THEN -> texture2 still has to upload
+        QCOMPARE(manager.getData(generator), data);
+
+        // WHEN
+        manager.dataUploaded(generator, &texture2);
+
+        // THEN
+        QVERIFY(manager.getData(generator).isNull());
+        QCOMPARE(manager.pendingGenerators().size(), 0);
+
+        // WHEN
+        const bool stillAvailable = manager.reloadData(generator, &texture);
+
+        // THEN
+        QVERIFY(!stillAvailable);
+        QCOMPARE(manager.pendingGenerators().size(), 1);
+
+        // WHEN
+        manager.assignData(generator, data);
+
+        // THEN
+        QCOMPARE(manager.getData(generator), data);
+        QCOMPARE(manager.pendingGenerators().size(), 0);
+    }
+
+    void checkDataKeptWhenEvictionDisabled()
+    {
+        // GIVEN
+        Manager manager;
+        manager.setEvictUploadedData(false);
+        FakeGeneratorPtr generator(FakeGeneratorPtr::create(QStringLiteral("ZR1")));
+        FakeDataPtr data(FakeDataPtr::create(883));
+        FakeAPITexture texture;
+
+        // WHEN
+        manager.requestData(generator, &texture);
+        manager.assignData(generator, data);
+        manager.dataUploaded(generator, &texture);
+
+        // THEN
+        QCOMPARE(manager.getData(generator), data);
+        QVERIFY(manager.reloadData(generator, &texture));
+    }
+
+    void checkCollidingGenerators()
+    {
+        // GIVEN
+        Manager manager;
+        FakeAPITexture texture;
+        QVector<FakeGeneratorPtr> generators;
+        for (int i = 0; i < 100; ++i)
+            generators.push_back(FakeGeneratorPtr::create(QStringLiteral("Z%1").arg(i)));
+
+        // WHEN
+        for (const FakeGeneratorPtr &generator : qAsConst(generators))
+            QVERIFY(manager.requestData(generator, &texture));
+
+        // THEN
+        QCOMPARE(manager.pendingGenerators().size(), generators.size());
+
+        // WHEN
+        const FakeGeneratorPtr clone = FakeGeneratorPtr::create(QStringLiteral("Z42"));
+
+        // THEN
+        QVERIFY(!manager.requestData(clone, &texture));
+        QCOMPARE(manager.pendingGenerators().size(), generators.size());
+
+        // WHEN
+        FakeDataPtr data(FakeDataPtr::create(42));
+        manager.assignData(clone, data);
+
+        // THEN
+        QCOMPARE(manager.getData(generators.at(42)), data);
+        QVERIFY(manager.getData(generators.at(41)).isNull());
+        QCOMPARE(manager.pendingGenerators().size(), generators.size() - 1);
+
+        // WHEN
+        for (int i = 0; i < generators.size(); i += 2)
+            manager.releaseData(generators.at(i), &texture);
+
+        // THEN
+        QCOMPARE(manager.pendingGenerators().size(), generators.size() / 2);
+        for (int i = 0; i < generators.size(); ++i) {
+            const bool released = (i % 2) == 0;
+            QCOMPARE(manager.pendingGenerators().contains(generators.at(i)), !released && i != 42);
+        }
+    }
+
+    void checkTextureFromSourceGeneratorHash()
+    {
+        // GIVEN
+        Qt3DRender::QTextureLoader loader;
+        loader.setSource(QUrl(QStringLiteral("file:///some/texture.png")));
+        Qt3DRender::QTextureFromSourceGenerator generator(&loader);
+        Qt3DRender::QTextureFromSourceGenerator sameGenerator(&loader);
+        loader.setSource(QUrl(QStringLiteral("file:///other/texture.png")));
+        Qt3DRender::QTextureFromSourceGenerator otherGenerator(&loader);
+        const Qt3DRender::QTextureGenerator &a = generator;
+        const Qt3DRender::QTextureGenerator &b = sameGenerator;
+        const Qt3DRender::QTextureGenerator &c = otherGenerator;
+
+        // THEN
+        QVERIFY(a == b);
+        QCOMPARE(Qt3DRender::Render::generatorHash(a), Qt3DRender::Render::generatorHash(b));
+        QVERIFY(!(a == c));
+        QVERIFY(Qt3DRender::Render::generatorHash(a) != Qt3DRender::Render::generatorHash(c));
+    }
 };
 
 QTEST_MAIN(tst_TextureDataManager)
@@ -0,0 +1,9 @@
+TEMPLATE = app
+
+TARGET = tst_textureresidencypolicy
+
+QT += 3dcore 3dcore-private 3drender 3drender-private testlib
+
+CONFIG += testcase
+
+SOURCES += tst_textureresidencypolicy.cpp
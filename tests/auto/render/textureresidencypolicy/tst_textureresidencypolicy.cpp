@@ -0,0 +1,218 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QTest>
+#include <Qt3DRender/private/textureresidencypolicy_p.h>
+
+namespace {
+
+class FakeTexture
+{
+public:
+    FakeTexture(qint64 size, qint64 lastUsedFrame, bool unique = false)
+        : m_size(size)
+        , m_lastUsedFrame(lastUsedFrame)
+        , m_unique(unique)
+        , m_resident(true)
+    {}
+
+    bool isUnique() const { return m_unique; }
+    bool isResident() const { return m_resident; }
+    qint64 lastUsedFrame() const { return m_lastUsedFrame; }
+    qint64 uploadedSourceDataSize() const { return m_size; }
+
+    void setResident(bool resident) { m_resident = resident; }
+
+private:
+    qint64 m_size;
+    qint64 m_lastUsedFrame;
+    bool m_unique;
+    bool m_resident;
+};
+
+typedef Qt3DRender::Render::TextureResidencyPolicy<FakeTexture> Policy;
+
+} // anonymous
+
+class tst_TextureResidencyPolicy : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkInitialState()
+    {
+        // GIVEN
+        Policy policy;
+
+        // THEN
+        QCOMPARE(policy.budget(), qint64(0));
+        QCOMPARE(policy.statistics().residentSize, qint64(0));
+        QCOMPARE(policy.statistics().residentTextures, 0);
+        QCOMPARE(policy.statistics().evictedTextures, 0);
+        QCOMPARE(policy.statistics().totalEvictedTextures, qint64(0));
+    }
+
+    void checkNoEvictionWithoutBudget()
+    {
+        // GIVEN
+        Policy policy;
+        FakeTexture a(1000, 1);
+        FakeTexture b(1000, 2);
+
+        // WHEN
+        const QVector<FakeTexture *> evicted = policy.selectTexturesToEvict({ &a, &b }, 10);
+
+        // THEN
+        QVERIFY(evicted.isEmpty());
+        QCOMPARE(policy.statistics().residentSize, qint64(2000));
+        QCOMPARE(policy.statistics().residentTextures, 2);
+    }
+
+    void checkNoEvictionWithinBudget()
+    {
+        // GIVEN
+        Policy policy;
+        policy.setBudget(2000);
+        FakeTexture a(1000, 1);
+        FakeTexture b(1000, 2);
+
+        // WHEN
+        const QVector<FakeTexture *> evicted = policy.selectTexturesToEvict({ &a, &b }, 10);
+
+        // THEN
+        QVERIFY(evicted.isEmpty());
+        QCOMPARE(policy.statistics().residentSize, qint64(2000));
+        QCOMPARE(policy.statistics().evictedTextures, 0);
+    }
+
+    void checkLeastRecentlyUsedEvictedFirst()
+    {
+        // GIVEN
+        Policy policy;
+        policy.setBudget(2500);
+        FakeTexture a(1000, 5);
+        FakeTexture b(1000, 2);
+        FakeTexture c(1000, 8);
+        FakeTexture d(1000, 3);
+
+        // WHEN
+        const QVector<FakeTexture *> evicted = policy.selectTexturesToEvict({ &a, &b, &c, &d }, 10);
+
+        // THEN
+        QCOMPARE(evicted, QVector<FakeTexture *>({ &b, &d }));
+        QCOMPARE(policy.statistics().residentSize, qint64(2000));
+        QCOMPARE(policy.statistics().residentTextures, 2);
+        QCOMPARE(policy.statistics().evictedTextures, 2);
+        QCOMPARE(policy.statistics().totalEvictedTextures, qint64(2));
+    }
+
+    void checkTexturesUsedThisFrameAreKept()
+    {
+        // GIVEN
+        Policy policy;
+        policy.setBudget(1000);
+        FakeTexture a(1000, 10);
+        FakeTexture b(1000, 10);
+        FakeTexture c(1000, 9);
+
+        // WHEN
+        const QVector<FakeTexture *> evicted = policy.selectTexturesToEvict({ &a, &b, &c }, 10);
+
+        // THEN -> still over budget, the textures needed by the frame stay
+        QCOMPARE(evicted, QVector<FakeTexture *>({ &c }));
+        QCOMPARE(policy.statistics().residentSize, qint64(2000));
+        QCOMPARE(policy.statistics().residentTextures, 2);
+    }
+
+    void checkUniqueTexturesAreKept()
+    {
+        // GIVEN
+        Policy policy;
+        policy.setBudget(1000);
+        FakeTexture renderTarget(4000, 1, true);
+        FakeTexture a(1000, 2);
+
+        // WHEN
+        const QVector<FakeTexture *> evicted = policy.selectTexturesToEvict({ &renderTarget, &a }, 10);
+
+        // THEN
+        QCOMPARE(evicted, QVector<FakeTexture *>({ &a }));
+        QCOMPARE(policy.statistics().residentSize, qint64(4000));
+    }
+
+    void checkNonResidentTexturesIgnored()
+    {
+        // GIVEN
+        Policy policy;
+        policy.setBudget(1000);
+        FakeTexture a(1000, 1);
+        FakeTexture b(1000, 2);
+        a.setResident(false);
+
+        // WHEN
+        const QVector<FakeTexture *> evicted = policy.selectTexturesToEvict({ &a, &b }, 10);
+
+        // THEN
+        QVERIFY(evicted.isEmpty());
+        QCOMPARE(policy.statistics().residentSize, qint64(1000));
+        QCOMPARE(policy.statistics().residentTextures, 1);
+    }
+
+    void checkStatisticsAccumulate()
+    {
+        // GIVEN
+        Policy policy;
+        policy.setBudget(1000);
+        FakeTexture a(1000, 1);
+        FakeTexture b(1000, 2);
+
+        // WHEN
+        QVector<FakeTexture *> evicted = policy.selectTexturesToEvict({ &a, &b }, 10);
+        for (FakeTexture *tex : evicted)
+            tex->setResident(false);
+
+        // THEN
+        QCOMPARE(evicted.size(), 1);
+        QCOMPARE(policy.statistics().totalEvictedTextures, qint64(1));
+
+        // WHEN -> a is reloaded and used again, b becomes the oldest texture
+        FakeTexture reloadedA(1000, 11);
+        evicted = policy.selectTexturesToEvict({ &reloadedA, &b }, 12);
+
+        // THEN
+        QCOMPARE(evicted, QVector<FakeTexture *>({ &b }));
+        QCOMPARE(policy.statistics().evictedTextures, 1);
+        QCOMPARE(policy.statistics().totalEvictedTextures, qint64(2));
+    }
+};
+
+QTEST_APPLESS_MAIN(tst_TextureResidencyPolicy)
+
+#include "tst_textureresidencypolicy.moc"
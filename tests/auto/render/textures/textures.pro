@@ -9,3 +9,16 @@ CONFIG += testcase
 SOURCES += tst_textures.cpp
 
 include(../../core/common/common.pri)
+
+OTHER_FILES = \
+    data/3x3-rgb8.ktx \
+    data/4x4-cube-bc1.ktx \
+    data/4x4-rgba8-mips.ktx \
+    data/4x4-rgba8-mips.ktx2 \
+    data/bad-image-size.ktx \
+    data/bad-keyvalue-size.ktx \
+    data/bad-level-size.ktx2 \
+    data/truncated.ktx \
+    data/truncated.ktx2
+
+TESTDATA = data/*
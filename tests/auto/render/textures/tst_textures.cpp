@@ -308,6 +308,125 @@ private Q_SLOTS:
         QVERIFY(texDataMgr->getData(tg1a) != texDataMgr->getData(tg2));
     }
 
+    void ktxImageData_data()
+    {
+        QTest::addColumn<QString>("source");
+        QTest::addColumn<int>("width");
+        QTest::addColumn<int>("height");
+        QTest::addColumn<int>("faces");
+        QTest::addColumn<int>("mipLevels");
+        QTest::addColumn<int>("target");
+        QTest::addColumn<int>("format");
+        QTest::addColumn<bool>("compressed");
+
+        QTest::newRow("ktx rgba8 mips") << QStringLiteral("data/4x4-rgba8-mips.ktx") << 4 << 4 << 1 << 3
+                                        << int(QOpenGLTexture::Target2D) << int(QOpenGLTexture::RGBA8_UNorm) << false;
+        QTest::newRow("ktx rgb8 padded rows") << QStringLiteral("data/3x3-rgb8.ktx") << 3 << 3 << 1 << 1
+                                              << int(QOpenGLTexture::Target2D) << int(QOpenGLTexture::RGB8_UNorm) << false;
+        QTest::newRow("ktx bc1 cubemap") << QStringLiteral("data/4x4-cube-bc1.ktx") << 4 << 4 << 6 << 1
+                                         << int(QOpenGLTexture::TargetCubeMap) << int(QOpenGLTexture::RGBA_DXT1) << true;
+        QTest::newRow("ktx2 rgba8 mips") << QStringLiteral("data/4x4-rgba8-mips.ktx2") << 4 << 4 << 1 << 3
+                                         << int(QOpenGLTexture::Target2D) << int(QOpenGLTexture::RGBA8_UNorm) << false;
+    }
+
+    void ktxImageData()
+    {
+        // GIVEN
+        QFETCH(QString, source);
+        QFETCH(int, width);
+        QFETCH(int, height);
+        QFETCH(int, faces);
+        QFETCH(int, mipLevels);
+        QFETCH(int, target);
+        QFETCH(int, format);
+        QFETCH(bool, compressed);
+
+        // WHEN
+        const Qt3DRender::QTextureImageDataPtr data =
+                Qt3DRender::TextureLoadingHelper::loadTextureData(QUrl::fromLocalFile(QFINDTESTDATA(source)), true, false);
+
+        // THEN
+        QVERIFY(data);
+        QCOMPARE(data->width(), width);
+        QCOMPARE(data->height(), height);
+        QCOMPARE(data->depth(), 1);
+        QCOMPARE(data->layers(), 1);
+        QCOMPARE(data->faces(), faces);
+        QCOMPARE(data->mipLevels(), mipLevels);
+        QCOMPARE(int(data->target()), target);
+        QCOMPARE(int(data->format()), format);
+        QCOMPARE(data->isCompressed(), compressed);
+    }
+
+    void ktxMalformedImageData_data()
+    {
+        QTest::addColumn<QString>("source");
+
+        QTest::newRow("ktx truncated") << QStringLiteral("data/truncated.ktx");
+        QTest::newRow("ktx key/value size past end") << QStringLiteral("data/bad-keyvalue-size.ktx");
+        QTest::newRow("ktx image size smaller than rows") << QStringLiteral("data/bad-image-size.ktx");
+        QTest::newRow("ktx2 truncated level index") << QStringLiteral("data/truncated.ktx2");
+        QTest::newRow("ktx2 level size past end") << QStringLiteral("data/bad-level-size.ktx2");
+    }
+
+    void ktxMalformedImageData()
+    {
+        // GIVEN
+        QFETCH(QString, source);
+
+        // WHEN
+        const Qt3DRender::QTextureImageDataPtr data =
+                Qt3DRender::TextureLoadingHelper::loadTextureData(QUrl::fromLocalFile(QFINDTESTDATA(source)), true, false);
+
+        // THEN
+        QVERIFY(data.isNull());
+    }
+
+    void ktxMipLevelsData()
+    {
+        // GIVEN -> every byte of mip level n is n + 1, in both containers
+        const QStringList sources = { QStringLiteral("data/4x4-rgba8-mips.ktx"),
+                                      QStringLiteral("data/4x4-rgba8-mips.ktx2") };
+
+        for (const QString &source : sources) {
+            // WHEN
+            const Qt3DRender::QTextureImageDataPtr data =
+                    Qt3DRender::TextureLoadingHelper::loadTextureData(QUrl::fromLocalFile(QFINDTESTDATA(source)), true, false);
+
+            // THEN
+            QVERIFY(data);
+            for (int level = 0; level < 3; ++level) {
+                const int size = 4 >> level;
+                QCOMPARE(data->data(0, 0, level), QByteArray(size * size * 4, char(level + 1)));
+            }
+        }
+    }
+
+    void ktxPaddedRowsData()
+    {
+        // WHEN
+        const Qt3DRender::QTextureImageDataPtr data =
+                Qt3DRender::TextureLoadingHelper::loadTextureData(QUrl::fromLocalFile(QFINDTESTDATA("data/3x3-rgb8.ktx")), true, false);
+
+        // THEN -> the row padding of the file is removed
+        QVERIFY(data);
+        QByteArray expected;
+        for (int i = 1; i <= 27; ++i)
+            expected.append(char(i));
+        QCOMPARE(data->data(0, 0, 0), expected);
+    }
+
+    void ktxCubeMapFacesData()
+    {
+        // WHEN
+        const Qt3DRender::QTextureImageDataPtr data =
+                Qt3DRender::TextureLoadingHelper::loadTextureData(QUrl::fromLocalFile(QFINDTESTDATA("data/4x4-cube-bc1.ktx")), true, false);
+
+        // THEN -> every byte of face n is n + 1
+        QVERIFY(data);
+        for (int face = 0; face < 6; ++face)
+            QCOMPARE(data->data(0, face, 0), QByteArray(8, char(face + 1)));
+    }
 };
 
 QTEST_MAIN(tst_RenderTextures)
@@ -30,6 +30,8 @@
 #include <QMatrix4x4>
 #include <Qt3DCore/private/qhandle_p.h>
 #include <Qt3DCore/private/qresourcemanager_p.h>
+#include <Qt3DCore/private/qflathash_p.h>
+#include <Qt3DCore/qnodeid.h>
 #include <ctime>
 #include <cstdlib>
 
@@ -49,6 +51,12 @@ private Q_SLOTS:
     void benchmarkLookupBigResources();
     void benchmarkRandomLookupBigResources();
     void benchmarkReleaseBigResources();
+    void benchmarkCreateDestroyCycleSmallResources();
+    void benchmarkCreateDestroyCycleBigResources();
+    void benchmarkBatchCreateDestroyCycleSmallResources();
+    void benchmarkBatchCreateDestroyCycleBigResources();
+    void benchmarkNodeIdLookupHash();
+    void benchmarkNodeIdLookupFlatHash();
 };
 
 class tst_SmallArrayResource
@@ -151,6 +159,27 @@ void benchmarkRandomLookupResources()
     Q_UNUSED(c);
 }
 
+template<typename Hash>
+void benchmarkNodeIdLookup()
+{
+    typedef Qt3DCore::QHandle<tst_SmallArrayResource, 32> Handle;
+    Hash hash;
+    const int max = 100000;
+    QVector<Qt3DCore::QNodeId> ids(max);
+    for (int i = 0; i < max; i++) {
+        ids[i] = Qt3DCore::QNodeId::createId();
+        hash.insert(ids[i], Handle());
+    }
+    std::srand(std::time(0));
+    std::random_shuffle(ids.begin(), ids.end());
+    volatile bool found;
+    QBENCHMARK {
+        for (int i = 0; i < max; i++)
+            found = hash.contains(ids[i]);
+    }
+    Q_UNUSED(found);
+}
+
 template<typename Resource>
 void benchmarkReleaseResources()
 {
@@ -165,6 +194,38 @@ void benchmarkReleaseResources()
     }
 }
 
+// Creates then destroys a large scene subtree, destruction happening
+// in creation order like when the subtree is removed
+template<typename Resource>
+void benchmarkCreateDestroyCycle()
+{
+    Qt3DCore::QResourceManager<Resource, int, 32> manager;
+    const int max = 60000;
+
+    QBENCHMARK {
+        for (int i = 0; i < max; i++)
+            manager.getOrCreateResource(i);
+        for (int i = 0; i < max; i++)
+            manager.releaseResource(i);
+    }
+}
+
+template<typename Resource>
+void benchmarkBatchCreateDestroyCycle()
+{
+    Qt3DCore::QResourceManager<Resource, int, 32> manager;
+    const int max = 60000;
+    QVector<int> ids(max);
+    for (int i = 0; i < max; i++)
+        ids[i] = i;
+
+    QBENCHMARK {
+        for (int i = 0; i < max; i++)
+            manager.getOrCreateResource(i);
+        manager.releaseResources(ids);
+    }
+}
+
 void tst_QResourceManager::benchmarkAllocateSmallResources()
 {
     benchmarkAllocateResources<tst_SmallArrayResource>();
@@ -225,6 +286,36 @@ void tst_QResourceManager::benchmarkReleaseBigResources()
     benchmarkReleaseResources<tst_BigArrayResource>();
 }
 
+void tst_QResourceManager::benchmarkCreateDestroyCycleSmallResources()
+{
+    benchmarkCreateDestroyCycle<tst_SmallArrayResource>();
+}
+
+void tst_QResourceManager::benchmarkCreateDestroyCycleBigResources()
+{
+    benchmarkCreateDestroyCycle<tst_BigArrayResource>();
+}
+
+void tst_QResourceManager::benchmarkBatchCreateDestroyCycleSmallResources()
+{
+    benchmarkBatchCreateDestroyCycle<tst_SmallArrayResource>();
+}
+
+void tst_QResourceManager::benchmarkBatchCreateDestroyCycleBigResources()
+{
+    benchmarkBatchCreateDestroyCycle<tst_BigArrayResource>();
+}
+
+void tst_QResourceManager::benchmarkNodeIdLookupHash()
+{
+    benchmarkNodeIdLookup<QHash<Qt3DCore::QNodeId, Qt3DCore::QHandle<tst_SmallArrayResource, 32> > >();
+}
+
+void tst_QResourceManager::benchmarkNodeIdLookupFlatHash()
+{
+    benchmarkNodeIdLookup<Qt3DCore::QFlatHash<Qt3DCore::QNodeId, Qt3DCore::QHandle<tst_SmallArrayResource, 32> > >();
+}
+
 QTEST_APPLESS_MAIN(tst_QResourceManager)
 
 #include "tst_bench_qresourcesmanager.moc"
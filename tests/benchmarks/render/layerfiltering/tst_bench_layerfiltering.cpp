@@ -162,6 +162,34 @@ private Q_SLOTS:
                                                          << (layerIds.size() != 0);
         }
 
+        {
+            Qt3DCore::QNodeIdVector layerIds;
+            Qt3DCore::QEntity *rootEntity = buildTestScene(32, 100000, layerIds);
+
+            QTest::newRow("FilterLayerFilter-100kEntities-32Layers") << rootEntity
+                                                                     << layerIds
+                                                                     << (layerIds.size() != 0);
+        }
+
+        {
+            Qt3DCore::QNodeIdVector layerIds;
+            Qt3DCore::QEntity *rootEntity = buildTestScene(32, 100000, layerIds, false);
+
+            QTest::newRow("FilterLayerFilter-100kEntities-32Layers-SomeDisabled") << rootEntity
+                                                                                  << layerIds
+                                                                                  << (layerIds.size() != 0);
+        }
+
+        {
+            Qt3DCore::QNodeIdVector layerIds;
+            Qt3DCore::QEntity *rootEntity = buildTestScene(32, 100000, layerIds);
+            layerIds.resize(1);
+
+            QTest::newRow("FilterLayerFilter-100kEntities-32Layers-OneSelected") << rootEntity
+                                                                                 << layerIds
+                                                                                 << (layerIds.size() != 0);
+        }
+
     }
 
     void filterEntities()
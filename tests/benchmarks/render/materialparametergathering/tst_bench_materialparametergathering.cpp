@@ -37,6 +37,8 @@
 #include <Qt3DRender/qrenderaspect.h>
 #include <Qt3DRender/private/qrenderaspect_p.h>
 #include <Qt3DRender/private/materialparametergathererjob_p.h>
+#include <Qt3DRender/private/materialparametergatherercache_p.h>
+#include <Qt3DRender/private/renderer_p.h>
 #include <Qt3DRender/private/technique_p.h>
 #include <Qt3DRender/private/techniquemanager_p.h>
 #include <Qt3DExtras/qphongmaterial.h>
@@ -78,6 +80,11 @@ public:
         return d_func()->m_renderer->nodeManagers();
     }
 
+    Render::Renderer *renderer() const
+    {
+        return static_cast<Render::Renderer *>(d_func()->m_renderer);
+    }
+
     Render::MaterialParameterGathererJobPtr materialGathererJob() const
     {
         Render::MaterialParameterGathererJobPtr job = Render::MaterialParameterGathererJobPtr::create();
@@ -134,6 +141,47 @@ private Q_SLOTS:
 
         QVERIFY(!gatheringJob->materialToPassAndParameter().empty());
     }
+
+    void cachedParameterGathering()
+    {
+        // GIVEN
+        QScopedPointer<Qt3DRender::TestAspect> aspect(new Qt3DRender::TestAspect(buildTestScene(2000)));
+        Qt3DRender::Render::MaterialParameterGathererCache *cache = aspect->renderer()->materialParameterGathererCache();
+
+        // WHEN
+        Qt3DRender::Render::MaterialParameterGathererJobPtr gatheringJob = aspect->materialGathererJob();
+        gatheringJob->setHandles(aspect->nodeManagers()->materialManager()->activeHandles());
+        gatheringJob->setCache(cache);
+        gatheringJob->run();
+
+        // Steady state: nothing in the material system changed since the last frame
+        QBENCHMARK {
+            gatheringJob->run();
+        }
+
+        QVERIFY(!gatheringJob->materialToPassAndParameter().empty());
+        QCOMPARE(cache->size(), 2000);
+    }
+
+    void invalidatedParameterGathering()
+    {
+        // GIVEN
+        QScopedPointer<Qt3DRender::TestAspect> aspect(new Qt3DRender::TestAspect(buildTestScene(2000)));
+        Qt3DRender::Render::MaterialParameterGathererCache *cache = aspect->renderer()->materialParameterGathererCache();
+
+        // WHEN
+        Qt3DRender::Render::MaterialParameterGathererJobPtr gatheringJob = aspect->materialGathererJob();
+        gatheringJob->setHandles(aspect->nodeManagers()->materialManager()->activeHandles());
+        gatheringJob->setCache(cache);
+
+        // Worst case: a material changed every frame, the cache is refilled
+        QBENCHMARK {
+            aspect->renderer()->markDirty(Qt3DRender::Render::AbstractRenderer::MaterialDirty, nullptr);
+            gatheringJob->run();
+        }
+
+        QVERIFY(!gatheringJob->materialToPassAndParameter().empty());
+    }
 };
 
 QTEST_MAIN(tst_BenchMaterialParameterGathering)
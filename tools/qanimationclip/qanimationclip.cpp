@@ -0,0 +1,274 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <qfile.h>
+#include <qfileinfo.h>
+#include <qdebug.h>
+#include <qendian.h>
+#include <qcoreapplication.h>
+#include <qcommandlineparser.h>
+#include <qjsondocument.h>
+#include <qjsonobject.h>
+#include <qjsonarray.h>
+#include <qvector.h>
+
+#include <cstring>
+
+// Keep in sync with the reader in src/animation/backend/animationclip.cpp
+static const char binaryClipMagic[4] = { 'Q', 'A', 'C', '1' };
+static const quint32 binaryClipVersion = 1;
+static const int binaryClipHeaderSize = 16;
+static const int binaryClipIndexEntrySize = 16;
+
+// Matches QKeyFrame::InterpolationType
+enum InterpolationType {
+    ConstantInterpolation,
+    LinearInterpolation,
+    BezierInterpolation
+};
+
+static const char *description =
+        "Converts JSON animation clips as loaded by QAnimationClipLoader into a\n"
+        "precompiled binary container. All animations of all input files are\n"
+        "stored in the output file, each one in a block that can be memory mapped\n"
+        "on its own. A single animation is selected at runtime by giving its name\n"
+        "as the fragment of the source url, e.g. qrc:/clips.qac#Walk.";
+
+struct Options {
+    QString outFileName;
+    bool showLog;
+} opts;
+
+class ByteWriter
+{
+public:
+    explicit ByteWriter(QByteArray *data) : m_data(data) {}
+
+    int offset() const { return m_data->size(); }
+
+    void writeUInt32(quint32 value)
+    {
+        uchar bytes[4];
+        qToLittleEndian<quint32>(value, bytes);
+        m_data->append(reinterpret_cast<const char *>(bytes), 4);
+    }
+
+    void writeFloat(float value)
+    {
+        quint32 bits;
+        std::memcpy(&bits, &value, sizeof(float));
+        writeUInt32(bits);
+    }
+
+    void setUInt32(int offset, quint32 value)
+    {
+        qToLittleEndian<quint32>(value, reinterpret_cast<uchar *>(m_data->data() + offset));
+    }
+
+    void align()
+    {
+        while (m_data->size() % 4)
+            m_data->append('\0');
+    }
+
+private:
+    QByteArray *m_data;
+};
+
+struct StringEntry {
+    int recordOffset;
+    QByteArray utf8;
+};
+
+// Serializes one animation object of the JSON format into a self contained
+// data block. Offsets stored in the block are relative to its start.
+static QByteArray compileAnimation(const QJsonObject &animation)
+{
+    const QJsonArray channels = animation[QLatin1String("channels")].toArray();
+    int componentCount = 0;
+    for (const QJsonValue &channel : channels)
+        componentCount += channel.toObject()[QLatin1String("channelComponents")].toArray().size();
+
+    QByteArray block;
+    ByteWriter writer(&block);
+    writer.writeUInt32(channels.size());
+    writer.writeUInt32(componentCount);
+
+    // Reserve the channel and component records, they are patched once the
+    // keyframes and strings have been laid out
+    const int channelRecordsOffset = writer.offset();
+    const int componentRecordsOffset = channelRecordsOffset + channels.size() * 16;
+    block.resize(componentRecordsOffset + componentCount * 16);
+
+    QVector<StringEntry> strings;
+    int componentIndex = 0;
+    for (int i = 0; i < channels.size(); ++i) {
+        const QJsonObject channel = channels.at(i).toObject();
+        const QJsonArray components = channel[QLatin1String("channelComponents")].toArray();
+        const int channelRecord = channelRecordsOffset + i * 16;
+        strings.push_back({ channelRecord, channel[QLatin1String("channelName")].toString().toUtf8() });
+        writer.setUInt32(channelRecord + 8, componentIndex);
+        writer.setUInt32(channelRecord + 12, components.size());
+
+        for (const QJsonValue &componentValue : components) {
+            const QJsonObject component = componentValue.toObject();
+            const QJsonArray keyframes = component[QLatin1String("keyFrames")].toArray();
+            const int componentRecord = componentRecordsOffset + componentIndex * 16;
+            strings.push_back({ componentRecord, component[QLatin1String("channelComponentName")].toString().toUtf8() });
+            writer.setUInt32(componentRecord + 8, writer.offset());
+            writer.setUInt32(componentRecord + 12, keyframes.size());
+
+            for (const QJsonValue &keyframeValue : keyframes) {
+                const QJsonObject keyframe = keyframeValue.toObject();
+                const QJsonArray coords = keyframe[QLatin1String("coords")].toArray();
+                writer.writeFloat(coords.at(0).toDouble());
+                writer.writeFloat(coords.at(1).toDouble());
+                if (keyframe.contains(QLatin1String("leftHandle"))) {
+                    const QJsonArray leftHandle = keyframe[QLatin1String("leftHandle")].toArray();
+                    const QJsonArray rightHandle = keyframe[QLatin1String("rightHandle")].toArray();
+                    writer.writeFloat(leftHandle.at(0).toDouble());
+                    writer.writeFloat(leftHandle.at(1).toDouble());
+                    writer.writeFloat(rightHandle.at(0).toDouble());
+                    writer.writeFloat(rightHandle.at(1).toDouble());
+                    writer.writeUInt32(BezierInterpolation);
+                } else {
+                    for (int j = 0; j < 4; ++j)
+                        writer.writeFloat(0.0f);
+                    writer.writeUInt32(LinearInterpolation);
+                }
+            }
+            ++componentIndex;
+        }
+    }
+
+    for (const StringEntry &string : qAsConst(strings)) {
+        writer.setUInt32(string.recordOffset, writer.offset());
+        writer.setUInt32(string.recordOffset + 4, string.utf8.size());
+        block.append(string.utf8);
+    }
+    writer.align();
+
+    return block;
+}
+
+static bool compile(const QStringList &fileNames)
+{
+    QVector<QByteArray> names;
+    QVector<QByteArray> blocks;
+
+    for (const QString &fileName : fileNames) {
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly)) {
+            qWarning() << "Cannot open" << fileName;
+            return false;
+        }
+        QJsonParseError error;
+        const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+        if (error.error != QJsonParseError::NoError) {
+            qWarning() << "Failed to parse" << fileName << error.errorString();
+            return false;
+        }
+
+        const QJsonArray animations = document.object()[QLatin1String("animations")].toArray();
+        for (const QJsonValue &animationValue : animations) {
+            const QJsonObject animation = animationValue.toObject();
+            const QByteArray name = animation[QLatin1String("animationName")].toString().toUtf8();
+            if (names.contains(name))
+                qWarning() << "Duplicate animation" << name << "in" << fileName << "- only the first one can be selected by name";
+            names.push_back(name);
+            blocks.push_back(compileAnimation(animation));
+            if (opts.showLog)
+                qDebug() << "Compiled animation" << name << "from" << fileName << "(" << blocks.last().size() << "bytes )";
+        }
+    }
+
+    QByteArray data;
+    ByteWriter writer(&data);
+    data.append(binaryClipMagic, sizeof(binaryClipMagic));
+    writer.writeUInt32(binaryClipVersion);
+    writer.writeUInt32(blocks.size());
+    writer.writeUInt32(0);
+    Q_ASSERT(data.size() == binaryClipHeaderSize);
+
+    // Index followed by the animation names, then the data blocks
+    const int indexOffset = writer.offset();
+    data.resize(indexOffset + blocks.size() * binaryClipIndexEntrySize);
+    for (int i = 0; i < names.size(); ++i) {
+        writer.setUInt32(indexOffset + i * binaryClipIndexEntrySize, writer.offset());
+        writer.setUInt32(indexOffset + i * binaryClipIndexEntrySize + 4, names[i].size());
+        data.append(names[i]);
+    }
+    writer.align();
+    for (int i = 0; i < blocks.size(); ++i) {
+        writer.setUInt32(indexOffset + i * binaryClipIndexEntrySize + 8, writer.offset());
+        writer.setUInt32(indexOffset + i * binaryClipIndexEntrySize + 12, blocks[i].size());
+        data.append(blocks[i]);
+    }
+
+    QFile outFile(opts.outFileName);
+    if (!outFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Cannot write" << opts.outFileName;
+        return false;
+    }
+    outFile.write(data);
+    if (opts.showLog)
+        qDebug() << "Wrote" << blocks.size() << "animations to" << opts.outFileName;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationVersion(QStringLiteral("0.1"));
+    app.setApplicationName(QStringLiteral("Qt animation clip compiler"));
+
+    QCommandLineParser cmdLine;
+    cmdLine.addHelpOption();
+    cmdLine.addVersionOption();
+    cmdLine.setApplicationDescription(QString::fromUtf8(description));
+    QCommandLineOption outFileOpt(QStringLiteral("o"), QStringLiteral("Write the binary clip container to <file>"), QStringLiteral("file"));
+    cmdLine.addOption(outFileOpt);
+    QCommandLineOption silentOpt(QStringLiteral("s"), QStringLiteral("Silence debug output"));
+    cmdLine.addOption(silentOpt);
+    cmdLine.addPositionalArgument(QStringLiteral("files"), QStringLiteral("JSON animation clips to compile"));
+    cmdLine.process(app);
+    opts.showLog = !cmdLine.isSet(silentOpt);
+
+    const QStringList fileNames = cmdLine.positionalArguments();
+    if (fileNames.isEmpty())
+        cmdLine.showHelp();
+
+    opts.outFileName = cmdLine.value(outFileOpt);
+    if (opts.outFileName.isEmpty()) {
+        const QFileInfo fi(fileNames.first());
+        opts.outFileName = fi.path() + QLatin1Char('/') + fi.completeBaseName() + QStringLiteral(".qac");
+    }
+
+    return compile(fileNames) ? 0 : 1;
+}
@@ -0,0 +1,8 @@
+option(host_build)
+
+# Qt3D is free of Q_FOREACH - make sure it stays that way:
+DEFINES *= QT_NO_FOREACH
+
+SOURCES = qanimationclip.cpp
+
+load(qt_tool)
@@ -2,3 +2,5 @@ TEMPLATE = subdirs
 QT_FOR_CONFIG += 3dcore-private
 !android:qtConfig(assimp):qtConfig(commandlineparser): \
     SUBDIRS += qgltf
+qtConfig(commandlineparser): \
+    SUBDIRS += qanimationclip